@@ -0,0 +1,446 @@
+//-----------------------------------------------------------------------------
+//
+// Zandronum Master Server Source
+// Copyright (C) 2026 Zandronum Development Team
+// All rights reserved.
+//
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the Skulltag Development Team nor the names of its
+//    contributors may be used to endorse or promote products derived from this
+//    software without specific prior written permission.
+// 4. Redistributions in any form must be accompanied by information on how to
+//    obtain complete source code for the software and any accompanying
+//    software that uses the software. The source code must either be included
+//    in the distribution or be available for no more than the cost of
+//    distribution plus a nominal fee, and must be freely redistributable
+//    under reasonable conditions. For an executable file, complete source
+//    code means the source code for all modules it contains. It does not
+//    include source code for modules or files that typically accompany the
+//    major components of the operating system on which the executable file
+//    runs.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+//
+//
+// Filename: loadgen.cpp
+//
+// Description: Simulates many servers and launchers talking to a master server,
+// to measure how many server lists it can hand out. Every simulated host gets
+// its own loopback address (127.1.x.y for servers, 127.2.x.y for launchers),
+// since the master server limits the number of servers and queries per IP.
+//
+//-----------------------------------------------------------------------------
+
+#include "../src/networkheaders.h"
+#include "../src/networkshared.h"
+#include "../src/huffman/huffman.h"
+#include <poll.h>
+#include <sys/time.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+//*****************************************************************************
+//	STRUCTURES
+
+struct SIMULATEDHOST_s
+{
+	SOCKET			Socket;
+	NETADDRESS_s	Address;
+
+	// Servers: the verification string sent to the master.
+	std::string		VerificationString;
+
+	// When the last heartbeat (servers) or query (launchers) was sent, in milliseconds.
+	long long		llLastSent;
+
+	// Launchers: whether a query is being answered and how many servers were received so far.
+	bool			bWaiting;
+	unsigned int	uiServersReceived;
+};
+
+//*****************************************************************************
+//	VARIABLES
+
+static	NETADDRESS_s					g_AddressMaster;
+static	std::vector<SIMULATEDHOST_s>	g_Servers;
+static	std::vector<SIMULATEDHOST_s>	g_Launchers;
+static	std::vector<pollfd>				g_PollFDs;
+
+static	NETBUFFER_s						g_MessageBuffer;
+static	UCHAR							g_ucHuffmanBuffer[MAX_UDP_PACKET * 4];
+static	UCHAR							g_ucDecodedBuffer[MAX_UDP_PACKET * 8];
+
+// Statistics of the current report interval.
+static	unsigned int					g_uiQueriesSent;
+static	unsigned int					g_uiListsReceived;
+static	unsigned int					g_uiQueriesIgnored;
+static	unsigned int					g_uiQueriesTimedOut;
+static	unsigned int					g_uiLastListSize;
+static	long long						g_llTotalLatency;
+
+// Totals.
+static	unsigned int					g_uiTotalQueries;
+static	unsigned int					g_uiTotalLists;
+
+//*****************************************************************************
+//	FUNCTIONS
+
+// Returns time in milliseconds.
+static long long loadgen_GetTime( void )
+{
+	struct timeval tv;
+	gettimeofday( &tv, NULL );
+	return static_cast<long long>( tv.tv_sec ) * 1000 + tv.tv_usec / 1000;
+}
+
+//*****************************************************************************
+//
+static bool loadgen_CreateHost( SIMULATEDHOST_s &Host, BYTE bNetwork, unsigned int uiIndex )
+{
+	struct sockaddr_in address;
+
+	memset( &address, 0, sizeof( address ));
+	address.sin_family = AF_INET;
+	address.sin_addr.s_addr = htonl( ( 127u << 24 ) | ( bNetwork << 16 ) | ((( uiIndex / 250 ) % 256 ) << 8 ) | ( uiIndex % 250 + 1 ));
+	address.sin_port = 0;
+
+	Host.Socket = socket( PF_INET, SOCK_DGRAM, IPPROTO_UDP );
+	if ( Host.Socket == INVALID_SOCKET )
+		return false;
+
+	if ( bind( Host.Socket, reinterpret_cast<sockaddr *>( &address ), sizeof( address )) == SOCKET_ERROR )
+	{
+		printf( "Couldn't bind to %s: %s\n", inet_ntoa( address.sin_addr ), strerror( errno ));
+		closesocket( Host.Socket );
+		return false;
+	}
+
+	ULONG ulArg = true;
+	ioctlsocket( Host.Socket, FIONBIO, &ulArg );
+
+	Host.Address.LoadFromSocketAddress( reinterpret_cast<const sockaddr &>( address ));
+	Host.llLastSent = 0;
+	Host.bWaiting = false;
+	Host.uiServersReceived = 0;
+
+	pollfd fd;
+	fd.fd = Host.Socket;
+	fd.events = POLLIN;
+	fd.revents = 0;
+	g_PollFDs.push_back( fd );
+	return true;
+}
+
+//*****************************************************************************
+//
+static void loadgen_Send( const SIMULATEDHOST_s &Host )
+{
+	INT iNumBytesOut = sizeof( g_ucHuffmanBuffer );
+	struct sockaddr_in SocketAddress;
+
+	g_MessageBuffer.ulCurrentSize = g_MessageBuffer.CalcSize();
+	HUFFMAN_Encode( g_MessageBuffer.pbData, g_ucHuffmanBuffer, g_MessageBuffer.ulCurrentSize, &iNumBytesOut );
+	g_AddressMaster.ToSocketAddress( reinterpret_cast<sockaddr &>( SocketAddress ));
+	sendto( Host.Socket, (const char *)g_ucHuffmanBuffer, iNumBytesOut, 0, reinterpret_cast<sockaddr *>( &SocketAddress ), sizeof( SocketAddress ));
+}
+
+//*****************************************************************************
+//
+// Receives a packet on the host's socket, returns false if there is none.
+//
+static bool loadgen_Receive( const SIMULATEDHOST_s &Host, BYTESTREAM_s &ByteStream )
+{
+	const LONG lNumBytes = recv( Host.Socket, (char *)g_ucHuffmanBuffer, sizeof( g_ucHuffmanBuffer ), 0 );
+
+	if ( lNumBytes <= 0 )
+		return false;
+
+	INT iDecodedNumBytes = sizeof( g_ucDecodedBuffer );
+	HUFFMAN_Decode( g_ucHuffmanBuffer, g_ucDecodedBuffer, lNumBytes, &iDecodedNumBytes );
+	ByteStream.pbStream = g_ucDecodedBuffer;
+	ByteStream.pbStreamEnd = g_ucDecodedBuffer + iDecodedNumBytes;
+	return true;
+}
+
+//*****************************************************************************
+//
+static void loadgen_SendHeartbeat( SIMULATEDHOST_s &Server, long long llTime )
+{
+	g_MessageBuffer.Clear();
+	g_MessageBuffer.ByteStream.WriteLong( SERVER_MASTER_CHALLENGE );
+	g_MessageBuffer.ByteStream.WriteString( Server.VerificationString.c_str() );
+	g_MessageBuffer.ByteStream.WriteByte( 1 ); // Enforces the master ban list.
+	g_MessageBuffer.ByteStream.WriteLong( 9999 ); // Revision.
+	loadgen_Send( Server );
+	Server.llLastSent = llTime;
+}
+
+//*****************************************************************************
+//
+static void loadgen_ParseServerPacket( SIMULATEDHOST_s &Server, BYTESTREAM_s &ByteStream )
+{
+	switch ( ByteStream.ReadByte() )
+	{
+	case MASTER_SERVER_VERIFICATION:
+		{
+			ByteStream.ReadString();
+			const int iVerificationInt = ByteStream.ReadLong();
+
+			g_MessageBuffer.Clear();
+			g_MessageBuffer.ByteStream.WriteLong( SERVER_MASTER_VERIFICATION );
+			g_MessageBuffer.ByteStream.WriteString( Server.VerificationString.c_str() );
+			g_MessageBuffer.ByteStream.WriteLong( iVerificationInt );
+			loadgen_Send( Server );
+		}
+		break;
+	case MASTER_SERVER_BANLISTPART:
+		// Acknowledge the ban list once its last part arrived.
+		if (( ByteStream.pbStreamEnd > ByteStream.pbStream ) && ( ByteStream.pbStreamEnd[-1] == MSB_ENDBANLIST ))
+		{
+			g_MessageBuffer.Clear();
+			g_MessageBuffer.ByteStream.WriteLong( SERVER_MASTER_BANLIST_RECEIPT );
+			g_MessageBuffer.ByteStream.WriteString( Server.VerificationString.c_str() );
+			loadgen_Send( Server );
+		}
+		break;
+	}
+}
+
+//*****************************************************************************
+//
+static void loadgen_ParseLauncherPacket( SIMULATEDHOST_s &Launcher, BYTESTREAM_s &ByteStream, long long llTime )
+{
+	if ( Launcher.bWaiting == false )
+		return;
+
+	switch ( ByteStream.ReadLong() )
+	{
+	case MSC_BEGINSERVERLISTPART:
+		ByteStream.ReadByte(); // Packet number.
+
+		while ( ByteStream.pbStream < ByteStream.pbStreamEnd )
+		{
+			switch ( ByteStream.ReadByte() )
+			{
+			case MSC_SERVERBLOCK:
+				for ( int iNumPorts = ByteStream.ReadByte(); iNumPorts > 0; iNumPorts = ByteStream.ReadByte() )
+				{
+					ByteStream.pbStream += 4 + 2 * iNumPorts; // IP and ports.
+					Launcher.uiServersReceived += iNumPorts;
+				}
+				break;
+			case MSC_ENDSERVERLIST:
+				Launcher.bWaiting = false;
+				g_uiListsReceived++;
+				g_llTotalLatency += llTime - Launcher.llLastSent;
+				g_uiLastListSize = Launcher.uiServersReceived;
+				return;
+			default: // MSC_ENDSERVERLISTPART
+				return;
+			}
+		}
+		break;
+	case MSC_REQUESTIGNORED:
+	case MSC_IPISBANNED:
+	case MSC_WRONGVERSION:
+		Launcher.bWaiting = false;
+		g_uiQueriesIgnored++;
+		break;
+	}
+}
+
+//*****************************************************************************
+//
+static void loadgen_SendQuery( SIMULATEDHOST_s &Launcher, long long llTime )
+{
+	g_MessageBuffer.Clear();
+	g_MessageBuffer.ByteStream.WriteLong( LAUNCHER_MASTER_CHALLENGE );
+	g_MessageBuffer.ByteStream.WriteShort( MASTER_SERVER_VERSION );
+	loadgen_Send( Launcher );
+
+	Launcher.llLastSent = llTime;
+	Launcher.bWaiting = true;
+	Launcher.uiServersReceived = 0;
+	g_uiQueriesSent++;
+}
+
+//*****************************************************************************
+//
+static void loadgen_PrintUsage( void )
+{
+	printf( "Usage: master-97-loadgen [-master <ip:port>] [-servers <num>] [-launchers <num>] [-interval <seconds>] [-time <seconds>]\n" );
+	printf( "  -master    Master server to test (default 127.0.0.1:%d).\n", DEFAULT_MASTER_PORT );
+	printf( "  -servers   Number of simulated servers (default 200).\n" );
+	printf( "  -launchers Number of simulated launchers (default 400).\n" );
+	printf( "  -interval  Seconds between two queries of the same launcher (default 11). The\n" );
+	printf( "             master ignores launchers that query it more often than every 10 seconds.\n" );
+	printf( "  -time      How long to run (default 60).\n" );
+}
+
+//*****************************************************************************
+//
+int main( int argc, char **argv )
+{
+	unsigned int	uiNumServers = 200;
+	unsigned int	uiNumLaunchers = 400;
+	long long		llInterval = 11000;
+	long long		llDuration = 60000;
+	const char		*pszMaster = "127.0.0.1";
+
+	for ( int i = 1; i < argc; ++i )
+	{
+		if (( stricmp( argv[i], "-master" ) == 0 ) && ( i + 1 < argc ))
+			pszMaster = argv[++i];
+		else if (( stricmp( argv[i], "-servers" ) == 0 ) && ( i + 1 < argc ))
+			uiNumServers = atoi( argv[++i] );
+		else if (( stricmp( argv[i], "-launchers" ) == 0 ) && ( i + 1 < argc ))
+			uiNumLaunchers = atoi( argv[++i] );
+		else if (( stricmp( argv[i], "-interval" ) == 0 ) && ( i + 1 < argc ))
+			llInterval = atoi( argv[++i] ) * 1000LL;
+		else if (( stricmp( argv[i], "-time" ) == 0 ) && ( i + 1 < argc ))
+			llDuration = atoi( argv[++i] ) * 1000LL;
+		else
+		{
+			loadgen_PrintUsage( );
+			return 1;
+		}
+	}
+
+	if ( g_AddressMaster.LoadFromString( pszMaster ) == false )
+	{
+		printf( "Invalid master server address: %s\n", pszMaster );
+		return 1;
+	}
+
+	if ( g_AddressMaster.usPort == 0 )
+		g_AddressMaster.SetPort( DEFAULT_MASTER_PORT );
+
+	HUFFMAN_Construct( );
+	g_MessageBuffer.Init( MAX_UDP_PACKET, BUFFERTYPE_WRITE );
+
+	g_Servers.resize( uiNumServers );
+	for ( unsigned int i = 0; i < uiNumServers; ++i )
+	{
+		if ( loadgen_CreateHost( g_Servers[i], 1, i ) == false )
+			return 1;
+
+		char szVerification[32];
+		snprintf( szVerification, sizeof( szVerification ), "loadgen%u", i );
+		g_Servers[i].VerificationString = szVerification;
+	}
+
+	g_Launchers.resize( uiNumLaunchers );
+	for ( unsigned int i = 0; i < uiNumLaunchers; ++i )
+	{
+		if ( loadgen_CreateHost( g_Launchers[i], 2, i ) == false )
+			return 1;
+	}
+
+	printf( "Simulating %u servers and %u launchers against %s for %lld seconds.\n", uiNumServers, uiNumLaunchers, g_AddressMaster.ToString(), llDuration / 1000 );
+
+	const long long llStart = loadgen_GetTime( );
+	long long llLastReport = llStart;
+	BYTESTREAM_s ByteStream;
+
+	// Spread the first heartbeats over a second, bursts would overflow the socket buffers.
+	// The launchers start after that, once the master verified the servers.
+	for ( unsigned int i = 0; i < uiNumServers; ++i )
+		g_Servers[i].llLastSent = llStart - 20000 + ( 1000LL * i ) / uiNumServers;
+
+	// Spread the queries over the interval.
+	for ( unsigned int i = 0; i < uiNumLaunchers; ++i )
+		g_Launchers[i].llLastSent = llStart + 2000 - llInterval + ( llInterval * i ) / uiNumLaunchers;
+
+	while ( true )
+	{
+		const long long llTime = loadgen_GetTime( );
+
+		if ( llTime - llStart >= llDuration )
+			break;
+
+		for ( unsigned int i = 0; i < uiNumServers; ++i )
+		{
+			if ( llTime - g_Servers[i].llLastSent >= 20000 )
+				loadgen_SendHeartbeat( g_Servers[i], llTime );
+		}
+
+		for ( unsigned int i = 0; i < uiNumLaunchers; ++i )
+		{
+			SIMULATEDHOST_s &Launcher = g_Launchers[i];
+
+			if ( Launcher.bWaiting && ( llTime - Launcher.llLastSent >= 5000 ))
+			{
+				Launcher.bWaiting = false;
+				g_uiQueriesTimedOut++;
+			}
+
+			if (( Launcher.bWaiting == false ) && ( llTime - Launcher.llLastSent >= llInterval ))
+				loadgen_SendQuery( Launcher, llTime );
+		}
+
+		if ( poll( &g_PollFDs[0], g_PollFDs.size(), 10 ) > 0 )
+		{
+			for ( unsigned int i = 0; i < g_PollFDs.size(); ++i )
+			{
+				if (( g_PollFDs[i].revents & POLLIN ) == 0 )
+					continue;
+
+				if ( i < uiNumServers )
+				{
+					while ( loadgen_Receive( g_Servers[i], ByteStream ))
+						loadgen_ParseServerPacket( g_Servers[i], ByteStream );
+				}
+				else
+				{
+					SIMULATEDHOST_s &Launcher = g_Launchers[i - uiNumServers];
+
+					while ( loadgen_Receive( Launcher, ByteStream ))
+						loadgen_ParseLauncherPacket( Launcher, ByteStream, llTime );
+				}
+			}
+		}
+
+		if ( llTime - llLastReport >= 1000 )
+		{
+			printf( "%4llds: %u queries, %u lists (%u servers, %.1f ms average), %u ignored, %u timed out\n",
+				( llTime - llStart ) / 1000, g_uiQueriesSent, g_uiListsReceived, g_uiLastListSize,
+				g_uiListsReceived ? static_cast<double>( g_llTotalLatency ) / g_uiListsReceived : 0.0,
+				g_uiQueriesIgnored, g_uiQueriesTimedOut );
+
+			g_uiTotalQueries += g_uiQueriesSent;
+			g_uiTotalLists += g_uiListsReceived;
+			g_uiQueriesSent = g_uiListsReceived = g_uiQueriesIgnored = g_uiQueriesTimedOut = 0;
+			g_llTotalLatency = 0;
+			llLastReport = llTime;
+		}
+	}
+
+	printf( "Done: %u queries, %u lists received.\n", g_uiTotalQueries, g_uiTotalLists );
+
+	for ( unsigned int i = 0; i < g_PollFDs.size(); ++i )
+		closesocket( g_PollFDs[i].fd );
+
+	g_MessageBuffer.Free();
+	return 0;
+}
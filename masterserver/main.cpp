@@ -108,6 +108,11 @@ static	QueryIPQueue			g_ShortFloodQueue( 3 );
 // [BB] Do we want to hide servers that ignore our ban list?
 static	bool					g_bHideBanIgnoringServers = false;
 
+// The encoded server list packets sent to launchers. They are only rebuilt when the list changed.
+static	std::vector<std::vector<UCHAR> >	g_ServerListParts; // LAUNCHER_MASTER_CHALLENGE
+static	std::vector<UCHAR>		g_FullServerList; // LAUNCHER_SERVER_CHALLENGE
+static	bool					g_bServerListChanged = true;
+
 //*****************************************************************************
 //	CLASSES
 
@@ -308,6 +313,86 @@ void MASTERSERVER_SendServerIPBlockToLauncher( const NETADDRESS_s &Address, cons
 		pByteStream->WriteShort( ntohs( PortList[i] ) );
 }
 
+//*****************************************************************************
+//
+// Rebuilds the encoded server list packets from g_Servers.
+//
+void MASTERSERVER_BuildServerLists( void )
+{
+	// Build the list of servers.
+	g_MessageBuffer.Clear();
+	g_MessageBuffer.ByteStream.WriteLong( MSC_BEGINSERVERLIST );
+	for( std::set<SERVER_s, SERVERCompFunc>::const_iterator it = g_Servers.begin(); it != g_Servers.end(); ++it )
+	{
+		// [BB] Possibly omit servers that don't enforce our ban list.
+		if ( ( it->bEnforcesBanList == true ) || ( g_bHideBanIgnoringServers == false ) )
+			MASTERSERVER_SendServerIPToLauncher ( it->Address, &g_MessageBuffer.ByteStream );
+	}
+
+	// Tell the launcher that we're done sending servers.
+	g_MessageBuffer.ByteStream.WriteByte( MSC_ENDSERVERLIST );
+	NETWORK_EncodePacket( &g_MessageBuffer, g_FullServerList );
+
+	// Build the list split into several packets.
+	const unsigned long ulMaxPacketSize = 1024;
+	unsigned long ulPacketNum = 0;
+
+	g_ServerListParts.clear();
+
+	std::set<SERVER_s, SERVERCompFunc>::const_iterator it = g_Servers.begin();
+
+	g_MessageBuffer.Clear();
+	g_MessageBuffer.ByteStream.WriteLong( MSC_BEGINSERVERLISTPART );
+	g_MessageBuffer.ByteStream.WriteByte( ulPacketNum );
+	g_MessageBuffer.ByteStream.WriteByte( MSC_SERVERBLOCK );
+	unsigned long ulSizeOfPacket = 6; // 4 (MSC_BEGINSERVERLISTPART) + 1 (0) + 1 (MSC_SERVERBLOCK)
+
+	while ( it != g_Servers.end() )
+	{
+		NETADDRESS_s serverAddress = it->Address;
+		std::vector<USHORT> serverPortList;
+
+		do {
+			// [BB] Possibly omit servers that don't enforce our ban list.
+			if ( ( it->bEnforcesBanList == true ) || ( g_bHideBanIgnoringServers == false ) )
+				serverPortList.push_back ( it->Address.usPort );
+			++it;
+		} while ( ( it != g_Servers.end() ) && it->Address.CompareNoPort( serverAddress ) );
+
+		// [BB] All servers on this IP ignore the list, nothing to send.
+		if ( serverPortList.size() == 0 )
+			continue;
+
+		const unsigned long ulServerBlockNetSize = MASTERSERVER_CalcServerIPBlockNetSize( serverAddress, serverPortList );
+
+		// [BB] If sending this block would cause the current packet to exceed ulMaxPacketSize ...
+		if ( ulSizeOfPacket + ulServerBlockNetSize > ulMaxPacketSize - 1 )
+		{
+			// [BB] ... close the current packet and start a new one.
+			g_MessageBuffer.ByteStream.WriteByte( 0 ); // [BB] Terminate MSC_SERVERBLOCK by sending 0 ports.
+			g_MessageBuffer.ByteStream.WriteByte( MSC_ENDSERVERLISTPART );
+			g_ServerListParts.push_back( std::vector<UCHAR>() );
+			NETWORK_EncodePacket( &g_MessageBuffer, g_ServerListParts.back() );
+
+			g_MessageBuffer.Clear();
+			++ulPacketNum;
+			ulSizeOfPacket = 5;
+			g_MessageBuffer.ByteStream.WriteLong( MSC_BEGINSERVERLISTPART );
+			g_MessageBuffer.ByteStream.WriteByte( ulPacketNum );
+			g_MessageBuffer.ByteStream.WriteByte( MSC_SERVERBLOCK );
+		}
+		ulSizeOfPacket += ulServerBlockNetSize;
+		MASTERSERVER_SendServerIPBlockToLauncher ( serverAddress, serverPortList, &g_MessageBuffer.ByteStream );
+	}
+	g_MessageBuffer.ByteStream.WriteByte( 0 ); // [BB] Terminate MSC_SERVERBLOCK by sending 0 ports.
+	g_MessageBuffer.ByteStream.WriteByte( MSC_ENDSERVERLIST );
+	g_ServerListParts.push_back( std::vector<UCHAR>() );
+	NETWORK_EncodePacket( &g_MessageBuffer, g_ServerListParts.back() );
+
+	g_MessageBuffer.Clear();
+	g_bServerListChanged = false;
+}
+
 //*****************************************************************************
 //
 unsigned long MASTERSERVER_NumServers ( void )
@@ -388,6 +473,7 @@ void MASTERSERVER_AddServer( const SERVER_s &Server, std::set<SERVER_s, SERVERCo
 		addedServer->lLastReceived = g_lCurrentTime;						
 		if ( &ServerSet == &g_Servers )
 		{
+			g_bServerListChanged = true;
 			printf( "+ Adding %s (revision %d) to the server list.\n", addedServer->Address.ToString(), addedServer->iServerRevision );
 			MASTERSERVER_SendBanlistToServer( *addedServer );
 		}
@@ -506,7 +592,11 @@ void MASTERSERVER_ParseCommands( BYTESTREAM_s *pByteStream )
 				{
 					currentServer->lLastReceived = g_lCurrentTime;
 					// [BB] The server possibly changed the ban setting, so update it.
-					currentServer->bEnforcesBanList = newServer.bEnforcesBanList;
+					if ( currentServer->bEnforcesBanList != newServer.bEnforcesBanList )
+					{
+						currentServer->bEnforcesBanList = newServer.bEnforcesBanList;
+						g_bServerListChanged = true;
+					}
 				}
 			}
 
@@ -591,76 +681,19 @@ void MASTERSERVER_ParseCommands( BYTESTREAM_s *pByteStream )
 			// Wait 10 seconds before sending this IP the server list again.
 			g_queryIPQueue.addAddress( AddressFrom, g_lCurrentTime, &std::cerr );
 
+			if ( g_bServerListChanged )
+				MASTERSERVER_BuildServerLists( );
+
 			switch ( lCommand )
 			{
 			case LAUNCHER_SERVER_CHALLENGE:
-				// Send the list of servers.
-				g_MessageBuffer.ByteStream.WriteLong( MSC_BEGINSERVERLIST );
-				for( std::set<SERVER_s, SERVERCompFunc>::const_iterator it = g_Servers.begin(); it != g_Servers.end(); ++it )
-				{
-					// [BB] Possibly omit servers that don't enforce our ban list.
-					if ( ( it->bEnforcesBanList == true ) || ( g_bHideBanIgnoringServers == false ) )
-						MASTERSERVER_SendServerIPToLauncher ( it->Address, &g_MessageBuffer.ByteStream );
-				}
-
-				// Tell the launcher that we're done sending servers.
-				g_MessageBuffer.ByteStream.WriteByte( MSC_ENDSERVERLIST );
-
-				// Send the launcher our packet.
-				NETWORK_LaunchPacket( &g_MessageBuffer, AddressFrom );
+				// Send the launcher the list of servers.
+				NETWORK_SendEncodedPacket( g_FullServerList, AddressFrom );
 				return;
 
 			case LAUNCHER_MASTER_CHALLENGE:
-
-				const unsigned long ulMaxPacketSize = 1024;
-				unsigned long ulPacketNum = 0;
-
-				std::set<SERVER_s, SERVERCompFunc>::const_iterator it = g_Servers.begin();
-
-				g_MessageBuffer.ByteStream.WriteLong( MSC_BEGINSERVERLISTPART );
-				g_MessageBuffer.ByteStream.WriteByte( ulPacketNum );
-				g_MessageBuffer.ByteStream.WriteByte( MSC_SERVERBLOCK );
-				unsigned long ulSizeOfPacket = 6; // 4 (MSC_BEGINSERVERLISTPART) + 1 (0) + 1 (MSC_SERVERBLOCK)
-
-				while ( it != g_Servers.end() )
-				{
-					NETADDRESS_s serverAddress = it->Address;
-					std::vector<USHORT> serverPortList;
-
-					do {
-						// [BB] Possibly omit servers that don't enforce our ban list.
-						if ( ( it->bEnforcesBanList == true ) || ( g_bHideBanIgnoringServers == false ) )
-							serverPortList.push_back ( it->Address.usPort );
-						++it;
-					} while ( ( it != g_Servers.end() ) && it->Address.CompareNoPort( serverAddress ) );
-
-					// [BB] All servers on this IP ignore the list, nothing to send.
-					if ( serverPortList.size() == 0 )
-						continue;
-
-					const unsigned long ulServerBlockNetSize = MASTERSERVER_CalcServerIPBlockNetSize( serverAddress, serverPortList );
-
-					// [BB] If sending this block would cause the current packet to exceed ulMaxPacketSize ...
-					if ( ulSizeOfPacket + ulServerBlockNetSize > ulMaxPacketSize - 1 )
-					{
-						// [BB] ... close the current packet and start a new one.
-						g_MessageBuffer.ByteStream.WriteByte( 0 ); // [BB] Terminate MSC_SERVERBLOCK by sending 0 ports.
-						g_MessageBuffer.ByteStream.WriteByte( MSC_ENDSERVERLISTPART );
-						NETWORK_LaunchPacket( &g_MessageBuffer, AddressFrom );
-
-						g_MessageBuffer.Clear();
-						++ulPacketNum;
-						ulSizeOfPacket = 5;
-						g_MessageBuffer.ByteStream.WriteLong( MSC_BEGINSERVERLISTPART );
-						g_MessageBuffer.ByteStream.WriteByte( ulPacketNum );
-						g_MessageBuffer.ByteStream.WriteByte( MSC_SERVERBLOCK );
-					}
-					ulSizeOfPacket += ulServerBlockNetSize;
-					MASTERSERVER_SendServerIPBlockToLauncher ( serverAddress, serverPortList, &g_MessageBuffer.ByteStream );
-				}
-				g_MessageBuffer.ByteStream.WriteByte( 0 ); // [BB] Terminate MSC_SERVERBLOCK by sending 0 ports.
-				g_MessageBuffer.ByteStream.WriteByte( MSC_ENDSERVERLIST );
-				NETWORK_LaunchPacket( &g_MessageBuffer, AddressFrom );
+				for ( unsigned int i = 0; i < g_ServerListParts.size(); ++i )
+					NETWORK_SendEncodedPacket( g_ServerListParts[i], AddressFrom );
 				return;
 			}
 		}
@@ -682,6 +715,9 @@ void MASTERSERVER_CheckTimeouts( std::set<SERVER_s, SERVERCompFunc> &ServerSet )
 		if (( g_lCurrentTime - it->lLastReceived ) >= 60 )
 		{
 			printf( "- %server at %s timed out.\n", ( &ServerSet == &g_UnverifiedServers ) ? "Unverified s" : "S", it->Address.ToString() );
+			if ( &ServerSet == &g_Servers )
+				g_bServerListChanged = true;
+
 			// [BB] The standard does not require set::erase to return the incremented operator,
 			// that's why we must use the post increment operator here.
 			ServerSet.erase ( it++ );
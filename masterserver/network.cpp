@@ -85,6 +85,7 @@ static	UCHAR			g_ucHuffmanBuffer[131072];
 static	void			network_Error( const char *pszError );
 static	SOCKET			network_AllocateSocket( void );
 static	bool			network_BindSocketToPort( SOCKET Socket, ULONG ulInAddr, USHORT usPort, bool bReUse );
+static	void			network_SendPacket( const UCHAR *pucData, int iSize, const NETADDRESS_s &Address );
 
 //*****************************************************************************
 //	FUNCTIONS
@@ -275,7 +276,6 @@ NETADDRESS_s NETWORK_GetFromAddress( void )
 //
 void NETWORK_LaunchPacket( NETBUFFER_s *pBuffer, NETADDRESS_s Address )
 {
-	LONG				lNumBytes;
 	INT					iNumBytesOut = sizeof(g_ucHuffmanBuffer);
 
 	pBuffer->ulCurrentSize = pBuffer->CalcSize();
@@ -284,13 +284,52 @@ void NETWORK_LaunchPacket( NETBUFFER_s *pBuffer, NETADDRESS_s Address )
 	if ( pBuffer->ulCurrentSize == 0 )
 		return;
 
+	HUFFMAN_Encode( (unsigned char *)pBuffer->pbData, g_ucHuffmanBuffer, pBuffer->ulCurrentSize, &iNumBytesOut );
+
+	network_SendPacket( g_ucHuffmanBuffer, iNumBytesOut, Address );
+}
+
+//*****************************************************************************
+//
+// Huffman encodes a packet so that it can be sent several times with NETWORK_SendEncodedPacket.
+//
+void NETWORK_EncodePacket( NETBUFFER_s *pBuffer, std::vector<UCHAR> &Encoded )
+{
+	INT					iNumBytesOut = sizeof(g_ucHuffmanBuffer);
+
+	Encoded.clear();
+	pBuffer->ulCurrentSize = pBuffer->CalcSize();
+
+	// Nothing to do.
+	if ( pBuffer->ulCurrentSize == 0 )
+		return;
+
+	HUFFMAN_Encode( (unsigned char *)pBuffer->pbData, g_ucHuffmanBuffer, pBuffer->ulCurrentSize, &iNumBytesOut );
+	Encoded.assign( g_ucHuffmanBuffer, g_ucHuffmanBuffer + iNumBytesOut );
+}
+
+//*****************************************************************************
+//
+void NETWORK_SendEncodedPacket( const std::vector<UCHAR> &Encoded, NETADDRESS_s Address )
+{
+	// Nothing to do.
+	if ( Encoded.empty() )
+		return;
+
+	network_SendPacket( &Encoded[0], static_cast<int>( Encoded.size() ), Address );
+}
+
+//*****************************************************************************
+//
+static void network_SendPacket( const UCHAR *pucData, int iSize, const NETADDRESS_s &Address )
+{
+	LONG				lNumBytes;
+
 	// Convert the IP address to a socket address.
 	struct sockaddr_in SocketAddress;
 	Address.ToSocketAddress( reinterpret_cast<sockaddr&>(SocketAddress) );
 
-	HUFFMAN_Encode( (unsigned char *)pBuffer->pbData, g_ucHuffmanBuffer, pBuffer->ulCurrentSize, &iNumBytesOut );
-
-	lNumBytes = sendto( g_NetworkSocket, (const char*)g_ucHuffmanBuffer, iNumBytesOut, 0, reinterpret_cast<sockaddr*>(&SocketAddress), sizeof( SocketAddress ));
+	lNumBytes = sendto( g_NetworkSocket, (const char*)pucData, iSize, 0, reinterpret_cast<sockaddr*>(&SocketAddress), sizeof( SocketAddress ));
 
 	// If sendto returns -1, there was an error.
 	if ( lNumBytes == -1 )
@@ -306,19 +345,19 @@ void NETWORK_LaunchPacket( NETBUFFER_s *pBuffer, NETADDRESS_s Address )
 		{
 		case WSAEACCES:
 
-			printf( "NETWORK_LaunchPacket: Error #%d, WSAEACCES: Permission denied for address: %s\n", iError, Address.ToString() );
+			printf( "network_SendPacket: Error #%d, WSAEACCES: Permission denied for address: %s\n", iError, Address.ToString() );
 			return;
 		case WSAEADDRNOTAVAIL:
 
-			printf( "NETWORK_LaunchPacket: Error #%d, WSAEADDRENOTAVAIL: Address %s not available\n", iError, Address.ToString() );
+			printf( "network_SendPacket: Error #%d, WSAEADDRENOTAVAIL: Address %s not available\n", iError, Address.ToString() );
 			return;
 		case WSAEHOSTUNREACH:
 
-			printf( "NETWORK_LaunchPacket: Error #%d, WSAEHOSTUNREACH: Address %s unreachable\n", iError, Address.ToString() );
+			printf( "network_SendPacket: Error #%d, WSAEHOSTUNREACH: Address %s unreachable\n", iError, Address.ToString() );
 			return;				
 		default:
 
-			printf( "NETWORK_LaunchPacket: Error #%d\n", iError );
+			printf( "network_SendPacket: Error #%d\n", iError );
 			return;
 		}
 #else
@@ -328,8 +367,8 @@ return;
           if ( errno == ECONNREFUSED )
               return;
 
-		printf( "NETWORK_LaunchPacket: %s\n", strerror( errno ));
-		printf( "NETWORK_LaunchPacket: Address %s\n", Address.ToString() );
+		printf( "network_SendPacket: %s\n", strerror( errno ));
+		printf( "network_SendPacket: Address %s\n", Address.ToString() );
 
 #endif
 	}
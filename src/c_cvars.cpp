@@ -70,6 +70,7 @@
 #include "gi.h"
 #include "gameconfigfile.h"
 #include "scoreboard.h"
+#include "sv_main.h"
 
 struct FLatchedValue
 {
@@ -345,6 +346,10 @@ void FBaseCVar::SetGenericRep (UCVarValue value, ECVarType type)
 	// [TP] Inform RCON clients about server setting changes
 	if (( NETWORK_GetState() == NETSTATE_SERVER ) && ( Flags & ( CVAR_SENSITIVESERVERSETTING | CVAR_SERVERINFO )))
 		SERVERCOMMANDS_SyncCVarToAdmins( *this );
+
+	// The launcher responses may contain this setting.
+	if ( NETWORK_GetState() == NETSTATE_SERVER )
+		SERVER_MASTER_InvalidateServerInfo( );
 }
 
 bool FBaseCVar::ToBool (UCVarValue value, ECVarType type)
@@ -896,3 +896,22 @@ void CLIENTCOMMANDS_RCONSetCVar( const char *cvarName, const char *cvarValue )
 	CLIENT_GetLocalBuffer( )->ByteStream.WriteString( cvarName );
 	CLIENT_GetLocalBuffer( )->ByteStream.WriteString( cvarValue );
 }
+
+//*****************************************************************************
+//
+// acks holds the entries for ulNumAcks players, see CLIENT_SendCmd.
+void CLIENTCOMMANDS_AckMoveSnapshots( ULONG ulNumAcks, const TArray<BYTE> &acks )
+{
+	CLIENT_GetLocalBuffer( )->ByteStream.WriteByte( CLC_ACKMOVESNAPSHOTS );
+	CLIENT_GetLocalBuffer( )->ByteStream.WriteByte( ulNumAcks );
+
+	for ( unsigned int i = 0; i < acks.Size( ); i++ )
+		CLIENT_GetLocalBuffer( )->ByteStream.WriteByte( acks[i] );
+}
+
+//*****************************************************************************
+//
+void CLIENTCOMMANDS_RequestDemoKeyframe( void )
+{
+	CLIENT_GetLocalBuffer( )->ByteStream.WriteByte( CLC_REQUESTDEMOKEYFRAME );
+}
@@ -115,5 +115,7 @@ void	CLIENTCOMMANDS_SpecialCheat( int special, const TArray<int>& args );
 void	CLIENTCOMMANDS_SetWantHideAccount( bool wantHideCountry );
 void	CLIENTCOMMANDS_SetVideoResolution();
 void	CLIENTCOMMANDS_RCONSetCVar( const char *cvarName, const char *cvarValue );
+void	CLIENTCOMMANDS_AckMoveSnapshots( ULONG ulNumAcks, const TArray<BYTE> &acks );
+void	CLIENTCOMMANDS_RequestDemoKeyframe( void );
 
 #endif	// __CL_COMMANDS_H__
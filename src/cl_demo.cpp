@@ -50,6 +50,7 @@
 
 #include "c_console.h"
 #include "c_dispatch.h"
+#include "cl_commands.h"
 #include "cl_demo.h"
 #include "cl_main.h"
 #include "cmdlib.h"
@@ -74,30 +75,38 @@
 #include "r_data/r_translate.h"
 #include "m_cheat.h"
 #include "network_enums.h"
+#include "network/demowriter.h"
+#include <zlib.h>
 
 //*****************************************************************************
-enum 
-{
-	// [BC] Message headers with bytes starting with 0 and going sequentially
-	// isn't very distinguishing from other formats (such as normal ZDoom demos),
-	// but does that matter?
-	CLD_DEMOLENGTH = NUM_SERVER_COMMANDS,
-	CLD_DEMOVERSION,
-	CLD_CVARS,
-	CLD_USERINFO,
-	CLD_BODYSTART,
-	CLD_TICCMD,
-	CLD_LOCALCOMMAND, // [Dusk]
-	CLD_DEMOEND,
-	CLD_DEMOWADS, // [Dusk]
-
-	NUM_DEMO_COMMANDS
-};
+//	DEFINES
+
+// The body of the demo is written to the file in chunks once this many bytes are
+// buffered, or once this many tics have passed, so that a crash loses little of it.
+#define	DEMO_CHUNKSIZE		0x10000
+#define	DEMO_FLUSHTICS		TICRATE
+
+// Chunks that claim to be bigger than this are considered garbage.
+#define	DEMO_MAXCHUNKSIZE	0x4000000
+
+// zlib can't compress anything to less than 1/1032 of its size, and the body of a
+// demo is never put together to more than this many bytes.
+#define	DEMO_MAXDEFLATERATIO	1032
+#define	DEMO_MAXBODYLENGTH		0x40000000
 
 //*****************************************************************************
 //	PROTOTYPES
 
 static	void				clientdemo_CheckDemoBuffer( ULONG ulSize );
+static	void				clientdemo_FlushDemoBuffer( void );
+static	void				clientdemo_ReadChunks( LONG lFileLength );
+static	void				clientdemo_SetDemoEnd( void );
+static	void				clientdemo_ReadIndex( LONG lBufferLength );
+static	void				clientdemo_AddKeyframe( unsigned int tic, LONG lOffset );
+static	void				clientdemo_ApplyKeyframe( BYTESTREAM_s *pByteStream );
+static	void				clientdemo_Rewind( void );
+static	void				clientdemo_JumpToKeyframe( const DEMOKEYFRAME_s &Keyframe );
+static	void				clientdemo_SkipTo( unsigned int ticPosition );
 
 //*****************************************************************************
 //	VARIABLES
@@ -133,6 +142,21 @@ static	FString				g_DemoName;
 // Length of the demo.
 static	LONG				g_lDemoLength;
 
+// Length of the demo buffer, including the index that follows the demo.
+static	LONG				g_lDemoBufferLength;
+
+// Number of bytes of the demo we are recording that have already been handed to the writer.
+static	LONG				g_lFlushedDemoLength;
+
+// Value of g_TicsRecorded when we last flushed the demo buffer.
+static	unsigned int		g_FlushedTics;
+
+// Is the body of the demo we are playing split into chunks?
+static	bool				g_bDemoChunks;
+
+// Writes the demo we are recording to its file.
+static	DemoWriter			g_DemoWriter;
+
 // This is the gametic we started playing the demo on.
 static	LONG				g_lGameticOffset;
 
@@ -147,6 +171,32 @@ static	const DWORD			g_demoSignature = MAKE_ID( 'Z', 'C', 'L', 'D' );
 
 static	unsigned int		g_TicsPlayedBack = 0;
 
+// Number of tics written to the demo we are recording.
+static	unsigned int		g_TicsRecorded = 0;
+
+// The keyframes of the demo, in ascending order. Since the server sends a full update
+// after every map load, and a snapshot of the level is the same thing, playback can
+// start over from these points without needing anything the tics before them did.
+static	TArray<DEMOKEYFRAME_s>	g_DemoKeyframes;
+
+// While fewer tics than this have been played back, they are skipped without running
+// them, because the map load at this keyframe replaces the level anyway.
+static	unsigned int		g_SkipToKeyframe = 0;
+
+// Set when playback jumped to a CLD_KEYFRAME, whose snapshot needs to be applied then.
+static	bool				g_bApplyKeyframe = false;
+
+// The pieces of the snapshot the server sent us so far, see CLIENTDEMO_AddKeyframePiece.
+// The snapshot was taken where the first piece arrived, that's where playback goes on
+// after applying it.
+static	TArray<BYTE>		g_KeyframeData;
+static	bool				g_bReceivingKeyframe = false;
+static	LONG				g_lKeyframeResumeOffset = 0;
+static	unsigned int		g_KeyframeResumeTic = 0;
+
+// Value of g_TicsRecorded when we last got a keyframe or asked the server for one.
+static	unsigned int		g_LastKeyframeTic = 0;
+
 // [Dusk] Should we perform demo authentication?
 CUSTOM_CVAR( Bool, demo_pure, true, CVAR_ARCHIVE | CVAR_GLOBALCONFIG )
 {
@@ -158,6 +208,13 @@ CUSTOM_CVAR( Bool, demo_pure, true, CVAR_ARCHIVE | CVAR_GLOBALCONFIG )
 		"Demos may get played back with completely incorrect WADs!" TEXTCOLOR_NORMAL "\n" );
 }
 
+// Compress the demos we record with zlib (defined in g_game.cpp).
+EXTERN_CVAR( Bool, demo_compress )
+
+// Every this many seconds, ask the server for a snapshot of the level to store in the
+// demo we are recording, so that playback can jump close to any position.
+CVAR( Int, demo_keyframeinterval, 30, CVAR_ARCHIVE | CVAR_GLOBALCONFIG )
+
 //*****************************************************************************
 //	FUNCTIONS
 
@@ -177,40 +234,82 @@ void CLIENTDEMO_BeginRecording( const char *pszDemoName )
 	g_pbDemoBuffer = (BYTE *)M_Malloc( g_lMaxDemoLength );
 	g_ByteStream.pbStream = g_pbDemoBuffer;
 	g_ByteStream.pbStreamEnd = g_pbDemoBuffer + g_lMaxDemoLength;
+	g_pbMarkedStreamPosition = g_pbDemoBuffer;
+	g_lFlushedDemoLength = 0;
+	g_TicsRecorded = 0;
+	g_FlushedTics = 0;
+	g_DemoKeyframes.Clear( );
+	g_KeyframeData.Clear( );
+	g_bReceivingKeyframe = false;
+	g_LastKeyframeTic = 0;
 
 	// Write our header.
+	CLIENTDEMO_WriteHeader( &g_ByteStream );
+
+	// Write the console player's userinfo.
+	CLIENTDEMO_WriteUserInfo( );
+
+	// The body is written in chunks while we record.
+	clientdemo_CheckDemoBuffer( 2 );
+	g_ByteStream.WriteByte( CLD_DEMOCHUNKS );
+
+	// Indicate that we're done with header information, and are ready
+	// to move onto the body of the demo.
+	g_ByteStream.WriteByte( CLD_BODYSTART );
+
+	// Write the header to the file right away, the body follows while we play.
+	g_lFlushedDemoLength = g_ByteStream.pbStream - g_pbDemoBuffer;
+	g_ByteStream.pbStream = g_pbDemoBuffer;
+	g_pbMarkedStreamPosition = g_pbDemoBuffer;
+	if ( g_DemoWriter.Open( g_DemoName.GetChars(), g_pbDemoBuffer, g_lFlushedDemoLength, demo_compress ) == false )
+	{
+		Printf( "Couldn't open \"%s\" for writing. The demo won't be recorded.\n", g_DemoName.GetChars() );
+		M_Free( g_pbDemoBuffer );
+		g_pbDemoBuffer = NULL;
+		g_bDemoRecording = false;
+	}
+
+	CLIENT_SetServerLagging( false );
+}
+
+//*****************************************************************************
+//
+// Writes everything up to the userinfo, which the demo that is recorded by a server
+// doesn't have. The buffer must be large enough for it.
+void CLIENTDEMO_WriteHeader( BYTESTREAM_s *pByteStream )
+{
 	// [Dusk] Write a static "ZCLD" which is consistent between
 	// different Zandronum versions.
-	g_ByteStream.WriteLong( g_demoSignature );
+	pByteStream->WriteLong( g_demoSignature );
 
 	// Write the length of the demo. Of course, we can't complete this quite yet!
-	g_ByteStream.WriteByte( CLD_DEMOLENGTH );
-	g_ByteStream.pbStream += 4;
+	pByteStream->WriteByte( CLD_DEMOLENGTH );
+	pByteStream->pbStream += 4;
 
 	// Write version information helpful for this demo.
-	g_ByteStream.WriteByte( CLD_DEMOVERSION );
-	g_ByteStream.WriteShort( DEMOGAMEVERSION );
-	g_ByteStream.WriteString( GetVersionStringRev() );
-	g_ByteStream.WriteByte( BUILD_ID );
-	g_ByteStream.WriteLong( rngseed );
+	pByteStream->WriteByte( CLD_DEMOVERSION );
+	pByteStream->WriteShort( DEMOGAMEVERSION );
+	pByteStream->WriteString( GetVersionStringRev() );
+	pByteStream->WriteByte( BUILD_ID );
+	pByteStream->WriteLong( rngseed );
 
 	// [Dusk] Write the amount of WADs and their names, incl. IWAD
-	g_ByteStream.WriteByte( CLD_DEMOWADS );
+	pByteStream->WriteByte( CLD_DEMOWADS );
 	ULONG ulWADCount = 1 + NETWORK_GetPWADList().Size( ); // 1 for IWAD
-	g_ByteStream.WriteShort( ulWADCount );
-	g_ByteStream.WriteString( NETWORK_GetIWAD ( ) );
+	pByteStream->WriteShort( ulWADCount );
+	pByteStream->WriteString( NETWORK_GetIWAD ( ) );
 
 	for ( unsigned int i = 0; i < NETWORK_GetPWADList().Size(); ++i )
-		g_ByteStream.WriteString( NETWORK_GetPWADList()[i].name );
+		pByteStream->WriteString( NETWORK_GetPWADList()[i].name );
 
 	// [Dusk] Write the network authentication string, we need it to
 	// ensure we have the right WADs loaded.
-	g_ByteStream.WriteString( g_lumpsAuthenticationChecksum.GetChars( ) );
+	pByteStream->WriteString( g_lumpsAuthenticationChecksum.GetChars( ) );
 
 	// [Dusk] Also generate and write the map collection checksum so we can
 	// authenticate the maps.
 	NETWORK_MakeMapCollectionChecksum( );
-	g_ByteStream.WriteString( g_MapCollectionChecksum.GetChars( ) );
+	pByteStream->WriteString( g_MapCollectionChecksum.GetChars( ) );
 
 /*
 	// Write cvars chunk.
@@ -218,14 +317,6 @@ void CLIENTDEMO_BeginRecording( const char *pszDemoName )
 	C_WriteCVars( &g_pbDemoBuffer, CVAR_SERVERINFO|CVAR_DEMOSAVE );
 	FinishChunk( &g_pbDemoBuffer );
 */
-	// Write the console player's userinfo.
-	CLIENTDEMO_WriteUserInfo( );
-
-	// Indicate that we're done with header information, and are ready
-	// to move onto the body of the demo.
-	g_ByteStream.WriteByte( CLD_BODYSTART );
-
-	CLIENT_SetServerLagging( false );
 }
 
 //*****************************************************************************
@@ -263,8 +354,10 @@ bool CLIENTDEMO_ProcessDemoHeader( void )
 		return ( false );
 	}
 
+	// The end of the stream is set once the header is read, since the length
+	// doesn't cover all of the file when the body is split into chunks.
 	g_lDemoLength = g_ByteStream.ReadLong();
-	g_ByteStream.pbStreamEnd = g_pbDemoBuffer + g_lDemoLength + ( g_lDemoLength & 1 );
+	g_bDemoChunks = false;
 
 	// Continue to read header commands until we reach the body of the demo.
 	bBodyStart = false;
@@ -319,6 +412,11 @@ bool CLIENTDEMO_ProcessDemoHeader( void )
 			CLIENTDEMO_ReadDemoWads( );
 			break;
 
+		case CLD_DEMOCHUNKS:
+
+			g_bDemoChunks = true;
+			break;
+
 		// [Dusk] Bad headers shouldn't just be ignored, that's just asking for trouble.
 		default:
 			I_Error( "Unknown demo header %ld!\n", lCommand );
@@ -405,6 +503,7 @@ void CLIENTDEMO_WriteTiccmd( ticcmd_t *pCmd )
 
 	// Write the header.
 	g_ByteStream.WriteByte( CLD_TICCMD );
+	++g_TicsRecorded;
 
 	// Write the contents of the ticcmd.
 	g_ByteStream.WriteShort( pCmd->ucmd.yaw );
@@ -414,6 +513,19 @@ void CLIENTDEMO_WriteTiccmd( ticcmd_t *pCmd )
 	g_ByteStream.WriteShort( pCmd->ucmd.upmove );
 	g_ByteStream.WriteShort( pCmd->ucmd.forwardmove );
 	g_ByteStream.WriteShort( pCmd->ucmd.sidemove );
+
+	// Ask the server for a keyframe when it's time, it answers with SVC2_DEMOKEYFRAME.
+	if (( demo_keyframeinterval > 0 ) && ( g_TicsRecorded - g_LastKeyframeTic >= static_cast<unsigned int>( demo_keyframeinterval * TICRATE ))
+		&& ( CLIENT_GetConnectionState( ) == CTS_ACTIVE ) && ( CLIENT_GetFullUpdateIncomplete( ) == false ))
+	{
+		CLIENTCOMMANDS_RequestDemoKeyframe( );
+		g_LastKeyframeTic = g_TicsRecorded;
+	}
+
+	// Between two tics we are not in the middle of parsing a packet, so nothing
+	// refers to the buffered part of the demo and it can be handed to the writer.
+	if (( g_ByteStream.pbStream - g_pbDemoBuffer >= DEMO_CHUNKSIZE ) || ( g_TicsRecorded - g_FlushedTics >= DEMO_FLUSHTICS ))
+		clientdemo_FlushDemoBuffer( );
 }
 
 //*****************************************************************************
@@ -483,6 +595,89 @@ void CLIENTDEMO_MarkCurrentPosition( void )
 	g_pbMarkedStreamPosition = CLIENTDEMO_GetDemoStream()->pbStream;
 }
 
+//*****************************************************************************
+//
+void CLIENTDEMO_AddKeyframe( void )
+{
+	if ( CLIENTDEMO_IsRecording( ))
+	{
+		// The server doesn't finish a snapshot of the last level.
+		g_KeyframeData.Clear( );
+		g_bReceivingKeyframe = false;
+		clientdemo_AddKeyframe( g_TicsRecorded, -1 );
+	}
+	else if ( CLIENTDEMO_IsPlaying( ))
+		clientdemo_AddKeyframe( g_TicsPlayedBack, -1 );
+}
+
+//*****************************************************************************
+//
+// Collects the pieces of the snapshot of the level the server sends for
+// CLC_REQUESTDEMOKEYFRAME, and stores it as a whole once it's complete.
+// Returns true if it did.
+bool CLIENTDEMO_AddKeyframePiece( const BYTE *pbData, ULONG ulLength, ULONG ulFlags )
+{
+	if ( CLIENTDEMO_IsRecording( ) == false )
+		return ( false );
+
+	// The server took the snapshot right before it sent the first piece, so what we
+	// recorded since belongs after it.
+	if ( ulFlags & DEMOKEYFRAME_FIRSTPIECE )
+	{
+		g_KeyframeData.Clear( );
+		g_bReceivingKeyframe = true;
+		g_lKeyframeResumeOffset = g_lFlushedDemoLength + ( g_ByteStream.pbStream - g_pbDemoBuffer );
+		g_KeyframeResumeTic = g_TicsRecorded;
+	}
+
+	if ( g_bReceivingKeyframe == false )
+		return ( false );
+
+	const unsigned int uPosition = g_KeyframeData.Size( );
+	g_KeyframeData.Resize( uPosition + ulLength );
+	memcpy( &g_KeyframeData[uPosition], pbData, ulLength );
+
+	if (( ulFlags & DEMOKEYFRAME_LASTPIECE ) == 0 )
+		return ( false );
+
+	clientdemo_CheckDemoBuffer( 13 + g_KeyframeData.Size( ));
+	const LONG lOffset = g_lFlushedDemoLength + ( g_ByteStream.pbStream - g_pbDemoBuffer );
+	CLIENTDEMO_WriteKeyframe( &g_ByteStream, g_KeyframeData, g_lKeyframeResumeOffset, g_KeyframeResumeTic );
+	g_KeyframeData.Clear( );
+	g_bReceivingKeyframe = false;
+
+	clientdemo_AddKeyframe( g_KeyframeResumeTic, lOffset );
+	return ( true );
+}
+
+//*****************************************************************************
+//
+// Writes a snapshot of the level as a CLD_KEYFRAME. After applying it, playback goes
+// on at lResumeOffset, where the snapshot was taken. The buffer must be large enough.
+void CLIENTDEMO_WriteKeyframe( BYTESTREAM_s *pByteStream, const TArray<BYTE> &Snapshot, LONG lResumeOffset, unsigned int resumeTic )
+{
+	pByteStream->WriteByte( CLD_KEYFRAME );
+	pByteStream->WriteLong( Snapshot.Size( ));
+	pByteStream->WriteLong( lResumeOffset );
+	pByteStream->WriteLong( resumeTic );
+	if ( Snapshot.Size( ) > 0 )
+		pByteStream->WriteBuffer( &Snapshot[0], Snapshot.Size( ));
+}
+
+//*****************************************************************************
+//
+// Writes the keyframe index that follows the demo. The buffer must be large enough for it.
+void CLIENTDEMO_WriteIndex( BYTESTREAM_s *pByteStream, const TArray<DEMOKEYFRAME_s> &Keyframes )
+{
+	pByteStream->WriteByte( CLD_DEMOINDEX );
+	pByteStream->WriteLong( Keyframes.Size( ));
+	for ( unsigned int i = 0; i < Keyframes.Size( ); ++i )
+	{
+		pByteStream->WriteLong( Keyframes[i].tic );
+		pByteStream->WriteLong( Keyframes[i].lOffset );
+	}
+}
+
 //*****************************************************************************
 //
 void CLIENTDEMO_ReadPacket( void )
@@ -517,6 +712,13 @@ void CLIENTDEMO_ReadPacket( void )
 			CLIENTDEMO_ReadTiccmd( &players[consoleplayer].cmd );
 			++g_TicsPlayedBack;
 
+			// The tics before the keyframe we're skipping to don't need to be run.
+			if ( g_TicsPlayedBack <= g_SkipToKeyframe )
+			{
+				g_lGameticOffset--;
+				break;
+			}
+
 			// After we write our ticcmd, we're done for this tic.
 			if ( CLIENTDEMO_IsSkipping() == false )
 				return;
@@ -575,6 +777,44 @@ void CLIENTDEMO_ReadPacket( void )
 				break;
 			}
 			break;
+		case CLD_KEYFRAME:
+
+			{
+				const LONG lOffset = ( g_ByteStream.pbStream - 1 ) - g_pbDemoBuffer;
+				const LONG lSize = g_ByteStream.ReadLong();
+				const LONG lResumeOffset = g_ByteStream.ReadLong();
+				const unsigned int resumeTic = g_ByteStream.ReadLong();
+
+				if (( lSize < 0 ) || ( lSize > g_ByteStream.pbStreamEnd - g_ByteStream.pbStream )
+					|| ( lResumeOffset < 0 ) || ( lResumeOffset > lOffset ) || ( resumeTic > g_TicsPlayedBack ))
+				{
+					CLIENTDEMO_FinishPlaying( );
+					return;
+				}
+
+				BYTESTREAM_s Keyframe;
+				Keyframe.pbStream = g_ByteStream.pbStream;
+				Keyframe.pbStreamEnd = g_ByteStream.pbStream + lSize;
+				g_ByteStream.pbStream += lSize;
+
+				// Unless we jumped here, the level already is what the snapshot has. Otherwise,
+				// go on with what happened after the snapshot was taken. We pass the snapshot
+				// again on the way.
+				if ( g_bApplyKeyframe )
+				{
+					g_bApplyKeyframe = false;
+					clientdemo_ApplyKeyframe( &Keyframe );
+					g_ByteStream.pbStream = g_pbDemoBuffer + lResumeOffset;
+				}
+				else
+				{
+					clientdemo_AddKeyframe( resumeTic, lOffset );
+
+					// The recorder forgot the movement baselines when it got the snapshot.
+					CLIENT_ResetMoveSnapshots( );
+				}
+			}
+			break;
 		case CLD_DEMOEND:
 
 			CLIENTDEMO_FinishPlaying( );
@@ -596,28 +836,33 @@ void CLIENTDEMO_ReadPacket( void )
 void CLIENTDEMO_FinishRecording( void )
 {
 	LONG			lDemoLength;
-	BYTESTREAM_s	ByteStream;
 
 	// Write our header.
+	clientdemo_CheckDemoBuffer( 1 );
 	g_ByteStream.WriteByte( CLD_DEMOEND );
+	lDemoLength = g_lFlushedDemoLength + ( g_ByteStream.pbStream - g_pbDemoBuffer );
 
-	// Go back real quick and write the length of this demo.
-	lDemoLength = g_ByteStream.pbStream - g_pbDemoBuffer;
-	ByteStream.pbStream = g_pbDemoBuffer + 5;
-	ByteStream.pbStreamEnd = g_ByteStream.pbStreamEnd;
-	ByteStream.WriteLong( lDemoLength );
+	// Append the keyframe index. It's not part of the demo's length, so that versions
+	// that don't know about it just stop reading before it.
+	clientdemo_CheckDemoBuffer( 5 + g_DemoKeyframes.Size( ) * 8 );
+	CLIENTDEMO_WriteIndex( &g_ByteStream, g_DemoKeyframes );
+	g_KeyframeData.Clear( );
+	g_bReceivingKeyframe = false;
 
-	// Write the contents of the buffer to the file, and free the memory we
-	// allocated for the demo.
-	M_WriteFile( g_DemoName.GetChars(), g_pbDemoBuffer, lDemoLength ); 
+	// Write the rest of the demo to the file, and free the memory we allocated for it.
+	clientdemo_FlushDemoBuffer( );
 	M_Free( g_pbDemoBuffer );
 	g_pbDemoBuffer = NULL;
 
 	// We're no longer recording a demo.
 	g_bDemoRecording = false;
 
+	// Once the writer is done, it goes back real quick and writes the length of this demo.
 	// All done!
-	Printf( "Demo \"%s\" successfully recorded!\n", g_DemoName.GetChars() ); 
+	if ( g_DemoWriter.Close( lDemoLength ))
+		Printf( "Demo \"%s\" successfully recorded!\n", g_DemoName.GetChars() ); 
+	else
+		Printf( "Couldn't write demo \"%s\"!\n", g_DemoName.GetChars() );
 }
 
 //*****************************************************************************
@@ -647,10 +892,19 @@ void CLIENTDEMO_DoPlayDemo( const char *pszDemoName )
 
 	g_ByteStream.pbStream = g_pbDemoBuffer;
 	g_ByteStream.pbStreamEnd = g_pbDemoBuffer + lDemoLength;
+	g_lDemoBufferLength = lDemoLength;
 	g_TicsPlayedBack = 0;
+	g_SkipToKeyframe = 0;
+	g_bApplyKeyframe = false;
+	g_DemoKeyframes.Clear( );
 
 	if ( CLIENTDEMO_ProcessDemoHeader( ))
 	{
+		if ( g_bDemoChunks )
+			clientdemo_ReadChunks( lDemoLength );
+		clientdemo_SetDemoEnd( );
+		clientdemo_ReadIndex( g_lDemoBufferLength );
+
 		C_HideConsole( );
 		g_bDemoPlaying = true;
 		g_bDemoPlayingHonest = true;
@@ -680,6 +934,9 @@ void CLIENTDEMO_FinishPlaying( void )
 	g_bDemoPlayingHonest = false;
 	CLIENTDEMO_SetSkippingToNextMap ( false );
 	g_ulTicsToSkip = 0;
+	g_SkipToKeyframe = 0;
+	g_bApplyKeyframe = false;
+	g_DemoKeyframes.Clear( );
 
 	// Clear out the existing players.
 	CLIENT_ClearAllPlayers();
@@ -810,7 +1067,7 @@ bool CLIENTDEMO_IsPaused( void )
 //
 bool CLIENTDEMO_IsSkipping( void )
 {
-	return ( g_ulTicsToSkip > 0 ) || CLIENTDEMO_IsSkippingToNextMap();
+	return ( g_ulTicsToSkip > 0 ) || ( g_TicsPlayedBack < g_SkipToKeyframe ) || CLIENTDEMO_IsSkippingToNextMap();
 }
 
 //*****************************************************************************
@@ -1003,6 +1260,276 @@ static void clientdemo_CheckDemoBuffer( ULONG ulSize )
 	}
 }
 
+//*****************************************************************************
+//
+static void clientdemo_FlushDemoBuffer( void )
+{
+	const ULONG ulSize = g_ByteStream.pbStream - g_pbDemoBuffer;
+
+	g_FlushedTics = g_TicsRecorded;
+	g_DemoWriter.Write( g_pbDemoBuffer, ulSize );
+
+	// Start over at the beginning of the buffer.
+	g_lFlushedDemoLength += ulSize;
+	g_ByteStream.pbStream = g_pbDemoBuffer;
+	g_pbMarkedStreamPosition = g_pbDemoBuffer;
+}
+
+//*****************************************************************************
+//
+// Replaces the demo buffer with one in which the chunks following the header are
+// put together again. A chunk that is cut off or damaged ends the demo there.
+static void clientdemo_ReadChunks( LONG lFileLength )
+{
+	const LONG		lHeaderLength = g_ByteStream.pbStream - g_pbDemoBuffer;
+	BYTESTREAM_s	ByteStream;
+	SQWORD			qwBodyLength = 0;
+	LONG			lBufferLength;
+	LONG			lPosition;
+
+	// First find out how much space the complete chunks need.
+	ByteStream.pbStream = g_ByteStream.pbStream;
+	ByteStream.pbStreamEnd = g_pbDemoBuffer + lFileLength;
+	while ( ByteStream.pbStreamEnd - ByteStream.pbStream >= 8 )
+	{
+		const LONG lSize = ByteStream.ReadLong();
+		const LONG lStoredSize = ByteStream.ReadLong();
+
+		// A chunk can't inflate to more than zlib allows, which also limits the
+		// body to a multiple of the file's size.
+		if (( lSize <= 0 ) || ( lSize > DEMO_MAXCHUNKSIZE ) || ( lStoredSize <= 0 ) || ( lStoredSize > lSize )
+			|| ( lStoredSize > ByteStream.pbStreamEnd - ByteStream.pbStream )
+			|| ( static_cast<SQWORD>( lSize ) > static_cast<SQWORD>( lStoredSize ) * DEMO_MAXDEFLATERATIO )
+			|| ( qwBodyLength + lSize > DEMO_MAXBODYLENGTH ))
+		{
+			break;
+		}
+
+		ByteStream.pbStream += lStoredSize;
+		qwBodyLength += lSize;
+	}
+
+	lBufferLength = lHeaderLength + static_cast<LONG>( qwBodyLength );
+	BYTE *pbBuffer = new BYTE[lBufferLength];
+	memcpy( pbBuffer, g_pbDemoBuffer, lHeaderLength );
+
+	// Now put them together.
+	ByteStream.pbStream = g_ByteStream.pbStream;
+	for ( lPosition = lHeaderLength; lPosition < lBufferLength; )
+	{
+		if ( ByteStream.pbStreamEnd - ByteStream.pbStream < 8 )
+			break;
+
+		const LONG lSize = ByteStream.ReadLong();
+		const LONG lStoredSize = ByteStream.ReadLong();
+
+		if (( lSize <= 0 ) || ( lSize > lBufferLength - lPosition ) || ( lStoredSize <= 0 ) || ( lStoredSize > lSize )
+			|| ( lStoredSize > ByteStream.pbStreamEnd - ByteStream.pbStream ))
+		{
+			break;
+		}
+
+		if ( lStoredSize == lSize )
+			memcpy( pbBuffer + lPosition, ByteStream.pbStream, lSize );
+		else
+		{
+			uLongf size = lSize;
+			if (( uncompress( pbBuffer + lPosition, &size, ByteStream.pbStream, lStoredSize ) != Z_OK ) || ( size != static_cast<uLongf>( lSize )))
+				break;
+		}
+
+		ByteStream.pbStream += lStoredSize;
+		lPosition += lSize;
+	}
+
+	delete[] g_pbDemoBuffer;
+	g_pbDemoBuffer = pbBuffer;
+	g_ByteStream.pbStream = g_pbDemoBuffer + lHeaderLength;
+	g_lDemoBufferLength = lPosition;
+}
+
+//*****************************************************************************
+//
+static void clientdemo_SetDemoEnd( void )
+{
+	// A demo whose recording was cut short, e.g. by a crash, has no length yet,
+	// or is missing some of it. Play back as much of it as we have.
+	if (( g_lDemoLength <= 0 ) || ( g_lDemoLength > g_lDemoBufferLength ))
+	{
+		Printf( "This demo was not finished properly. Playing it back as far as it was saved.\n" );
+		g_lDemoLength = g_lDemoBufferLength;
+	}
+
+	g_ByteStream.pbStreamEnd = g_pbDemoBuffer + MIN( g_lDemoLength + ( g_lDemoLength & 1 ), g_lDemoBufferLength );
+}
+
+//*****************************************************************************
+//
+static void clientdemo_ReadIndex( LONG lBufferLength )
+{
+	// Demos recorded by older versions don't have an index. Their keyframes are
+	// collected while they are played back instead.
+	if ( lBufferLength - g_lDemoLength < 5 )
+		return;
+
+	BYTESTREAM_s	ByteStream;
+	ByteStream.pbStream = g_pbDemoBuffer + g_lDemoLength;
+	ByteStream.pbStreamEnd = g_pbDemoBuffer + lBufferLength;
+
+	if ( ByteStream.ReadByte() != CLD_DEMOINDEX )
+		return;
+
+	const ULONG ulNumKeyframes = ByteStream.ReadLong();
+	if ( ulNumKeyframes > static_cast<ULONG>( lBufferLength - g_lDemoLength - 5 ) / 8 )
+		return;
+
+	for ( ULONG ulIdx = 0; ulIdx < ulNumKeyframes; ulIdx++ )
+	{
+		DEMOKEYFRAME_s Keyframe;
+		Keyframe.tic = ByteStream.ReadLong();
+		Keyframe.lOffset = ByteStream.ReadLong();
+
+		// The keyframes need to be in order, and snapshots must be where the index says.
+		const DEMOKEYFRAME_s *pLast = ( g_DemoKeyframes.Size( ) > 0 ) ? &g_DemoKeyframes[g_DemoKeyframes.Size( ) - 1] : NULL;
+		if ((( pLast != NULL ) && (( Keyframe.tic < pLast->tic ) || (( Keyframe.tic == pLast->tic ) && ( Keyframe.lOffset <= pLast->lOffset ))))
+			|| (( Keyframe.lOffset != -1 ) && (( Keyframe.lOffset < 0 ) || ( Keyframe.lOffset >= g_lDemoLength ) || ( g_pbDemoBuffer[Keyframe.lOffset] != CLD_KEYFRAME ))))
+		{
+			Printf( "The keyframe index of this demo is damaged and will be ignored.\n" );
+			g_DemoKeyframes.Clear( );
+			return;
+		}
+
+		g_DemoKeyframes.Push( Keyframe );
+	}
+}
+
+//*****************************************************************************
+//
+static void clientdemo_AddKeyframe( unsigned int tic, LONG lOffset )
+{
+	// When playing back, we already know the keyframes up to the furthest point
+	// we have been to, either from the index or from playing there before.
+	if ( g_DemoKeyframes.Size( ) > 0 )
+	{
+		const DEMOKEYFRAME_s &Last = g_DemoKeyframes[g_DemoKeyframes.Size( ) - 1];
+		if (( tic < Last.tic ) || (( tic == Last.tic ) && ( lOffset <= Last.lOffset )))
+			return;
+	}
+
+	DEMOKEYFRAME_s Keyframe;
+	Keyframe.tic = tic;
+	Keyframe.lOffset = lOffset;
+	g_DemoKeyframes.Push( Keyframe );
+
+	if ( CLIENTDEMO_IsRecording( ))
+		g_LastKeyframeTic = tic;
+}
+
+//*****************************************************************************
+//
+// Starts over from the snapshot of a CLD_KEYFRAME, which loads the level again.
+static void clientdemo_ApplyKeyframe( BYTESTREAM_s *pByteStream )
+{
+	// Nobody is in the game until the snapshot says so.
+	CLIENT_ClearAllPlayers();
+	CLIENTDEMO_ClearFreeSpectatorPlayer();
+	players[consoleplayer].camera = NULL;
+
+	while ( 1 )
+	{
+		const LONG lCommand = pByteStream->ReadByte();
+
+		pByteStream->bitBuffer = NULL;
+		pByteStream->bitShift = -1;
+
+		if ( lCommand == -1 )
+			break;
+
+		CLIENT_ProcessCommand( lCommand, pByteStream );
+	}
+}
+
+//*****************************************************************************
+//
+static void clientdemo_Rewind( void )
+{
+	// There is no way to restore the state of an earlier tic directly, so we start
+	// over from the beginning, like CLIENTDEMO_DoPlayDemo does.
+	CLIENT_ClearAllPlayers();
+	CLIENTDEMO_ClearFreeSpectatorPlayer();
+	consoleplayer = 0;
+	players[consoleplayer].camera = NULL;
+
+	// The demo's length and end were already settled when it was loaded.
+	const LONG lDemoLength = g_lDemoLength;
+	BYTE *const pbStreamEnd = g_ByteStream.pbStreamEnd;
+
+	g_ByteStream.pbStream = g_pbDemoBuffer;
+	g_ByteStream.pbStreamEnd = g_pbDemoBuffer + g_lDemoBufferLength;
+	g_TicsPlayedBack = 0;
+	g_ulTicsToSkip = 0;
+	g_SkipToKeyframe = 0;
+	g_bApplyKeyframe = false;
+	CLIENTDEMO_SetSkippingToNextMap ( false );
+
+	CLIENTDEMO_ProcessDemoHeader( );
+	g_lDemoLength = lDemoLength;
+	g_ByteStream.pbStreamEnd = pbStreamEnd;
+	g_lGameticOffset = gametic;
+}
+
+//*****************************************************************************
+//
+// Continues playback at the snapshot of the keyframe, without reading anything before it.
+static void clientdemo_JumpToKeyframe( const DEMOKEYFRAME_s &Keyframe )
+{
+	g_ByteStream.pbStream = g_pbDemoBuffer + Keyframe.lOffset;
+	g_TicsPlayedBack = Keyframe.tic;
+	g_lGameticOffset = gametic - static_cast<LONG>( Keyframe.tic );
+	g_ulTicsToSkip = 0;
+	g_SkipToKeyframe = 0;
+	g_bApplyKeyframe = true;
+	CLIENTDEMO_SetSkippingToNextMap ( false );
+}
+
+//*****************************************************************************
+//
+static void clientdemo_SkipTo( unsigned int ticPosition )
+{
+	// Find the last keyframe at or before the position. Only the tics after it need
+	// to be run, the ones before it are read without running them. Better yet, if
+	// there is a snapshot at or before the position, we don't need to read anything
+	// before it at all.
+	unsigned int keyframe = 0;
+	const DEMOKEYFRAME_s *pSnapshot = NULL;
+	for ( unsigned int i = g_DemoKeyframes.Size( ); i-- > 0; )
+	{
+		if ( g_DemoKeyframes[i].tic > ticPosition )
+			continue;
+
+		keyframe = MAX( keyframe, g_DemoKeyframes[i].tic );
+		if ( g_DemoKeyframes[i].lOffset != -1 )
+		{
+			pSnapshot = &g_DemoKeyframes[i];
+			break;
+		}
+	}
+
+	// Going forward, the snapshot only helps if it's ahead of us.
+	if (( pSnapshot != NULL ) && (( ticPosition < g_TicsPlayedBack ) || ( pSnapshot->tic > g_TicsPlayedBack )))
+		clientdemo_JumpToKeyframe( *pSnapshot );
+	else if ( ticPosition < g_TicsPlayedBack )
+		clientdemo_Rewind( );
+
+	if ( keyframe > g_TicsPlayedBack )
+	{
+		g_SkipToKeyframe = keyframe;
+		g_ulTicsToSkip = ticPosition - keyframe;
+	}
+	else
+		g_ulTicsToSkip = ticPosition - g_TicsPlayedBack;
+}
+
 //*****************************************************************************
 //	CONSOLE COMMANDS
 
@@ -1043,13 +1570,13 @@ CCMD( demo_skiptics )
 	{
 		const int ticsToSkip = atoi ( argv[1] );
 		if ( ticsToSkip >= 0 )
-			g_ulTicsToSkip = static_cast<ULONG> ( ticsToSkip );
+			clientdemo_SkipTo( g_TicsPlayedBack + static_cast<unsigned int> ( ticsToSkip ));
 		else
 			Printf ( "You can't skip a negative amount of tics!\n" );
 	}
 }
 
-// Skips tics to a certain point in the demo.
+// Skips to a certain point in the demo, backwards or forwards.
 CCMD( demo_skipto )
 {
 	// This command shouldn't do anything if a demo isn't playing.
@@ -1062,15 +1589,7 @@ CCMD( demo_skipto )
 
 		if ( ticPositionSigned >= 0 )
 		{
-			const unsigned int ticPosition = static_cast<unsigned int>( ticPositionSigned );
-			if ( ticPosition >= g_TicsPlayedBack )
-			{
-				g_ulTicsToSkip = ticPosition - g_TicsPlayedBack;
-			}
-			else
-			{
-				Printf( "That position is in the past. You cannot rewind demos.\n" );
-			}
+			clientdemo_SkipTo( static_cast<unsigned int>( ticPositionSigned ));
 		}
 		else
 		{
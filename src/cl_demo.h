@@ -54,10 +54,32 @@
 #include "d_ticcmd.h"
 #include "network.h"
 #include "networkshared.h"
+#include "network_enums.h"
 
 //*****************************************************************************
 //	DEFINES
 
+enum 
+{
+	// [BC] Message headers with bytes starting with 0 and going sequentially
+	// isn't very distinguishing from other formats (such as normal ZDoom demos),
+	// but does that matter?
+	CLD_DEMOLENGTH = NUM_SERVER_COMMANDS,
+	CLD_DEMOVERSION,
+	CLD_CVARS,
+	CLD_USERINFO,
+	CLD_BODYSTART,
+	CLD_TICCMD,
+	CLD_LOCALCOMMAND, // [Dusk]
+	CLD_DEMOEND,
+	CLD_DEMOWADS, // [Dusk]
+	CLD_DEMOINDEX,
+	CLD_DEMOCHUNKS,
+	CLD_KEYFRAME,
+
+	NUM_DEMO_COMMANDS
+};
+
 enum ClientDemoLocalCommand
 {
 	CLD_LCMD_INVUSE,
@@ -67,10 +89,23 @@ enum ClientDemoLocalCommand
 	CLD_LCMD_WARPCHEAT,
 };
 
+//*****************************************************************************
+//	STRUCTURES
+
+// A point playback can start over from: either the server loaded a map there, or the
+// demo has a snapshot of the level (CLD_KEYFRAME) at lOffset, otherwise it's -1. The
+// snapshot was taken at tic, which may be some tics before the CLD_KEYFRAME itself.
+struct DEMOKEYFRAME_s
+{
+	unsigned int	tic;
+	LONG			lOffset;
+};
+
 //*****************************************************************************
 //	PROTOTYPES
 
 void		CLIENTDEMO_BeginRecording( const char *pszDemoName );
+void		CLIENTDEMO_WriteHeader( BYTESTREAM_s *pByteStream );
 bool		CLIENTDEMO_ProcessDemoHeader( void );
 void		CLIENTDEMO_WriteUserInfo( void );
 void		CLIENTDEMO_ReadUserInfo( void );
@@ -79,6 +114,10 @@ void		CLIENTDEMO_ReadTiccmd( ticcmd_t *pCmd );
 void		CLIENTDEMO_WritePacket( BYTESTREAM_s *pByteStream );
 void		CLIENTDEMO_InsertPacketAtMarkedPosition( BYTESTREAM_s *pByteStream );
 void		CLIENTDEMO_MarkCurrentPosition( void );
+void		CLIENTDEMO_AddKeyframe( void );
+bool		CLIENTDEMO_AddKeyframePiece( const BYTE *pbData, ULONG ulLength, ULONG ulFlags );
+void		CLIENTDEMO_WriteKeyframe( BYTESTREAM_s *pByteStream, const TArray<BYTE> &Snapshot, LONG lResumeOffset, unsigned int resumeTic );
+void		CLIENTDEMO_WriteIndex( BYTESTREAM_s *pByteStream, const TArray<DEMOKEYFRAME_s> &Keyframes );
 void		CLIENTDEMO_ReadPacket( void );
 void		CLIENTDEMO_FinishRecording( void );
 void		CLIENTDEMO_DoPlayDemo( const char *pszDemoName );
@@ -413,6 +413,25 @@ static	bool				g_HasRCONAccess = false;
 // [AK] We are in the process of gaining RCON access to the server.
 static  bool				g_GainingRCONAccess = false;
 
+// The movements of the other players the server sent us with MovePlayerDelta,
+// later deltas are relative to one of these we acknowledged.
+static	MOVESNAPSHOT_s		g_MoveSnapshots[MAXPLAYERS][NUM_MOVE_SNAPSHOTS];
+static	int					g_MoveSnapshotTics[MAXPLAYERS][NUM_MOVE_SNAPSHOTS];
+static	ULONG				g_ulMoveSnapshot[MAXPLAYERS];
+
+// What we still have to tell the server about the movement of each player, see CLIENT_SendCmd.
+enum MOVESNAPSHOTACK_e
+{
+	MOVESNAPSHOTACK_NONE,
+	MOVESNAPSHOTACK_PENDING,
+	MOVESNAPSHOTACK_NOBASELINE,
+};
+static	MOVESNAPSHOTACK_e	g_MoveSnapshotAcks[MAXPLAYERS];
+
+// The newest tic of a MovePlayerDelta and our gametic when we received it.
+static	int					g_LatestMoveTic;
+static	int					g_LatestMoveTicLocal;
+
 //*****************************************************************************
 //	FUNCTIONS
 
@@ -435,6 +454,26 @@ void CLIENT_ClearAllPlayers( void )
 	CHAT_ClearChatMessages( MAXPLAYERS );
 }
 
+//*****************************************************************************
+//
+void CLIENT_ResetMoveSnapshots( void )
+{
+	for ( ULONG ulPlayer = 0; ulPlayer < MAXPLAYERS; ulPlayer++ )
+	{
+		for ( ULONG ulSnapshot = 0; ulSnapshot < NUM_MOVE_SNAPSHOTS; ulSnapshot++ )
+		{
+			g_MoveSnapshots[ulPlayer][ulSnapshot].bValid = false;
+			g_MoveSnapshotTics[ulPlayer][ulSnapshot] = 0;
+		}
+
+		g_ulMoveSnapshot[ulPlayer] = 0;
+		g_MoveSnapshotAcks[ulPlayer] = MOVESNAPSHOTACK_NONE;
+	}
+
+	g_LatestMoveTic = 0;
+	g_LatestMoveTicLocal = gametic;
+}
+
 //*****************************************************************************
 //
 void CLIENT_LimitProtectedCVARs( void )
@@ -892,6 +931,7 @@ void CLIENT_AttemptConnection( void )
 
 	// [CK] Reset this here since we plan on connecting to a new server
 	CLIENT_SetLatestServerGametic( 0 );
+	CLIENT_ResetMoveSnapshots( );
 
 	 // Send connection signal to the server.
 	g_LocalBuffer.ByteStream.WriteByte( CLCC_ATTEMPTCONNECTION );
@@ -1324,7 +1364,9 @@ void CLIENT_ParsePacket( BYTESTREAM_s *pByteStream, bool bSequencedPacket )
 
 		// [BB] If we're recording a demo, write the contents of this command at the position
 		// our demo was at when we started to process the server command.
-		if ( CLIENTDEMO_IsRecording( ) )
+		// The pieces of a keyframe are stored as a whole, see CLIENTDEMO_AddKeyframePiece.
+		if ( CLIENTDEMO_IsRecording( )
+			&& (( lCommand != SVC_EXTENDEDCOMMAND ) || ( commandAsStream.pbStream[1] != SVC2_DEMOKEYFRAME )))
 		{
 			// [BB] Since we just processed the server command, this command ends where we are now.
 			commandAsStream.pbStreamEnd = pByteStream->pbStream;
@@ -1364,6 +1406,9 @@ void CLIENT_ProcessCommand( LONG lCommand, BYTESTREAM_s *pByteStream )
 		// Print a status message.
 		Printf( "Connected!\n" );
 
+		// The first map is loaded and fully updated from here on, so demos can be played back from here.
+		CLIENTDEMO_AddKeyframe( );
+
 		// Read in the map name we now need to authenticate.
 		strncpy( g_szMapName, pByteStream->ReadString(), 8 );
 		g_szMapName[8] = 0;
@@ -2289,6 +2334,26 @@ void CLIENT_ProcessCommand( LONG lCommand, BYTESTREAM_s *pByteStream )
 				}
 				break;
 
+			case SVC2_DEMOKEYFRAME:
+				{
+					const ULONG ulFlags = pByteStream->ReadByte();
+					const ULONG ulLength = static_cast<WORD>( pByteStream->ReadShort() );
+
+					if ( pByteStream->pbStreamEnd - pByteStream->pbStream < static_cast<LONG>( ulLength ))
+					{
+						pByteStream->pbStream = pByteStream->pbStreamEnd;
+						break;
+					}
+
+					// The demo continues from the keyframe with the movement the server sends
+					// from now on, so we have to do without the earlier movement too.
+					if ( CLIENTDEMO_AddKeyframePiece( pByteStream->pbStream, ulLength, ulFlags ))
+						CLIENT_ResetMoveSnapshots( );
+
+					pByteStream->pbStream += ulLength;
+				}
+				break;
+
 			case SVC2_UPDATEMAPROTATION:
 				{
 					const LONG lType = pByteStream->ReadByte();
@@ -2479,6 +2544,34 @@ void CLIENT_QuitNetworkGame( const char *pszString )
 		D_SetupUserInfo ();
 }
 
+//*****************************************************************************
+//
+static void client_AckMoveSnapshots( void )
+{
+	TArray<BYTE> acks;
+	ULONG ulNumAcks = 0;
+
+	for ( ULONG ulPlayer = 0; ulPlayer < MAXPLAYERS; ulPlayer++ )
+	{
+		if ( g_MoveSnapshotAcks[ulPlayer] == MOVESNAPSHOTACK_PENDING )
+		{
+			acks.Push( static_cast<BYTE>( ulPlayer ));
+			acks.Push( static_cast<BYTE>( g_MoveSnapshotTics[ulPlayer][g_ulMoveSnapshot[ulPlayer]] & 0xFF ));
+			ulNumAcks++;
+		}
+		else if ( g_MoveSnapshotAcks[ulPlayer] == MOVESNAPSHOTACK_NOBASELINE )
+		{
+			acks.Push( static_cast<BYTE>( ulPlayer | MOVEACK_NOBASELINE ));
+			ulNumAcks++;
+		}
+
+		g_MoveSnapshotAcks[ulPlayer] = MOVESNAPSHOTACK_NONE;
+	}
+
+	if ( ulNumAcks > 0 )
+		CLIENTCOMMANDS_AckMoveSnapshots( ulNumAcks, acks );
+}
+
 //*****************************************************************************
 //
 void CLIENT_SendCmd( void )
@@ -2504,6 +2597,10 @@ void CLIENT_SendCmd( void )
 		return;
 	}
 
+	// Tell the server which movements of the other players it may send the next deltas
+	// relative to. Spectators need this as well.
+	client_AckMoveSnapshots( );
+
 	// Don't send movement information if we're spectating!
 	if ( players[consoleplayer].bSpectating )
 	{
@@ -3781,26 +3878,9 @@ void ServerCommands::SpawnPlayer::Execute()
 
 //*****************************************************************************
 //
-void ServerCommands::MovePlayer::Execute()
+// Moves a visible player to where the server says they are.
+static void client_MovePlayer( player_t *player, fixed_t x, fixed_t y, fixed_t z, angle_t angle, fixed_t velx, fixed_t vely, fixed_t velz, int flags )
 {
-	// Check to make sure everything is valid. If not, break out.
-	if ( gamestate != GS_LEVEL )
-	{
-		CLIENT_PrintWarning( "MovePlayer: not in a level\n" );
-		return;
-	}
-
-	// If we're not allowed to know the player's location, then just make him invisible.
-	if ( IsVisible() == false )
-	{
-		player->mo->renderflags |= RF_INVISIBLE;
-
-		// Don't move the player since the server didn't send any useful position information.
-		return;
-	}
-	else
-		player->mo->renderflags &= ~RF_INVISIBLE;
-
 	// Set the player's XYZ position.
 	// [BB] But don't just set the position, but also properly set floorz and ceilingz, etc.
 	CLIENT_MoveThing( player->mo, x, y, z );
@@ -3825,10 +3905,9 @@ void ServerCommands::MovePlayer::Execute()
 	player->mo->angle = angle;
 
 	// Set the player's XYZ momentum.
-	// [AK] Check if the server sent us this player's velocity on each axis.
-	player->mo->velx = IsMovingX() ? velx : 0;
-	player->mo->vely = IsMovingY() ? vely : 0;
-	player->mo->velz = IsMovingZ() ? velz : 0;
+	player->mo->velx = velx;
+	player->mo->vely = vely;
+	player->mo->velz = velz;
 
 	// Is the player crouching?
 	player->crouchdir = ( flags & PLAYER_CROUCHING ) ? 1 : -1;
@@ -3858,6 +3937,122 @@ void ServerCommands::MovePlayer::Execute()
 		player->cmd.ucmd.buttons &= ~BT_ALTATTACK;
 }
 
+//*****************************************************************************
+//
+void ServerCommands::MovePlayer::Execute()
+{
+	// Check to make sure everything is valid. If not, break out.
+	if ( gamestate != GS_LEVEL )
+	{
+		CLIENT_PrintWarning( "MovePlayer: not in a level\n" );
+		return;
+	}
+
+	// If we're not allowed to know the player's location, then just make him invisible.
+	if ( IsVisible() == false )
+	{
+		player->mo->renderflags |= RF_INVISIBLE;
+
+		// Don't move the player since the server didn't send any useful position information.
+		return;
+	}
+	else
+		player->mo->renderflags &= ~RF_INVISIBLE;
+
+	// [AK] Check if the server sent us this player's velocity on each axis.
+	client_MovePlayer( player, x, y, z, angle, IsMovingX() ? velx : 0, IsMovingY() ? vely : 0, IsMovingZ() ? velz : 0, flags );
+}
+
+//*****************************************************************************
+//
+void ServerCommands::MovePlayerDelta::Execute()
+{
+	if ( gamestate != GS_LEVEL )
+	{
+		CLIENT_PrintWarning( "MovePlayerDelta: not in a level\n" );
+		return;
+	}
+
+	const ULONG ulPlayer = static_cast<ULONG>( player - players );
+
+	// Only the low byte of the server's gametic is sent, it's always close to the one we expect
+	// from the last MovePlayerDelta or MoveLocalPlayer. Spectators don't get the latter.
+	const int expectedTic = MAX<int>( CLIENT_GetLatestServerGametic( ), g_LatestMoveTic + gametic - g_LatestMoveTicLocal );
+	const int fullTic = expectedTic + static_cast<SBYTE>( tic - expectedTic );
+
+	// Unreliable packets may arrive in the wrong order, ignore movement older than what we already have.
+	const ULONG ulLatest = g_ulMoveSnapshot[ulPlayer];
+	if ( g_MoveSnapshots[ulPlayer][ulLatest].bValid && ( fullTic <= g_MoveSnapshotTics[ulPlayer][ulLatest] ))
+		return;
+
+	MOVESNAPSHOT_s snapshot;
+	if ( baselineAge == 0 )
+		memset( &snapshot, 0, sizeof( snapshot ));
+	else
+	{
+		const MOVESNAPSHOT_s *pBaseline = NULL;
+		for ( ULONG ulSnapshot = 0; ulSnapshot < NUM_MOVE_SNAPSHOTS; ulSnapshot++ )
+		{
+			if ( g_MoveSnapshots[ulPlayer][ulSnapshot].bValid && ( g_MoveSnapshotTics[ulPlayer][ulSnapshot] == fullTic - baselineAge ))
+			{
+				pBaseline = &g_MoveSnapshots[ulPlayer][ulSnapshot];
+				break;
+			}
+		}
+
+		// We don't have the movement this is relative to anymore. Tell the server, so that it
+		// sends everything with the next update.
+		if ( pBaseline == NULL )
+		{
+			g_MoveSnapshotAcks[ulPlayer] = MOVESNAPSHOTACK_NOBASELINE;
+			return;
+		}
+
+		snapshot = *pBaseline;
+	}
+
+	if ( changes & MOVEDELTA_POSITION_EXACT )
+	{
+		snapshot.x = x;
+		snapshot.y = y;
+	}
+	else if ( changes & MOVEDELTA_POSITION )
+	{
+		snapshot.x += deltaX * ( 1 << MOVEDELTA_POSITION_SHIFT );
+		snapshot.y += deltaY * ( 1 << MOVEDELTA_POSITION_SHIFT );
+	}
+
+	if ( changes & MOVEDELTA_Z )
+		snapshot.z = z;
+
+	if ( changes & MOVEDELTA_ANGLE_EXACT )
+		snapshot.angle = angle;
+	else if ( changes & MOVEDELTA_ANGLE )
+		snapshot.angle += static_cast<angle_t>( deltaAngle ) << MOVEDELTA_ANGLE_SHIFT;
+
+	if ( changes & MOVEDELTA_VELX )
+		snapshot.velx = velx;
+	if ( changes & MOVEDELTA_VELY )
+		snapshot.vely = vely;
+	if ( changes & MOVEDELTA_VELZ )
+		snapshot.velz = velz;
+
+	snapshot.bValid = true;
+	g_ulMoveSnapshot[ulPlayer] = ( ulLatest + 1 ) % NUM_MOVE_SNAPSHOTS;
+	g_MoveSnapshots[ulPlayer][g_ulMoveSnapshot[ulPlayer]] = snapshot;
+	g_MoveSnapshotTics[ulPlayer][g_ulMoveSnapshot[ulPlayer]] = fullTic;
+	g_MoveSnapshotAcks[ulPlayer] = MOVESNAPSHOTACK_PENDING;
+
+	if ( fullTic > g_LatestMoveTic )
+	{
+		g_LatestMoveTic = fullTic;
+		g_LatestMoveTicLocal = gametic;
+	}
+
+	player->mo->renderflags &= ~RF_INVISIBLE;
+	client_MovePlayer( player, snapshot.x, snapshot.y, snapshot.z, snapshot.angle, snapshot.velx, snapshot.vely, snapshot.velz, flags );
+}
+
 //*****************************************************************************
 //
 static void client_DamagePlayer( player_t *player, int health, int armor, AActor *attacker )
@@ -6963,6 +7158,9 @@ void ServerCommands::MapLoad::Execute()
 	// and wanted to skip the current map, we are done with it now.
 	CLIENTDEMO_SetSkippingToNextMap ( false );
 
+	// The server follows this with a full update, so demos can be played back from here.
+	CLIENTDEMO_AddKeyframe( );
+
 	// Check to see if we have the map.
 	if ( P_CheckIfMapExists( mapName ))
 	{
@@ -6975,6 +7173,7 @@ void ServerCommands::MapLoad::Execute()
 
 		// [BB] We'll receive a full update for the new map from the server.
 		g_bFullUpdateIncomplete = true;
+		CLIENT_ResetMoveSnapshots( );
 
 		// [BB] viewactive is set in G_InitNew
 		// For right now, the view is not active.
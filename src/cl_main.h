@@ -183,6 +183,7 @@ void				CLIENT_LogHUDMessage( const char *pszString, LONG lColor );
 void				CLIENT_UpdatePendingWeapon( const player_t *pPlayer );
 void				CLIENT_SetActorToLastDeathStateFrame ( AActor *pActor );
 void				CLIENT_ClearAllPlayers( void );
+void				CLIENT_ResetMoveSnapshots( void );
 void				CLIENT_LimitProtectedCVARs( void );
 bool				CLIENT_CanClipMovement( AActor *pActor );
 void STACK_ARGS		CLIENT_PrintWarning( const char* format, ... ) GCCPRINTF( 1, 2 );
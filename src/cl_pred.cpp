@@ -97,6 +97,33 @@ static	bool		g_bSavedOnMobj[CLIENT_PREDICTION_TICS];
 static	bool		g_bSavedOnGround[CLIENT_PREDICTION_TICS];
 static	fixed_t		g_SavedFloorZ[CLIENT_PREDICTION_TICS];
 
+// What we predicted for each tick. The bases of the ticks the server told us about are
+// overwritten with its corrections, these are kept to compare them with.
+static	fixed_t		g_PredictedPosition[3][CLIENT_PREDICTION_TICS];
+static	fixed_t		g_PredictedVelocity[3][CLIENT_PREDICTION_TICS];
+static	int			g_PredictedJumpTics[CLIENT_PREDICTION_TICS];
+static	LONG		g_lPredictedTick[CLIENT_PREDICTION_TICS];
+
+// The state the last tick left the player in. If the server agrees with what we predicted,
+// the next tick goes on from there instead of predicting all ticks again.
+static	bool		g_bLastStateValid = false;
+static	ULONG		g_ulLastStateTick;
+static	fixed_t		g_LastStatePosition[3];
+static	fixed_t		g_LastStateVelocity[3];
+static	int			g_LastStateJumpTics;
+
+// Statistics for cl_predictionstats.
+static	ULONG		g_ulPredictedFrames = 0;
+static	ULONG		g_ulResumedFrames = 0;
+static	QWORD		g_qwReplayedTicks = 0;
+static	ULONG		g_ulMaxReplayedTicks = 0;
+static	ULONG		g_ulCorrections = 0;
+static	ULONG		g_ulMispredictions = 0;
+static	ULONG		g_ulLastComparedTick = 0;
+
+// Go on from the last predicted state when the server confirms it.
+CVAR( Bool, cl_predict_incremental, true, CVAR_ARCHIVE )
+
 #ifdef	_DEBUG
 CVAR( Bool, cl_showpredictionsuccess, false, 0 );
 CVAR( Bool, cl_showonetickpredictionerrors, false, 0 );
@@ -110,6 +137,8 @@ static	void	client_predict_DoPrediction( player_t *pPlayer, ULONG ulTicks );
 static	void	client_predict_EndPrediction( player_t *pPlayer );
 static	void	client_predict_SaveOnGroundStatus( const player_t *pPlayer, const ULONG Tick );
 static	void	client_predict_SavePrediction( const player_t *pPlayer, const unsigned int Tick );
+static	bool	client_predict_PredictionConfirmed( const player_t *pPlayer, const unsigned int BaseTick );
+static	void	client_predict_SaveLastState( const player_t *pPlayer );
 
 //*****************************************************************************
 //	FUNCTIONS
@@ -122,6 +151,10 @@ void CLIENT_PREDICT_Construct( void )
 	memset( g_PositionBase, 0, sizeof( g_PositionBase ));
 	memset( g_VelocityBase, 0, sizeof( g_VelocityBase ));
 	memset( g_JumpTicsBase, 0, sizeof( g_JumpTicsBase ));
+
+	for ( int i = 0; i < CLIENT_PREDICTION_TICS; ++i )
+		g_lPredictedTick[i] = -1;
+	g_bLastStateValid = false;
 }
 
 //*****************************************************************************
@@ -167,6 +200,10 @@ void CLIENT_PREDICT_PlayerPredict( void )
 	if ( pPlayer->mo == NULL )
 		return;
 
+	// Unless we get to the end, the next tick can't go on from this one.
+	const bool bLastStateValid = g_bLastStateValid;
+	g_bLastStateValid = false;
+
 	// For spectators, we don't care about prediction. Just think and leave.
 	if (( pPlayer->bSpectating ) ||
 		( pPlayer->playerstate == PST_DEAD ))
@@ -235,6 +272,35 @@ void CLIENT_PREDICT_PlayerPredict( void )
 	}
 #endif
 
+	// If the server agrees with what we predicted for the tick it told us about, and nothing
+	// moved us since the last tick, predicting the ticks after it again would give the same
+	// result. So just go on from where we are.
+	const bool bResume = bLastStateValid && ( g_ulLastStateTick + 1 == g_ulGameTick ) && cl_predict_players
+		&& client_predict_PredictionConfirmed( pPlayer, BaseTick );
+
+	g_ulPredictedFrames++;
+	if ( bResume )
+	{
+		g_ulResumedFrames++;
+
+		// Save the attributes of this tick for later predictions.
+		client_predict_BeginPrediction( pPlayer );
+		client_predict_SaveOnGroundStatus ( pPlayer, g_ulGameTick );
+
+		P_PlayerThink( pPlayer );
+		pPlayer->oldbuttons = pPlayer->cmd.ucmd.buttons;
+		pPlayer->mo->Tick( );
+
+		if ( BaseTick != g_ulGameTick && ulPredictionTicks + 1 != CLIENT_PREDICTION_TICS )
+			client_predict_SavePrediction( pPlayer, g_ulGameTick );
+
+		client_predict_SaveLastState( pPlayer );
+		return;
+	}
+
+	g_qwReplayedTicks += ulPredictionTicks;
+	g_ulMaxReplayedTicks = MAX( g_ulMaxReplayedTicks, ulPredictionTicks );
+
 	// [BB] Save the "on ground" status. Necessary to keep movement on moving floors
 	// and on actors like bridge things smooth.
 	client_predict_SaveOnGroundStatus ( pPlayer, g_ulGameTick );
@@ -297,6 +363,8 @@ void CLIENT_PREDICT_PlayerPredict( void )
 	// Save our predictions, we may need to re-use them later.
 	if ( BaseTick != g_ulGameTick && ulPredictionTicks + 1 != CLIENT_PREDICTION_TICS )
 		client_predict_SavePrediction( pPlayer, g_ulGameTick );
+
+	client_predict_SaveLastState( pPlayer );
 }
 
 //*****************************************************************************
@@ -311,6 +379,8 @@ void CLIENT_PREDICT_PlayerTeleported( void )
 		g_SavedFloorZ[ulIdx] = players[consoleplayer].mo->z;
 		g_bSavedOnFloor[ulIdx] = false;
 	}
+
+	g_bLastStateValid = false;
 }
 
 //*****************************************************************************
@@ -367,6 +437,72 @@ static void client_predict_SavePrediction( const player_t *pPlayer, const unsign
 	g_VelocityBase[1][Tick % CLIENT_PREDICTION_TICS] = pPlayer->mo->vely;
 	g_VelocityBase[2][Tick % CLIENT_PREDICTION_TICS] = pPlayer->mo->velz;
 	g_JumpTicsBase[Tick % CLIENT_PREDICTION_TICS] = pPlayer->jumpTics;
+
+	g_PredictedPosition[0][Tick % CLIENT_PREDICTION_TICS] = pPlayer->mo->x;
+	g_PredictedPosition[1][Tick % CLIENT_PREDICTION_TICS] = pPlayer->mo->y;
+	g_PredictedPosition[2][Tick % CLIENT_PREDICTION_TICS] = pPlayer->mo->z;
+	g_PredictedVelocity[0][Tick % CLIENT_PREDICTION_TICS] = pPlayer->mo->velx;
+	g_PredictedVelocity[1][Tick % CLIENT_PREDICTION_TICS] = pPlayer->mo->vely;
+	g_PredictedVelocity[2][Tick % CLIENT_PREDICTION_TICS] = pPlayer->mo->velz;
+	g_PredictedJumpTics[Tick % CLIENT_PREDICTION_TICS] = pPlayer->jumpTics;
+	g_lPredictedTick[Tick % CLIENT_PREDICTION_TICS] = Tick;
+}
+
+//*****************************************************************************
+//
+// Returns whether the server's correction for BaseTick is what we predicted for it, and
+// the player is still where the last tick left him.
+static bool client_predict_PredictionConfirmed( const player_t *pPlayer, const unsigned int BaseTick )
+{
+	const ULONG ulIdx = BaseTick % CLIENT_PREDICTION_TICS;
+
+	// We never predicted this tick, or the prediction has been overwritten by a later one.
+	if ( g_lPredictedTick[ulIdx] != static_cast<LONG>( BaseTick ))
+		return false;
+
+	const bool bConfirmed = ( g_PositionBase[0][ulIdx] == g_PredictedPosition[0][ulIdx] ) &&
+		( g_PositionBase[1][ulIdx] == g_PredictedPosition[1][ulIdx] ) &&
+		( g_PositionBase[2][ulIdx] == g_PredictedPosition[2][ulIdx] ) &&
+		( g_VelocityBase[0][ulIdx] == g_PredictedVelocity[0][ulIdx] ) &&
+		( g_VelocityBase[1][ulIdx] == g_PredictedVelocity[1][ulIdx] ) &&
+		( g_VelocityBase[2][ulIdx] == g_PredictedVelocity[2][ulIdx] ) &&
+		( g_JumpTicsBase[ulIdx] == g_PredictedJumpTics[ulIdx] );
+
+	// Count every correction only once.
+	if ( BaseTick != g_ulLastComparedTick )
+	{
+		g_ulLastComparedTick = BaseTick;
+		g_ulCorrections++;
+		if ( bConfirmed == false )
+			g_ulMispredictions++;
+	}
+
+	if ( bConfirmed == false )
+		return false;
+
+	// Something other than the prediction moved us since the last tick.
+	return (( pPlayer->mo->x == g_LastStatePosition[0] ) &&
+		( pPlayer->mo->y == g_LastStatePosition[1] ) &&
+		( pPlayer->mo->z == g_LastStatePosition[2] ) &&
+		( pPlayer->mo->velx == g_LastStateVelocity[0] ) &&
+		( pPlayer->mo->vely == g_LastStateVelocity[1] ) &&
+		( pPlayer->mo->velz == g_LastStateVelocity[2] ) &&
+		( pPlayer->jumpTics == g_LastStateJumpTics ));
+}
+
+//*****************************************************************************
+//
+static void client_predict_SaveLastState( const player_t *pPlayer )
+{
+	g_bLastStateValid = true;
+	g_ulLastStateTick = g_ulGameTick;
+	g_LastStatePosition[0] = pPlayer->mo->x;
+	g_LastStatePosition[1] = pPlayer->mo->y;
+	g_LastStatePosition[2] = pPlayer->mo->z;
+	g_LastStateVelocity[0] = pPlayer->mo->velx;
+	g_LastStateVelocity[1] = pPlayer->mo->vely;
+	g_LastStateVelocity[2] = pPlayer->mo->velz;
+	g_LastStateJumpTics = pPlayer->jumpTics;
 }
 
 //*****************************************************************************
@@ -466,3 +602,38 @@ static void client_predict_EndPrediction( player_t *pPlayer )
 	pPlayer->mo->waterlevel = g_lSavedWaterLevel[g_ulGameTick % CLIENT_PREDICTION_TICS];
 	memcpy( &pPlayer->cmd, &g_SavedTiccmd[g_ulGameTick % CLIENT_PREDICTION_TICS], sizeof( ticcmd_t ));
 }
+
+//*****************************************************************************
+//	CONSOLE COMMANDS
+
+// Shows how many ticks the prediction had to predict again and how often the server
+// disagreed with it.
+CCMD( cl_predictionstats )
+{
+	if (( argv.argc( ) >= 2 ) && ( stricmp( argv[1], "reset" ) == 0 ))
+	{
+		g_ulPredictedFrames = 0;
+		g_ulResumedFrames = 0;
+		g_qwReplayedTicks = 0;
+		g_ulMaxReplayedTicks = 0;
+		g_ulCorrections = 0;
+		g_ulMispredictions = 0;
+		Printf( "Prediction statistics reset.\n" );
+		return;
+	}
+
+	if ( g_ulPredictedFrames == 0 )
+	{
+		Printf( "Nothing predicted yet.\n" );
+		return;
+	}
+
+	Printf( "Predicted ticks: %lu, %lu of them (%.1f%%) went on from the last tick\n", g_ulPredictedFrames, g_ulResumedFrames,
+		100.0 * g_ulResumedFrames / g_ulPredictedFrames );
+	Printf( "Replayed ticks per tick: average %.2f, maximum %lu\n", static_cast<double>( g_qwReplayedTicks ) / g_ulPredictedFrames, g_ulMaxReplayedTicks );
+	if ( g_ulCorrections > 0 )
+	{
+		Printf( "Mispredictions: %lu of %lu corrections (%.1f%%)\n", g_ulMispredictions, g_ulCorrections,
+			100.0 * g_ulMispredictions / g_ulCorrections );
+	}
+}
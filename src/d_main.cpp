@@ -2746,6 +2746,43 @@ static void FinalGC()
 	GC::DelSoftRootHead();	// the soft root head will not be collected by a GC so we have to do it explicitly
 }
 
+//==========================================================================
+//
+// D_BuildNodeCache
+//
+// Loads every map of the rotation (or just the start map if there is no
+// rotation) so that the nodes the server has to build for them end up in
+// the node cache, then quits. Map changes of servers sharing the cache
+// won't have to build the nodes anymore.
+//
+//==========================================================================
+
+static void D_BuildNodeCache( void )
+{
+	const unsigned int startTime = I_MSTime( );
+	TArray<FString> maps;
+
+	// A map that is in the rotation more than once is loaded from the cache the next times.
+	for ( ULONG ulIdx = 0; ulIdx < MAPROTATION_GetNumEntries( ); ulIdx++ )
+		maps.Push( MAPROTATION_GetMap( ulIdx )->mapname );
+
+	if ( maps.Size( ) == 0 )
+		maps.Push( startmap );
+
+	for ( unsigned int i = 0; i < maps.Size( ); ++i )
+	{
+		// G_InitNew may alter the name it's given, see below.
+		char levelname[256];
+		mysnprintf( levelname, sizeof( levelname ), "%s", maps[i].GetChars( ));
+
+		Printf( "Building the node cache of %s (%u/%u).\n", levelname, i + 1, maps.Size( ));
+		G_InitNew( levelname, false );
+	}
+
+	Printf( "Node cache built for %u map%s in %.2f seconds.\n", maps.Size( ), maps.Size( ) == 1 ? "" : "s", ( I_MSTime( ) - startTime ) / 1000.0 );
+	exit( 0 );
+}
+
 //==========================================================================
 //
 // D_DoomMain
@@ -3199,6 +3236,11 @@ void D_DoomMain (void)
 				{
 					G_NewInit( );
 
+					// Load every map of the rotation once, so that all of their nodes are cached
+					// before the server is started for real, and quit.
+					if ( Args->CheckParm( "-buildnodecache" ))
+						D_BuildNodeCache( );
+
 					// Check if we have map rotation setup. If we do, use the first map there.
 					if (( sv_maprotation ) && ( MAPROTATION_GetNumEntries( ) > 0 ))
 					{
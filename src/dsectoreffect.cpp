@@ -29,6 +29,8 @@
 #include "r_data/r_interpolate.h"
 #include "statnums.h"
 #include "farchive.h"
+#include "unlagged.h"
+#include "p_acs.h"
 
 IMPLEMENT_CLASS (DSectorEffect)
 
@@ -42,18 +44,27 @@ void DSectorEffect::Destroy()
 {
 	if (m_Sector)
 	{
+		bool stopped = false;
+
 		if (m_Sector->floordata == this)
 		{
 			m_Sector->floordata = NULL;
+			stopped = true;
 		}
 		if (m_Sector->ceilingdata == this)
 		{
 			m_Sector->ceilingdata = NULL;
+			stopped = true;
 		}
 		if (m_Sector->lightingdata == this)
 		{
 			m_Sector->lightingdata = NULL;
 		}
+		// Let scripts waiting for this sector's tag check it again.
+		if (stopped)
+		{
+			DACSThinker::NotifyTagIdle (m_Sector->tag);
+		}
 	}
 	Super::Destroy();
 }
@@ -172,6 +183,9 @@ DMover::EResult DMover::MovePlane (fixed_t speed, fixed_t dest, int crush,
 	else
 		m_Sector->bCeilingHeightChange = true;
 
+	// The unlagged reconciliation has to rewind this sector now.
+	UNLAGGED_SectorMoved( m_Sector );
+
 	switch (floorOrCeiling)
 	{
 	case 0:
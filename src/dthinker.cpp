@@ -46,6 +46,7 @@
 // [BB] New #includes.
 #include "cl_demo.h"
 #include "doomstat.h"
+#include "sv_profiler.h"
 
 
 static cycle_t ThinkCycles;
@@ -436,6 +437,7 @@ int DThinker::TickThinkers (FThinkerList *list, FThinkerList *dest)
 {
 	int count = 0;
 	DThinker *node = list->GetHead();
+	const bool bProfile = SERVERPROFILER_IsActive();
 
 	if (node == NULL)
 	{
@@ -469,7 +471,18 @@ int DThinker::TickThinkers (FThinkerList *list, FThinkerList *dest)
 				( node->IsKindOf( RUNTIME_CLASS( AActor )) == false ) ||
 				( static_cast<AActor *>( node ) != players[consoleplayer].mo ))
 			{
-				node->Tick();
+				if (bProfile)
+				{
+					// The thinker may destroy itself, so get its class first.
+					const PClass *type = node->GetClass();
+					const SQWORD start = SERVERPROFILER_Now();
+					node->Tick();
+					SERVERPROFILER_AddThinkerTime(type, start);
+				}
+				else
+				{
+					node->Tick();
+				}
 			}
 			node->ObjectFlags &= ~OF_JustSpawned;
 			GC::CheckGC();
@@ -111,6 +111,7 @@
 #include <set> // [CK] For CCMD listmusic
 
 #include "g_hub.h"
+#include "za_database.h"
 
 void STAT_StartNewGame(const char *lev);
 void STAT_ChangeLevel(const char *newl);
@@ -1085,6 +1086,9 @@ void G_DoLoadLevel (int position, bool autosave)
 	// [BB] Reset the net traffic measurements when a new map starts.
 	NETTRAFFIC_Reset();
 
+	// Make sure that what the scripts of the last map saved is in the database.
+	DATABASE_Flush();
+
 	// [AK] Reset the end level delay if it's not already zero.
 	GAME_SetEndLevelDelay( 0, false );
 
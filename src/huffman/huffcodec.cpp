@@ -72,6 +72,7 @@ namespace skulltag {
 		// recursive Huffman tree builder.
 		buildTree( root, treeData, 0, dataLength, codeTable, 256 );
 		huffResourceOwner = true;
+		buildTables();
 	}
 	
 
@@ -88,6 +89,7 @@ namespace skulltag {
 		root = treeRootNode;
 		codeTable = leafCodeTable;
 		huffResourceOwner = false;
+		buildTables();
 	}
 	
 	/** Checks the ownership state of this HuffmanCodec's resources.
@@ -103,6 +105,48 @@ namespace skulltag {
 		reverseBits = false;
 		expandable = true;
 		huffResourceOwner = false;
+		decodeTable = 0;
+	}
+
+	/** Builds the encoding and decoding tables from the Huffman tree. */
+	void HuffmanCodec::buildTables(){
+		// Encoding table: every code with its bits in stream order.
+		for ( int i = 0; i < 256; i++ ){
+			encodeCodes[i] = 0;
+			encodeBitCounts[i] = 0;
+			HuffmanNode const * leaf = codeTable[i];
+			if ( leaf == 0 ) continue;
+			for ( int bit = 0; bit < leaf->bitCount; bit++ ){
+				// the most significant bit of a tree code is its first bit.
+				if ( leaf->code & (1 << (leaf->bitCount - 1 - bit)) ) encodeCodes[i] |= 1u << bit;
+			}
+			encodeBitCounts[i] = (unsigned char)leaf->bitCount;
+		}
+
+		// Decoding table: walk the tree for every possible combination of decodeTableBits bits.
+		int const tableSize = 1 << decodeTableBits;
+		decodeTable = new DecodeEntry[tableSize];
+		for ( int index = 0; index < tableSize; index++ ){
+			DecodeEntry &entry = decodeTable[index];
+			HuffmanNode const * node = root;
+			entry.valueCount = 0;
+			entry.node = 0;
+
+			for ( int bit = 0; (bit < decodeTableBits) && (node != 0) && (node->branch != 0); bit++ ){
+				node = &(node->branch[ (index >> bit) & 1 ]);
+				// Is the node a leaf? Store its value and restart at the root node.
+				if ( node->branch == 0 ){
+					entry.values[entry.valueCount] = (unsigned char)(node->value & 0xff);
+					entry.bitEnds[entry.valueCount] = (unsigned char)(bit + 1);
+					entry.valueCount++;
+					if ( entry.valueCount == maxValuesPerEntry ) break;
+					node = root;
+				}
+			}
+
+			// The first code is longer than the table bits, remember where we are in the tree.
+			if ( entry.valueCount == 0 ) entry.node = node;
+		}
 	}
 	
 	/** Increases a codeLength up to the longest Huffman code bit length found in the node or any of its children. <br>
@@ -206,9 +250,9 @@ namespace skulltag {
 		return index;
 	}
 
-	/** Decodes data read from an input buffer and stores the result in the output buffer.
+	/** Encodes data like encode(), but writes the codes one at a time through the BitWriter.
 	 * @return number of bytes stored in the output buffer or -1 if an error occurs while encoding. */
-	int HuffmanCodec::encode(
+	int HuffmanCodec::encodeBitwise(
 		unsigned char const * const input,	/**< in: pointer to the first byte to encode. */
 		unsigned char * const output,		/**< out: pointer to an output buffer to store data. */
 		int const &inLength,				/**< in: number of bytes of input buffer to encoded. */
@@ -238,16 +282,16 @@ namespace skulltag {
 		}
 
 		return bytesWritten;
-	} // end function encode
+	} // end function encodeBitwise
 
-	/** Decodes data read from an input buffer and stores the result in the output buffer.
+	/** Decodes data like decode(), but walks the Huffman tree one bit at a time.
 	 * @return number of bytes stored in the output buffer or -1 if an error occurs while decoding. */
-	int HuffmanCodec::decode(
+	int HuffmanCodec::decodeBitwise(
 		unsigned char const * const input,	/**< in: pointer to data that needs decoding. */
 		unsigned char * const output,		/**< out: pointer to output buffer to store decoded data. */
 		int const &inLength,				/**< in: number of bytes of input buffer to read. */
 		int const &outLength				/**< in: maximum length of data to output. */
-	){
+	) const {
 		if ( inLength < 1 ) return 0;
 		int bitsAvailable = ((inLength-1) << 3) - (0xff & input[0]);
 		int rIndex = 1;		// read index of input buffer.
@@ -284,6 +328,223 @@ namespace skulltag {
 			bitsAvailable--;	// decrement total bits left
 		}
 
+		return wIndex;
+	} // end function decodeBitwise
+
+	/** Encodes data read from an input buffer and stores the result in the output buffer. <br>
+	 * The codes are looked up in encodeCodes and collected in a 64 bit accumulator, whole bytes are written out at once.
+	 * @return number of bytes stored in the output buffer or -1 if an error occurs while encoding. */
+	int HuffmanCodec::encode(
+		unsigned char const * const input,	/**< in: pointer to the first byte to encode. */
+		unsigned char * const output,		/**< out: pointer to an output buffer to store data. */
+		int const &inLength,				/**< in: number of bytes of input buffer to encoded. */
+		int const &outLength				/**< in: maximum length of data to output. */
+	) const {
+		EncodeSegment segment = { input, inLength, 0, 0 };
+		return encodeSegments( &segment, 1, output, outLength );
+	} // end function encode
+
+	/** Stores the Huffman codes of a block of data in stream order, 32 bits per word.
+	 * @return number of bits stored or -1 if a value has no code or maxWords is too small. */
+	int HuffmanCodec::precomputeCodes(
+		unsigned char const * const input,	/**< in: pointer to the first byte to encode. */
+		int const &inLength,				/**< in: number of bytes of input buffer to encoded. */
+		unsigned int * const codes,			/**< out: receives the codes, inLength + 1 words are always enough. */
+		int const &maxWords					/**< in: number of words codes can hold. */
+	) const {
+		unsigned long long bits = 0;	// pending bits, the first one being the least significant.
+		int bitCount = 0;				// number of pending bits.
+		int wordCount = 0;				// number of words stored in codes.
+
+		for ( int i = 0; i < inLength; i++ ){
+			int const value = 0xff & input[i];
+			if ( encodeBitCounts[value] == 0 ) return -1;
+			bits |= (unsigned long long)encodeCodes[value] << bitCount;
+			bitCount += encodeBitCounts[value];
+
+			if ( bitCount >= 32 ){
+				if ( wordCount >= maxWords ) return -1;
+				codes[wordCount++] = (unsigned int)bits;
+				bits >>= 32;
+				bitCount -= 32;
+			}
+		}
+
+		if ( bitCount > 0 ){
+			if ( wordCount >= maxWords ) return -1;
+			codes[wordCount++] = (unsigned int)bits;
+		}
+		return ( (wordCount - (bitCount > 0 ? 1 : 0)) << 5 ) + bitCount;
+	} // end function precomputeCodes
+
+	/** Counts the bits the Huffman codes of a block of data take, without encoding it.
+	 * @return number of bits or -1 if a value has no code. */
+	int HuffmanCodec::codeBitCount(
+		unsigned char const * const input,	/**< in: pointer to the first byte to count. */
+		int const &inLength					/**< in: number of bytes of input buffer to count. */
+	) const {
+		int bitCount = 0;
+
+		for ( int i = 0; i < inLength; i++ ){
+			int const value = 0xff & input[i];
+			if ( encodeBitCounts[value] == 0 ) return -1;
+			bitCount += encodeBitCounts[value];
+		}
+		return bitCount;
+	} // end function codeBitCount
+
+	/** Encodes the concatenation of several segments exactly like encode() encodes the concatenated data.
+	 * @return number of bytes stored in the output buffer or -1 if an error occurs while encoding. */
+	int HuffmanCodec::encodeSegments(
+		EncodeSegment const * const segments,	/**< in: the segments in the order they are encoded. */
+		int const &segmentCount,				/**< in: number of segments. */
+		unsigned char * const output,			/**< out: pointer to an output buffer to store data. */
+		int const &outLength					/**< in: maximum length of data to output. */
+	) const {
+		int inLength = 0;
+		for ( int s = 0; s < segmentCount; s++ ) inLength += segments[s].length;
+
+		// if not expandable Limit output to input length.
+		int const maxBytes = ( expandable || ((inLength + 1) >= outLength) ) ? outLength : inLength + 1;
+		// Without room for the padding signal, empty input yields no output like in encodeBitwise(), that isn't an error.
+		if ( (output == 0) || (maxBytes < 1) ) return ( inLength == 0 ) ? 0 : -1;
+
+		unsigned long long bits = 0;	// pending bits, the first one being the least significant.
+		int bitCount = 0;				// number of pending bits, always less than 8 between codes.
+		int wIndex = 1;					// write index, output[0] holds the padding signal.
+
+		for ( int s = 0; s < segmentCount; s++ ){
+			EncodeSegment const &segment = segments[s];
+
+			if ( segment.codes != 0 ){
+				// Append the precomputed codes a word at a time, the unused bits of the last word are zero.
+				for ( int bit = 0; bit < segment.codeBits; bit += 32 ){
+					bits |= (unsigned long long)segment.codes[bit >> 5] << bitCount;
+					bitCount += ( segment.codeBits - bit < 32 ) ? segment.codeBits - bit : 32;
+
+					while ( bitCount >= 8 ){
+						if ( wIndex >= maxBytes ) return -1;
+						output[wIndex++] = reverseBits ? (unsigned char)bits : reverseMap[ bits & 0xff ];
+						bits >>= 8;
+						bitCount -= 8;
+					}
+				}
+				continue;
+			}
+
+			unsigned char const * const data = segment.data;
+			int const length = segment.length;
+			for ( int i = 0; i < length; i++ ){
+				int const value = 0xff & data[i];
+				if ( encodeBitCounts[value] == 0 ) return -1;
+				bits |= (unsigned long long)encodeCodes[value] << bitCount;
+				bitCount += encodeBitCounts[value];
+
+				// Write all complete bytes.
+				while ( bitCount >= 8 ){
+					if ( wIndex >= maxBytes ) return -1;
+					// The stream order matches the reversed byte order (Old Huffman Compatibility Mode).
+					output[wIndex++] = reverseBits ? (unsigned char)bits : reverseMap[ bits & 0xff ];
+					bits >>= 8;
+					bitCount -= 8;
+				}
+			}
+		}
+
+		// Pad the last byte with zeros.
+		int const padding = (8 - bitCount) & 7;
+		if ( bitCount > 0 ){
+			if ( wIndex >= maxBytes ) return -1;
+			output[wIndex++] = reverseBits ? (unsigned char)bits : reverseMap[ bits & 0xff ];
+		}
+
+		// write padding signal byte to begining of stream.
+		output[0] = (unsigned char)padding;
+		return wIndex;
+	} // end function encodeSegments
+
+	/** Decodes data read from an input buffer and stores the result in the output buffer. <br>
+	 * Every lookup in decodeTable resolves decodeTableBits bits, which can yield up to maxValuesPerEntry values.
+	 * Only codes longer than decodeTableBits are finished by walking the tree.
+	 * @return number of bytes stored in the output buffer or -1 if an error occurs while decoding. */
+	int HuffmanCodec::decode(
+		unsigned char const * const input,	/**< in: pointer to data that needs decoding. */
+		unsigned char * const output,		/**< out: pointer to output buffer to store decoded data. */
+		int const &inLength,				/**< in: number of bytes of input buffer to read. */
+		int const &outLength				/**< in: maximum length of data to output. */
+	){
+		if ( inLength < 1 ) return 0;
+		int bitsAvailable = ((inLength-1) << 3) - (0xff & input[0]);
+		unsigned char const * in = input + 1;		// next byte to read.
+		unsigned char const * const inEnd = input + inLength;
+		unsigned long long bits = 0;	// buffered bits, the next one being the least significant.
+		int bitCount = 0;				// number of buffered bits.
+		int wIndex = 0;					// write index of output buffer.
+		int const tableMask = (1 << decodeTableBits) - 1;
+
+		while ( bitsAvailable > 0 ){
+			// Refill the bit buffer.
+			while ( (bitCount <= 56) && (in < inEnd) ){
+				unsigned char const byte = *in++;
+				bits |= (unsigned long long)( reverseBits ? byte : reverseMap[ byte ] ) << bitCount;
+				bitCount += 8;
+			}
+
+			DecodeEntry const &entry = decodeTable[ bits & tableMask ];
+
+			if ( entry.valueCount == 0 ){
+				// The code is longer than the table bits, or the stream ends in the middle of it.
+				if ( (entry.node == 0) || (bitsAvailable <= decodeTableBits) ) return wIndex;
+				bits >>= decodeTableBits;
+				bitCount -= decodeTableBits;
+				bitsAvailable -= decodeTableBits;
+
+				// Walk the rest of the code one bit at a time.
+				HuffmanNode const * node = entry.node;
+				while ( node->branch != 0 ){
+					if ( bitsAvailable <= 0 ) return wIndex;
+					if ( bitCount <= 0 ){
+						bits = reverseBits ? *in : reverseMap[ *in ];
+						in++;
+						bitCount = 8;
+					}
+					node = &(node->branch[ bits & 1 ]);
+					bits >>= 1;
+					bitCount--;
+					bitsAvailable--;
+				}
+
+				// buffer overflow prevention
+				if ( wIndex >= outLength ) return wIndex;
+				output[ wIndex++ ] = (unsigned char)(node->value & 0xff);
+				continue;
+			}
+
+			// Fast path: all values lie within the stream and fit into the output buffer.
+			if ( (bitsAvailable >= decodeTableBits) && (wIndex + maxValuesPerEntry <= outLength) ){
+				for ( int i = 0; i < maxValuesPerEntry; i++ ) output[ wIndex + i ] = entry.values[i];
+				wIndex += entry.valueCount;
+				int const used = entry.bitEnds[entry.valueCount - 1];
+				bits >>= used;
+				bitCount -= used;
+				bitsAvailable -= used;
+				continue;
+			}
+
+			// Output the values, but only those that are completely within the stream.
+			for ( int i = 0; i < entry.valueCount; i++ ){
+				if ( entry.bitEnds[i] > bitsAvailable ) return wIndex;
+				// buffer overflow prevention
+				if ( wIndex >= outLength ) return wIndex;
+				output[ wIndex++ ] = entry.values[i];
+			}
+
+			int const used = entry.bitEnds[entry.valueCount - 1];
+			bits >>= used;
+			bitCount -= used;
+			bitsAvailable -= used;
+		}
+
 		return wIndex;
 	} // end function decode
 
@@ -301,6 +562,7 @@ namespace skulltag {
 	/** Destructor - frees resources. */
 	HuffmanCodec::~HuffmanCodec() {
 		delete writer;
+		delete[] decodeTable;
 		//check for resource ownership before deletion
 		if ( huffmanResourceOwner() ){
 			delete[] codeTable;
@@ -67,6 +67,30 @@ namespace skulltag {
 		/** Number of bits the shortest huffman code in the tree has. */
 		int shortestCode;	
 
+		/** Number of bits resolved by a single lookup in the decoding table. */
+		static int const decodeTableBits = 11;
+
+		/** Maximum number of values a single decoding table entry can hold. */
+		static int const maxValuesPerEntry = 3;
+
+		/** Describes what the next decodeTableBits bits of a stream decode to. <br>
+		 * The bits are taken in stream order, the first bit of the stream being the least significant bit of the index. */
+		struct DecodeEntry {
+			unsigned char valueCount;					/**< number of complete codes within the bits, 0 if the first code is longer than decodeTableBits. */
+			unsigned char values[maxValuesPerEntry];	/**< the decoded values. */
+			unsigned char bitEnds[maxValuesPerEntry];	/**< number of bits used up after decoding each of the values. */
+			HuffmanNode const * node;					/**< tree node reached after decodeTableBits bits if valueCount is 0, NULL if the tree is corrupt. */
+		};
+
+		/** table of 2^decodeTableBits entries used for decoding several bits at once. */
+		DecodeEntry * decodeTable;
+
+		/** Huffman codes of all byte values in stream order (first bit is the least significant one). */
+		unsigned int encodeCodes[256];
+
+		/** Bit lengths of the codes in encodeCodes, 0 if a value has no code. */
+		unsigned char encodeBitCounts[256];
+
 	public:	
 
 		/** Creates a new HuffmanCodec from the Huffman tree data.
@@ -104,6 +128,61 @@ namespace skulltag {
 			int const &outLength				/**< in: maximum length of data to output. */
 		);
 
+		/** Encodes data like encode(), but writes the codes one at a time through the BitWriter. <br>
+		 * Produces the same output as encode(), kept as reference implementation for verification and benchmarking.
+		 * @return number of bytes stored in the output buffer or -1 if an error occurs while encoding. */
+		int encodeBitwise(
+			unsigned char const * const input,	/**< in: pointer to the first byte to encode. */
+			unsigned char * const output,		/**< out: pointer to an output buffer to store data. */
+			int const &inLength,				/**< in: number of bytes of input buffer to encoded. */
+			int const &outLength				/**< in: maximum length of data to output. */
+		) const;
+
+		/** Decodes data like decode(), but walks the Huffman tree one bit at a time. <br>
+		 * Produces the same output as decode(), kept as reference implementation for verification and benchmarking.
+		 * @return number of bytes stored in the output buffer or -1 if an error occurs while decoding. */
+		int decodeBitwise(
+			unsigned char const * const input,	/**< in: pointer to data that needs decoding. */
+			unsigned char * const output,		/**< out: pointer to output buffer to store decoded data. */
+			int const &inLength,				/**< in: number of bytes of input buffer to read. */
+			int const &outLength				/**< in: maximum length of data to output. */
+		) const;
+
+		/** A block of data encoded by encodeSegments(). */
+		struct EncodeSegment {
+			unsigned char const * data;		/**< pointer to the first byte of the segment. */
+			int length;						/**< number of bytes in the segment. */
+			unsigned int const * codes;		/**< codes of the data as computed by precomputeCodes() or NULL (0) to encode data. */
+			int codeBits;					/**< number of bits in codes. */
+		};
+
+		/** Stores the Huffman codes of a block of data in stream order, 32 bits per word, so that
+		 * encodeSegments() can reuse them. Unused bits of the last word are zero.
+		 * @return number of bits stored or -1 if a value has no code or maxWords is too small. */
+		int precomputeCodes(
+			unsigned char const * const input,	/**< in: pointer to the first byte to encode. */
+			int const &inLength,				/**< in: number of bytes of input buffer to encoded. */
+			unsigned int * const codes,			/**< out: receives the codes, inLength + 1 words are always enough. */
+			int const &maxWords					/**< in: number of words codes can hold. */
+		) const;
+
+		/** Counts the bits the Huffman codes of a block of data take, without encoding it.
+		 * @return number of bits or -1 if a value has no code. */
+		int codeBitCount(
+			unsigned char const * const input,	/**< in: pointer to the first byte to count. */
+			int const &inLength					/**< in: number of bytes of input buffer to count. */
+		) const;
+
+		/** Encodes the concatenation of several segments exactly like encode() encodes the concatenated data. <br>
+		 * The codes of segments with precomputed codes are copied instead of being looked up again.
+		 * @return number of bytes stored in the output buffer or -1 if an error occurs while encoding. */
+		int encodeSegments(
+			EncodeSegment const * const segments,	/**< in: the segments in the order they are encoded. */
+			int const &segmentCount,				/**< in: number of segments. */
+			unsigned char * const output,			/**< out: pointer to an output buffer to store data. */
+			int const &outLength					/**< in: maximum length of data to output. */
+		) const;
+
 		/** Enables or Disables backwards bit ordering of bytes.
 		 * @param backwards  "true" enables reversed bit order bytes, "false" uses standard byte bit ordering. */
 		void reversedBytes( bool backwards );
@@ -176,6 +255,9 @@ namespace skulltag {
 		/** Perform initialization procedures common to all constructors. */
 		void init();
 
+		/** Builds the encoding and decoding tables from the Huffman tree. */
+		void buildTables();
+
 	}; // end class Huffman Codec.
 } // end namespace skulltag
 
@@ -89,6 +89,11 @@ void HUFFMAN_Construct(){
 	atterm( HUFFMAN_Destruct );
 }
 
+/** Returns the HuffmanCodec used by HUFFMAN_Encode and HUFFMAN_Decode, NULL before HUFFMAN_Construct(). */
+skulltag::HuffmanCodec * HUFFMAN_GetCodec(){
+	return __codec;
+}
+
 /** Releases resources allocated by the HuffmanCodec. */
 void HUFFMAN_Destruct(){
 	delete __codec;
@@ -129,6 +134,46 @@ void HUFFMAN_Encode(
 	}
 } // end function HUFFMAN_Encode
 
+/** Applies Huffman encoding to the concatenation of several blocks of data, see HuffmanCodec::encodeSegments. */
+void HUFFMAN_EncodeSegments(
+	/** in: The blocks of data in the order they are to be encoded. */
+	skulltag::HuffmanCodec::EncodeSegment const * const segments,
+	/** in: Number of blocks in segments. */
+	int const &segmentCount,
+	/** out: Pointer to destination buffer where encoded data will be stored. */
+	unsigned char * const outputBuffer,
+	/**< in+out: Max chars to write into outputBuffer. <br>
+	 * 		Upon return holds the number of chars stored or 0 if an error occurs. */
+	int * outputBufferSize
+){
+	int bytesWritten = __codec->encodeSegments( segments, segmentCount, outputBuffer, *outputBufferSize );
+
+	// expansion occured -- provide backwards compatibility
+	if ( bytesWritten < 0 ){
+		int inputBufferSize = 0;
+		for ( int i = 0; i < segmentCount; i++ ) inputBufferSize += segments[i].length;
+
+		// check buffer sizes
+		if ( *outputBufferSize < (inputBufferSize + 1) ){
+			// outputBuffer too small, return "no bytes written"
+			*outputBufferSize = 0;
+			return;
+		}
+
+		// perform the unencoded copy
+		unsigned char * output = outputBuffer + 1;
+		for ( int i = 0; i < segmentCount; i++ ){
+			for ( int j = 0; j < segments[i].length; j++ ) *output++ = segments[i].data[j];
+		}
+		// supply the "unencoded" signal and bytesWritten
+		outputBuffer[0] = 0xff;
+		*outputBufferSize = inputBufferSize + 1;
+	} else {
+		// assign the bytesWritten return value
+		*outputBufferSize = bytesWritten;
+	}
+} // end function HUFFMAN_EncodeSegments
+
 /** Decodes a block of data that is Huffman encoded. */
 void HUFFMAN_Decode(
 	unsigned char const * const inputBuffer,	/**< in: Pointer to start of data that is to be decoded. */
@@ -36,6 +36,9 @@ void HUFFMAN_Construct();
 /** Releases resources allocated by the HuffmanCodec. */
 void HUFFMAN_Destruct();
 
+/** Returns the HuffmanCodec used by HUFFMAN_Encode and HUFFMAN_Decode, NULL before HUFFMAN_Construct(). */
+skulltag::HuffmanCodec * HUFFMAN_GetCodec();
+
 /** Applies Huffman encoding to a block of data. */
 void HUFFMAN_Encode(
 	unsigned char const * const inputBuffer,	/**< in: Pointer to start of data that is to be encoded. */
@@ -44,6 +47,14 @@ void HUFFMAN_Encode(
 	int *outputBufferSize						/**< in+out: Max chars to write into outputBuffer. Upon return holds the number of chars stored or 0 if an error occurs. */
 );
 
+/** Applies Huffman encoding to the concatenation of several blocks of data, see HuffmanCodec::encodeSegments. */
+void HUFFMAN_EncodeSegments(
+	skulltag::HuffmanCodec::EncodeSegment const * const segments,	/**< in: The blocks of data in the order they are to be encoded. */
+	int const &segmentCount,									/**< in: Number of blocks in segments. */
+	unsigned char * const outputBuffer,							/**< out: Pointer to destination buffer where encoded data will be stored. */
+	int *outputBufferSize										/**< in+out: Max chars to write into outputBuffer. Upon return holds the number of chars stored or 0 if an error occurs. */
+);
+
 /** Decodes a block of data that is Huffman encoded. */
 void HUFFMAN_Decode(
 	unsigned char const * const inputBuffer,	/**< in: Pointer to start of data that is to be decoded. */
@@ -60,12 +60,18 @@
 #endif
 #endif
 
+// recvmmsg/sendmmsg allow to receive and send several datagrams with one system call.
+#if defined ( __linux__ ) && !defined ( NO_BATCHED_PACKETIO )
+#define NETWORK_HAVE_MMSG
+#endif
+
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
 
 #include <ctype.h>
 #include <math.h>
+#include <atomic>
 #include <set>
 #include "../GeoIP/GeoIP.h"
 
@@ -91,6 +97,10 @@
 
 #include "md5.h"
 #include "network/sv_auth.h"
+#include "network/hashcache.h"
+#include "stats.h"
+#include "network/packetsegments.h"
+#include "network/workerpool.h"
 #include "doomerrors.h"
 
 enum LumpAuthenticationMode {
@@ -205,6 +215,140 @@ extern int restart;
 // [AK] Did we need to authenticate a lump that has a duplicate?
 static bool g_bDuplicateLumpAuthenticated = false;
 
+// The biggest encoded datagram NETWORK_GetPackets accepts.
+#define	MAX_ENCODED_PACKET	(( MAX_UDP_PACKET * 8 ) / 3 )
+
+// Number of datagrams that can be received or sent with a single system call.
+#define	NETWORK_BATCH_SIZE	32
+
+// The most threads sv_packetthreads can start.
+#define	MAX_PACKET_THREADS	16
+
+// Counters for the netiostats CCMD.
+struct NETIOSTATS_s
+{
+	QWORD	qwReceiveCalls;
+	QWORD	qwPacketsReceived;
+	QWORD	qwSendCalls;
+	QWORD	qwPacketsSent;
+	QWORD	qwBytesEncoded;
+	QWORD	qwSharedBytesEncoded;
+	int		iStartTic;
+};
+
+static	NETIOSTATS_s	g_NetIOStats;
+
+// The parts of a packet that contains shared segments, see NETWORK_LaunchPacket.
+static	TArray<skulltag::HuffmanCodec::EncodeSegment>	g_EncodeSegments;
+
+#ifdef NETWORK_HAVE_MMSG
+// An outgoing, already Huffman-encoded datagram waiting for NETWORK_FlushPacketBatch.
+struct BATCHEDPACKET_s
+{
+	UCHAR			aucData[MAX_UDP_PACKET + 1];
+	const UCHAR		*pucData;	// aucData or a packet kept by the caller, see NETWORK_SendEncodedPacket.
+	int				iSize;
+	NETADDRESS_s	Address;
+	sockaddr_in		SocketAddress;
+};
+
+// Set to false if the kernel doesn't support recvmmsg/sendmmsg. The packet workers
+// read it while sending, so it's atomic.
+static	std::atomic<bool>	g_bBatchIOAvailable( true );
+
+// Ring of datagrams read by the last recvmmsg call. NETWORK_GetPackets hands
+// them out one by one before the socket is read again.
+static	UCHAR			g_aucReceiveRing[NETWORK_BATCH_SIZE][MAX_ENCODED_PACKET + 1];
+static	sockaddr		g_aReceiveAddresses[NETWORK_BATCH_SIZE];
+static	struct iovec	g_aReceiveIOVecs[NETWORK_BATCH_SIZE];
+static	struct mmsghdr	g_aReceiveHeaders[NETWORK_BATCH_SIZE];
+static	ULONG			g_ulReceiveRingCount = 0;
+static	ULONG			g_ulReceiveRingPos = 0;
+
+// Outgoing datagrams collected between NETWORK_BeginPacketBatch and NETWORK_FlushPacketBatch.
+static	BATCHEDPACKET_s	g_aSendBatch[NETWORK_BATCH_SIZE];
+static	struct iovec	g_aSendIOVecs[NETWORK_BATCH_SIZE];
+static	struct mmsghdr	g_aSendHeaders[NETWORK_BATCH_SIZE];
+static	ULONG			g_ulSendBatchCount = 0;
+#endif
+
+// Is a packet batch opened by NETWORK_BeginPacketBatch active?
+static	bool			g_bPacketBatchActive = false;
+
+// If enabled, datagrams are received and sent in batches where supported.
+CVAR( Bool, net_batchpacketio, true, CVAR_ARCHIVE )
+
+// A packet launched during a batch that is Huffman-encoded and sent by the packet workers.
+struct DEFERREDPACKET_s
+{
+	BYTE			abData[MAX_UDP_PACKET];
+	ULONG			ulSize;
+	bool			bEncode;
+	bool			bAlreadyEncoded;
+
+	// The parts of abData as built by network_BuildEncodeSegments, empty if the whole
+	// packet is encoded. The codes of the shared parts are copied to Codes.
+	TArray<skulltag::HuffmanCodec::EncodeSegment>	Parts;
+	TArray<unsigned int>	Codes;
+
+	// The packet is encoded to pucEncoded, which is either aucEncoded or a buffer of the caller
+	// that also gets the size. Packets that are already encoded are sent from pucEncoded.
+	UCHAR			aucEncoded[MAX_UDP_PACKET + 1];
+	UCHAR			*pucEncoded;
+	int				iEncodedSize;
+	int				*piEncodedSize;
+
+	NETADDRESS_s	Address;
+	sockaddr_in		SocketAddress;
+
+	// Set by the worker: the number of bytes sent, or -1 and the socket error.
+	LONG			lBytesSent;
+	int				iError;
+};
+
+// What one worker job did with its share of the deferred packets.
+struct DEFERREDGROUP_s
+{
+	ULONG			ulSendCalls;
+	bool			bBatchIOFailed;
+};
+
+// Packets deferred since NETWORK_BeginPacketBatch. The array only grows, the first
+// g_ulNumDeferredPackets entries are in use.
+static	TArray<DEFERREDPACKET_s *>	g_DeferredPackets;
+static	ULONG			g_ulNumDeferredPackets = 0;
+static	TArray<DEFERREDGROUP_s>	g_DeferredGroups;
+static	ULONG			g_ulDeferredGroupSize = 0;
+
+// Threads that encode and send the deferred packets, see sv_packetthreads.
+static	WorkerPool		g_PacketWorkers;
+
+// Are the packet workers still busy with the packets of the last batch?
+static	bool			g_bPacketWorkersBusy = false;
+
+// Number of threads that Huffman-encode and send the packets of a tic in parallel. If 0,
+// the main thread does it.
+CUSTOM_CVAR( Int, sv_packetthreads, 0, CVAR_ARCHIVE|CVAR_NOSETBYACS )
+{
+	if ( self < 0 )
+	{
+		self = 0;
+		return;
+	}
+
+	if ( self > MAX_PACKET_THREADS )
+	{
+		self = MAX_PACKET_THREADS;
+		return;
+	}
+
+	NETWORK_WaitForPacketWorkers( );
+	g_PacketWorkers.Resize( self );
+}
+
+// File that all sent and received packets are written to, see net_capturepackets.
+static	FILE			*g_PacketCaptureFile = NULL;
+
 // [TP] Named ACS scripts share the name pool with all other names in the engine, which means named script numbers may
 // differ wildly between systems, e.g. if the server and client have different vid_renderer values the names will
 // already be off. So we create a special index of script names here.
@@ -219,6 +363,19 @@ static	SOCKET			network_AllocateSocket( void );
 static	bool			network_BindSocketToPort( SOCKET Socket, ULONG ulInAddr, USHORT usPort, bool bReUse );
 static	bool			network_GenerateLumpMD5HashAndWarnIfNeeded( const int LumpNum, const char *LumpName, FString &MD5Hash );
 static	void			network_CheckIfDuplicateLump( const int LumpNum ); // [AK]
+static	LONG			network_ProcessReceivedPacket( const UCHAR *pucData, LONG lNumBytes, const sockaddr &SocketFrom );
+static	void			network_SendDatagram( const UCHAR *pucData, int iSize, const NETADDRESS_s &Address, const sockaddr_in &SocketAddress );
+static	void			network_HandleSendError( const NETADDRESS_s &Address, int iError );
+static	int				network_GetLastSocketError( void );
+static	void			network_CapturePacket( const BYTE *pbData, ULONG ulSize );
+static	size_t			network_BuildEncodeSegments( const NETBUFFER_s *pBuffer, const PacketSegmentList &Segments, ULONG ulSegmentOffset );
+static	int				network_EncodePacket( const NETBUFFER_s *pBuffer, const PacketSegmentList *pSegments, ULONG ulSegmentOffset, UCHAR *pucOutput, int iOutputSize );
+static	DEFERREDPACKET_s	*network_NewDeferredPacket( const NETADDRESS_s &Address, const sockaddr_in &SocketAddress );
+static	void			network_DeferPacket( const NETBUFFER_s *pBuffer, const NETADDRESS_s &Address, const sockaddr_in &SocketAddress, bool bEncode, const PacketSegmentList *pSegments, ULONG ulSegmentOffset, UCHAR *pucEncoded, int *piEncodedSize );
+#ifdef NETWORK_HAVE_MMSG
+static	void			network_AddToSendBatch( const UCHAR *pucData, int iSize, const NETADDRESS_s &Address, const sockaddr_in &SocketAddress );
+#endif
+static	void			network_SendDeferredPackets( unsigned int uiGroup );
 
 //*****************************************************************************
 //	FUNCTIONS
@@ -654,6 +811,7 @@ void NETWORK_Construct( USHORT usPort, bool bAllocateLANSocket )
 	// [RC/BB] Init the list of PWADs.
 	// [SB] Moved this here so that WADs containing maps are correctly marked as authenticated.
 	network_InitPWADList( );
+	HASHCACHE_ReportAndSave( );
 
 	// Call NETWORK_Destruct() when Skulltag closes.
 	atterm( NETWORK_Destruct );
@@ -669,6 +827,8 @@ void NETWORK_Construct( USHORT usPort, bool bAllocateLANSocket )
 //
 void NETWORK_Destruct( void )
 {
+	NETWORK_WaitForPacketWorkers( );
+
 	// Free the network message buffer.
 	g_NetworkMessage.Free();
 
@@ -685,7 +845,6 @@ void NETWORK_Destruct( void )
 int NETWORK_GetPackets( void )
 {
 	LONG				lNumBytes;
-	INT					iDecodedNumBytes = sizeof(g_ucHuffmanBuffer);
 	sockaddr			SocketFrom;
 	INT					iSocketFromLength;
 
@@ -695,11 +854,72 @@ int NETWORK_GetPackets( void )
 	if ( g_NetworkSocket == INVALID_SOCKET )
 		return ( 0 );
 
+#ifdef NETWORK_HAVE_MMSG
+	// Datagrams still left in the ring are handed out even if batching was just disabled.
+	if (( net_batchpacketio && g_bBatchIOAvailable ) || ( g_ulReceiveRingPos < g_ulReceiveRingCount ))
+	{
+		// Refill the ring once all previously received datagrams have been handed out.
+		if ( g_ulReceiveRingPos >= g_ulReceiveRingCount )
+		{
+			g_ulReceiveRingPos = g_ulReceiveRingCount = 0;
+
+			for ( ULONG ulIdx = 0; ulIdx < NETWORK_BATCH_SIZE; ulIdx++ )
+			{
+				g_aReceiveIOVecs[ulIdx].iov_base = g_aucReceiveRing[ulIdx];
+				g_aReceiveIOVecs[ulIdx].iov_len = sizeof( g_aucReceiveRing[ulIdx] );
+				memset( &g_aReceiveHeaders[ulIdx], 0, sizeof( g_aReceiveHeaders[ulIdx] ));
+				g_aReceiveHeaders[ulIdx].msg_hdr.msg_name = &g_aReceiveAddresses[ulIdx];
+				g_aReceiveHeaders[ulIdx].msg_hdr.msg_namelen = sizeof( g_aReceiveAddresses[ulIdx] );
+				g_aReceiveHeaders[ulIdx].msg_hdr.msg_iov = &g_aReceiveIOVecs[ulIdx];
+				g_aReceiveHeaders[ulIdx].msg_hdr.msg_iovlen = 1;
+			}
+
+			const int iNumPackets = recvmmsg( g_NetworkSocket, g_aReceiveHeaders, NETWORK_BATCH_SIZE, MSG_DONTWAIT, NULL );
+			g_NetIOStats.qwReceiveCalls++;
+
+			if ( iNumPackets == -1 )
+			{
+				if (( errno == EWOULDBLOCK ) || ( errno == ECONNREFUSED ))
+					return ( 0 );
+
+				// The kernel doesn't support recvmmsg, use recvfrom from now on.
+				if ( errno == ENOSYS )
+				{
+					Printf( "NETWORK_GetPackets: Batched packet I/O is not supported, falling back to single packets.\n" );
+					g_bBatchIOAvailable = false;
+					return ( 0 );
+				}
+
+				Printf( "NETWORK_GetPackets: WARNING!: Error #%d: %s\n", errno, strerror( errno ));
+				return ( 0 );
+			}
+
+			g_ulReceiveRingCount = iNumPackets;
+		}
+
+		while ( g_ulReceiveRingPos < g_ulReceiveRingCount )
+		{
+			const ULONG ulSlot = g_ulReceiveRingPos++;
+
+			// Oversized datagrams don't fit into a slot and are ignored.
+			if ( g_aReceiveHeaders[ulSlot].msg_hdr.msg_flags & MSG_TRUNC )
+				continue;
+
+			lNumBytes = network_ProcessReceivedPacket( g_aucReceiveRing[ulSlot], g_aReceiveHeaders[ulSlot].msg_len, g_aReceiveAddresses[ulSlot] );
+			if ( lNumBytes > 0 )
+				return ( lNumBytes );
+		}
+
+		return ( 0 );
+	}
+#endif
+
 #ifdef	WIN32
 	lNumBytes = recvfrom( g_NetworkSocket, (char *)g_ucHuffmanBuffer, sizeof( g_ucHuffmanBuffer ), 0, &SocketFrom, &iSocketFromLength );
 #else
 	lNumBytes = recvfrom( g_NetworkSocket, (char *)g_ucHuffmanBuffer, sizeof( g_ucHuffmanBuffer ), 0, &SocketFrom, (socklen_t *)&iSocketFromLength );
 #endif
+	g_NetIOStats.qwReceiveCalls++;
 
 	// If the number of bytes returned is -1, an error has occured.
 	if ( lNumBytes == -1 ) 
@@ -738,6 +958,19 @@ int NETWORK_GetPackets( void )
 	if ( lNumBytes <= 0 )
 		return ( 0 );
 
+	return ( network_ProcessReceivedPacket( g_ucHuffmanBuffer, lNumBytes, SocketFrom ));
+}
+
+//*****************************************************************************
+//
+// Decodes a datagram that was read from the game socket into g_NetworkMessage.
+// Returns the decoded size or 0 if the datagram was ignored.
+static LONG network_ProcessReceivedPacket( const UCHAR *pucData, LONG lNumBytes, const sockaddr &SocketFrom )
+{
+	INT					iDecodedNumBytes = g_NetworkMessage.ulMaxSize;
+
+	g_NetIOStats.qwPacketsReceived++;
+
 	// Record this for our statistics window.
 	if ( NETWORK_GetState( ) == NETSTATE_SERVER )
 		SERVER_STATISTIC_AddToInboundDataTransfer( lNumBytes );
@@ -753,14 +986,14 @@ int NETWORK_GetPackets( void )
 	// [BB] Communication with the auth server is not Huffman-encoded.
 	if ( g_AddressFrom.Compare( NETWORK_AUTH_GetCachedServerAddress() ) == false )
 	{
-		HUFFMAN_Decode( g_ucHuffmanBuffer, (unsigned char *)g_NetworkMessage.pbData, lNumBytes, &iDecodedNumBytes );
+		HUFFMAN_Decode( pucData, (unsigned char *)g_NetworkMessage.pbData, lNumBytes, &iDecodedNumBytes );
 		g_NetworkMessage.ulCurrentSize = iDecodedNumBytes;
 	}
 	else
 	{
 		// [BB] We don't need to decode, so we just copy the data.
 		// Not very efficient, but this keeps the changes at a minimum for now.
-		memcpy ( g_NetworkMessage.pbData, g_ucHuffmanBuffer, lNumBytes );
+		memcpy ( g_NetworkMessage.pbData, pucData, lNumBytes );
 		g_NetworkMessage.ulCurrentSize = lNumBytes;
 	}
 	g_NetworkMessage.ByteStream.pbStream = g_NetworkMessage.pbData;
@@ -768,6 +1001,9 @@ int NETWORK_GetPackets( void )
 	g_NetworkMessage.ByteStream.bitBuffer = NULL;
 	g_NetworkMessage.ByteStream.bitShift = -1;
 
+	if ( g_PacketCaptureFile != NULL )
+		network_CapturePacket( g_NetworkMessage.pbData, g_NetworkMessage.ulCurrentSize );
+
 	return ( g_NetworkMessage.ulCurrentSize );
 }
 
@@ -869,9 +1105,14 @@ NETADDRESS_s NETWORK_GetFromAddress( void )
 
 //*****************************************************************************
 //
-void NETWORK_LaunchPacket( NETBUFFER_s *pBuffer, NETADDRESS_s Address )
+// pSegments may describe commands that are shared with other packets, their offsets are
+// relative to ulSegmentOffset. Their Huffman codes are reused instead of encoding them again.
+// If pucEncoded is given, the packet is encoded there (it needs room for one byte more than
+// the packet) and piEncodedSize gets its size, so that it can be sent again without encoding
+// it again. With packet workers, this only happens in NETWORK_WaitForPacketWorkers.
+void NETWORK_LaunchPacket( NETBUFFER_s *pBuffer, NETADDRESS_s Address, const PacketSegmentList *pSegments, ULONG ulSegmentOffset, UCHAR *pucEncoded, int *piEncodedSize )
 {
-	LONG				lNumBytes;
+	UCHAR				*pucOutput = g_ucHuffmanBuffer;
 	INT					iNumBytesOut = sizeof(g_ucHuffmanBuffer);
 
 	pBuffer->ulCurrentSize = pBuffer->CalcSize();
@@ -880,74 +1121,589 @@ void NETWORK_LaunchPacket( NETBUFFER_s *pBuffer, NETADDRESS_s Address )
 	if ( pBuffer->ulCurrentSize == 0 )
 		return;
 
+	if ( g_PacketCaptureFile != NULL )
+		network_CapturePacket( pBuffer->pbData, pBuffer->ulCurrentSize );
+
+	// Packets sent outside of a batch must not overtake the ones of the last batch.
+	if ( g_bPacketBatchActive == false )
+		NETWORK_WaitForPacketWorkers( );
+
+	if ( pucEncoded != NULL )
+	{
+		pucOutput = pucEncoded;
+		iNumBytesOut = pBuffer->ulCurrentSize + 1;
+	}
+
+#ifdef NETWORK_HAVE_MMSG
+	// If a batch is open, encode straight into the next free batch slot. The encoded
+	// packet is at most one byte bigger than the input, bigger packets are sent directly.
+	const bool bBatched = g_bPacketBatchActive && g_bBatchIOAvailable && ( pBuffer->ulCurrentSize < sizeof( g_aSendBatch[0].aucData ));
+	if ( bBatched && ( pucEncoded == NULL ))
+	{
+		pucOutput = g_aSendBatch[g_ulSendBatchCount].aucData;
+		iNumBytesOut = sizeof( g_aSendBatch[0].aucData );
+	}
+#endif
+
 	// Convert the IP address to a socket address.
 	struct sockaddr_in SocketAddress;
 	Address.ToSocketAddress( reinterpret_cast<sockaddr&>(SocketAddress) );
 
 	// [BB] Communication with the auth server is not Huffman-encoded.
-	if ( Address.Compare( NETWORK_AUTH_GetCachedServerAddress() ) == false )
-		HUFFMAN_Encode( (unsigned char *)pBuffer->pbData, g_ucHuffmanBuffer, pBuffer->ulCurrentSize, &iNumBytesOut );
+	const bool bEncode = ( Address.Compare( NETWORK_AUTH_GetCachedServerAddress() ) == false );
+
+	// During a batch, the packet workers encode and send the packets if there are any.
+	if ( g_bPacketBatchActive && ( g_PacketWorkers.GetNumThreads( ) > 0 ) && ( pBuffer->ulCurrentSize <= MAX_UDP_PACKET ))
+	{
+		network_DeferPacket( pBuffer, Address, SocketAddress, bEncode, pSegments, ulSegmentOffset, pucEncoded, piEncodedSize );
+		return;
+	}
+
+	if ( bEncode )
+		iNumBytesOut = network_EncodePacket( pBuffer, pSegments, ulSegmentOffset, pucOutput, iNumBytesOut );
 	else
 	{
 		// [BB] We don't need to encode, so we just copy the data.
 		// Not very efficient, but this keeps the changes at a minimum for now.
-		memcpy ( g_ucHuffmanBuffer, pBuffer->pbData, pBuffer->ulCurrentSize );
+		memcpy ( pucOutput, pBuffer->pbData, pBuffer->ulCurrentSize );
 		iNumBytesOut = pBuffer->ulCurrentSize;
 	}
 
-	lNumBytes = sendto( g_NetworkSocket, (const char*)g_ucHuffmanBuffer, iNumBytesOut, 0, reinterpret_cast<sockaddr*>(&SocketAddress), sizeof( SocketAddress ));
+	if ( piEncodedSize != NULL )
+		*piEncodedSize = iNumBytesOut;
 
-	// If sendto returns -1, there was an error.
-	if ( lNumBytes == -1 )
+#ifdef NETWORK_HAVE_MMSG
+	if ( bBatched )
 	{
-#ifdef __WIN32__
-		INT	iError = WSAGetLastError( );
+		network_AddToSendBatch( pucOutput, iNumBytesOut, Address, SocketAddress );
+		return;
+	}
+#endif
 
-		// Wouldblock is silent.
-		if ( iError == WSAEWOULDBLOCK )
-			return;
+	network_SendDatagram( pucOutput, iNumBytesOut, Address, SocketAddress );
+}
+
+//*****************************************************************************
+//
+// Sends a packet that was encoded by NETWORK_LaunchPacket before. The data
+// has to stay valid until the current packet batch is flushed.
+void NETWORK_SendEncodedPacket( const UCHAR *pucData, int iSize, NETADDRESS_s Address )
+{
+	if ( iSize <= 0 )
+		return;
+
+	// Packets sent outside of a batch must not overtake the ones of the last batch.
+	if ( g_bPacketBatchActive == false )
+		NETWORK_WaitForPacketWorkers( );
+
+	struct sockaddr_in SocketAddress;
+	Address.ToSocketAddress( reinterpret_cast<sockaddr&>(SocketAddress) );
+
+	if ( g_bPacketBatchActive && ( g_PacketWorkers.GetNumThreads( ) > 0 ))
+	{
+		DEFERREDPACKET_s *pPacket = network_NewDeferredPacket( Address, SocketAddress );
+		pPacket->bAlreadyEncoded = true;
+		pPacket->pucEncoded = const_cast<UCHAR *>( pucData );
+		pPacket->iEncodedSize = iSize;
+		return;
+	}
+
+#ifdef NETWORK_HAVE_MMSG
+	if ( g_bPacketBatchActive && g_bBatchIOAvailable )
+	{
+		network_AddToSendBatch( pucData, iSize, Address, SocketAddress );
+		return;
+	}
+#endif
+
+	network_SendDatagram( pucData, iSize, Address, SocketAddress );
+}
+
+//*****************************************************************************
+//
+static int network_EncodePacket( const NETBUFFER_s *pBuffer, const PacketSegmentList *pSegments, ULONG ulSegmentOffset, UCHAR *pucOutput, int iOutputSize )
+{
+	size_t sharedBytes = 0;
+	if (( pSegments != NULL ) && ( pSegments->IsEmpty( ) == false ))
+		sharedBytes = network_BuildEncodeSegments( pBuffer, *pSegments, ulSegmentOffset );
 
-		switch ( iError )
+	if ( sharedBytes > 0 )
+		HUFFMAN_EncodeSegments( &g_EncodeSegments[0], g_EncodeSegments.Size( ), pucOutput, &iOutputSize );
+	else
+		HUFFMAN_Encode( (unsigned char *)pBuffer->pbData, pucOutput, pBuffer->ulCurrentSize, &iOutputSize );
+
+	g_NetIOStats.qwBytesEncoded += pBuffer->ulCurrentSize;
+	g_NetIOStats.qwSharedBytesEncoded += sharedBytes;
+	return iOutputSize;
+}
+
+#ifdef NETWORK_HAVE_MMSG
+//*****************************************************************************
+//
+static void network_AddToSendBatch( const UCHAR *pucData, int iSize, const NETADDRESS_s &Address, const sockaddr_in &SocketAddress )
+{
+	BATCHEDPACKET_s *pBatchedPacket = &g_aSendBatch[g_ulSendBatchCount];
+
+	pBatchedPacket->pucData = pucData;
+	pBatchedPacket->iSize = iSize;
+	pBatchedPacket->Address = Address;
+	pBatchedPacket->SocketAddress = SocketAddress;
+
+	// The batch is full, send it and start a new one.
+	if ( ++g_ulSendBatchCount == NETWORK_BATCH_SIZE )
+	{
+		NETWORK_FlushPacketBatch( );
+		g_bPacketBatchActive = true;
+	}
+}
+#endif
+
+//*****************************************************************************
+//
+// Splits a packet into g_EncodeSegments: the parts that have to be encoded and the
+// shared segments whose codes are already known. Returns the number of bytes covered
+// by shared segments, g_EncodeSegments is only usable if that's not zero.
+static size_t network_BuildEncodeSegments( const NETBUFFER_s *pBuffer, const PacketSegmentList &Segments, ULONG ulSegmentOffset )
+{
+	skulltag::HuffmanCodec::EncodeSegment	Part;
+	const BYTE	*pbPacket = pBuffer->pbData;
+	const size_t	size = pBuffer->ulCurrentSize;
+	size_t		position = 0;
+	size_t		sharedBytes = 0;
+
+	g_EncodeSegments.Clear( );
+
+	for ( unsigned int i = 0; i < Segments.Size( ); ++i )
+	{
+		const SharedPacketSegment *pSegment = Segments.GetSegment( i );
+		const size_t start = ulSegmentOffset + Segments.GetOffset( i );
+
+		// Ignore entries that don't describe the current contents of the packet.
+		if (( start < position ) || ( start + pSegment->GetSize( ) > size )
+			|| ( memcmp( pbPacket + start, pSegment->GetData( ), pSegment->GetSize( )) != 0 ))
 		{
-		case WSAEACCES:
+			continue;
+		}
 
-			Printf( "NETWORK_LaunchPacket: Error #%d, WSAEACCES: Permission denied for address: %s\n", iError, Address.ToString() );
-			return;
-		case WSAEAFNOSUPPORT:
+		if ( start > position )
+		{
+			Part.data = pbPacket + position;
+			Part.length = static_cast<int> ( start - position );
+			Part.codes = NULL;
+			Part.codeBits = 0;
+			g_EncodeSegments.Push( Part );
+		}
+
+		Part.data = pbPacket + start;
+		Part.length = static_cast<int> ( pSegment->GetSize( ));
+		Part.codes = pSegment->GetCodes( );
+		Part.codeBits = pSegment->GetCodeBits( );
+		g_EncodeSegments.Push( Part );
+
+		position = start + pSegment->GetSize( );
+		sharedBytes += pSegment->GetSize( );
+	}
+
+	if (( sharedBytes > 0 ) && ( position < size ))
+	{
+		Part.data = pbPacket + position;
+		Part.length = static_cast<int> ( size - position );
+		Part.codes = NULL;
+		Part.codeBits = 0;
+		g_EncodeSegments.Push( Part );
+	}
+
+	return sharedBytes;
+}
+
+//*****************************************************************************
+//
+// Copies a packet for the packet workers. The shared segments may be released
+// before the workers get to the packet, so their codes are copied too.
+static DEFERREDPACKET_s *network_NewDeferredPacket( const NETADDRESS_s &Address, const sockaddr_in &SocketAddress )
+{
+	if ( g_ulNumDeferredPackets == g_DeferredPackets.Size( ))
+		g_DeferredPackets.Push( new DEFERREDPACKET_s );
+
+	DEFERREDPACKET_s *pPacket = g_DeferredPackets[g_ulNumDeferredPackets++];
+	pPacket->ulSize = 0;
+	pPacket->bEncode = false;
+	pPacket->bAlreadyEncoded = false;
+	pPacket->pucEncoded = pPacket->aucEncoded;
+	pPacket->iEncodedSize = 0;
+	pPacket->piEncodedSize = NULL;
+	pPacket->Address = Address;
+	pPacket->SocketAddress = SocketAddress;
+	pPacket->lBytesSent = 0;
+	pPacket->iError = 0;
+	pPacket->Parts.Clear( );
+	pPacket->Codes.Clear( );
+	return pPacket;
+}
+
+//*****************************************************************************
+//
+static void network_DeferPacket( const NETBUFFER_s *pBuffer, const NETADDRESS_s &Address, const sockaddr_in &SocketAddress, bool bEncode, const PacketSegmentList *pSegments, ULONG ulSegmentOffset, UCHAR *pucEncoded, int *piEncodedSize )
+{
+	DEFERREDPACKET_s *pPacket = network_NewDeferredPacket( Address, SocketAddress );
+	memcpy( pPacket->abData, pBuffer->pbData, pBuffer->ulCurrentSize );
+	pPacket->ulSize = pBuffer->ulCurrentSize;
+	pPacket->bEncode = bEncode;
+	pPacket->piEncodedSize = piEncodedSize;
+	if ( pucEncoded != NULL )
+		pPacket->pucEncoded = pucEncoded;
+
+	if ( bEncode == false )
+		return;
+
+	size_t sharedBytes = 0;
+	if (( pSegments != NULL ) && ( pSegments->IsEmpty( ) == false ))
+		sharedBytes = network_BuildEncodeSegments( pBuffer, *pSegments, ulSegmentOffset );
+
+	g_NetIOStats.qwBytesEncoded += pBuffer->ulCurrentSize;
+	g_NetIOStats.qwSharedBytesEncoded += sharedBytes;
+
+	if ( sharedBytes == 0 )
+		return;
+
+	unsigned int uiNumCodes = 0;
+	for ( unsigned int i = 0; i < g_EncodeSegments.Size( ); ++i )
+	{
+		if ( g_EncodeSegments[i].codes != NULL )
+			uiNumCodes += ( g_EncodeSegments[i].codeBits + 31 ) / 32;
+	}
+
+	pPacket->Codes.Resize( uiNumCodes );
+	uiNumCodes = 0;
+
+	for ( unsigned int i = 0; i < g_EncodeSegments.Size( ); ++i )
+	{
+		skulltag::HuffmanCodec::EncodeSegment Part = g_EncodeSegments[i];
+		Part.data = pPacket->abData + ( Part.data - pBuffer->pbData );
+
+		if ( Part.codes != NULL )
+		{
+			const unsigned int uiWords = ( Part.codeBits + 31 ) / 32;
+			memcpy( &pPacket->Codes[uiNumCodes], Part.codes, uiWords * sizeof( unsigned int ));
+			Part.codes = &pPacket->Codes[uiNumCodes];
+			uiNumCodes += uiWords;
+		}
+
+		pPacket->Parts.Push( Part );
+	}
+}
+
+//*****************************************************************************
+//
+// Encodes and sends one group of the deferred packets, called by the packet workers.
+// Anything that isn't thread-safe (statistics, error messages) is left to
+// NETWORK_WaitForPacketWorkers.
+static void network_SendDeferredPackets( unsigned int uiGroup )
+{
+	DEFERREDGROUP_s &Group = g_DeferredGroups[uiGroup];
+	ULONG ulFirst = uiGroup * g_ulDeferredGroupSize;
+	const ULONG ulEnd = MIN( ulFirst + g_ulDeferredGroupSize, g_ulNumDeferredPackets );
 
-			Printf( "NETWORK_LaunchPacket: Error #%d, WSAEAFNOSUPPORT: Address %s incompatible with the requested protocol\n", iError, Address.ToString() );
-			return;
-		case WSAEADDRNOTAVAIL:
+	Group.ulSendCalls = 0;
+	Group.bBatchIOFailed = false;
 
-			Printf( "NETWORK_LaunchPacket: Error #%d, WSAEADDRENOTAVAIL: Address %s not available\n", iError, Address.ToString() );
-			return;
-		case WSAEHOSTUNREACH:
+	for ( ULONG ulIdx = ulFirst; ulIdx < ulEnd; ulIdx++ )
+	{
+		DEFERREDPACKET_s *pPacket = g_DeferredPackets[ulIdx];
+		const int iSize = static_cast<int> ( pPacket->ulSize );
 
-			Printf( "NETWORK_LaunchPacket: Error #%d, WSAEHOSTUNREACH: Address %s unreachable\n", iError, Address.ToString() );
-			return;				
-		default:
+		if ( pPacket->bAlreadyEncoded )
+			continue;
 
-			Printf( "NETWORK_LaunchPacket: Error #%d\n", iError );
-			return;
+		pPacket->iEncodedSize = iSize + 1;
+		if ( pPacket->bEncode == false )
+		{
+			memcpy( pPacket->pucEncoded, pPacket->abData, pPacket->ulSize );
+			pPacket->iEncodedSize = iSize;
 		}
-#else
-	if ( errno == EWOULDBLOCK )
-return;
+		else if ( pPacket->Parts.Size( ) > 0 )
+			HUFFMAN_EncodeSegments( &pPacket->Parts[0], pPacket->Parts.Size( ), pPacket->pucEncoded, &pPacket->iEncodedSize );
+		else
+			HUFFMAN_Encode( pPacket->abData, pPacket->pucEncoded, iSize, &pPacket->iEncodedSize );
+
+		if ( pPacket->piEncodedSize != NULL )
+			*pPacket->piEncodedSize = pPacket->iEncodedSize;
+	}
+
+#ifdef NETWORK_HAVE_MMSG
+	if ( g_bBatchIOAvailable )
+	{
+		struct iovec	aIOVecs[NETWORK_BATCH_SIZE];
+		struct mmsghdr	aHeaders[NETWORK_BATCH_SIZE];
+		const ULONG		ulCount = ulEnd - ulFirst;
+		ULONG			ulSent = 0;
 
-          if ( errno == ECONNREFUSED )
-              return;
+		for ( ULONG ulIdx = 0; ulIdx < ulCount; ulIdx++ )
+		{
+			DEFERREDPACKET_s *pPacket = g_DeferredPackets[ulFirst + ulIdx];
+			aIOVecs[ulIdx].iov_base = pPacket->pucEncoded;
+			aIOVecs[ulIdx].iov_len = pPacket->iEncodedSize;
+			memset( &aHeaders[ulIdx], 0, sizeof( aHeaders[ulIdx] ));
+			aHeaders[ulIdx].msg_hdr.msg_name = &pPacket->SocketAddress;
+			aHeaders[ulIdx].msg_hdr.msg_namelen = sizeof( pPacket->SocketAddress );
+			aHeaders[ulIdx].msg_hdr.msg_iov = &aIOVecs[ulIdx];
+			aHeaders[ulIdx].msg_hdr.msg_iovlen = 1;
+		}
+
+		while ( ulSent < ulCount )
+		{
+			const int iNumPackets = sendmmsg( g_NetworkSocket, &aHeaders[ulSent], ulCount - ulSent, 0 );
+			Group.ulSendCalls++;
 
-		Printf( "NETWORK_LaunchPacket: %s\n", strerror( errno ));
-		Printf( "NETWORK_LaunchPacket: Address %s\n", Address.ToString() );
+			if ( iNumPackets == -1 )
+			{
+				// Send the rest one by one below.
+				if ( errno == ENOSYS )
+				{
+					Group.bBatchIOFailed = true;
+					break;
+				}
+
+				g_DeferredPackets[ulFirst + ulSent]->lBytesSent = -1;
+				g_DeferredPackets[ulFirst + ulSent]->iError = errno;
+				ulSent++;
+				continue;
+			}
+
+			for ( int i = 0; i < iNumPackets; i++ )
+				g_DeferredPackets[ulFirst + ulSent + i]->lBytesSent = aHeaders[ulSent + i].msg_len;
+
+			ulSent += iNumPackets;
+		}
 
+		ulFirst += ulSent;
+	}
 #endif
+
+	for ( ULONG ulIdx = ulFirst; ulIdx < ulEnd; ulIdx++ )
+	{
+		DEFERREDPACKET_s *pPacket = g_DeferredPackets[ulIdx];
+
+		pPacket->lBytesSent = sendto( g_NetworkSocket, (const char*)pPacket->pucEncoded, pPacket->iEncodedSize, 0,
+			reinterpret_cast<const sockaddr*>( &pPacket->SocketAddress ), sizeof( pPacket->SocketAddress ));
+		Group.ulSendCalls++;
+
+		if ( pPacket->lBytesSent == -1 )
+			pPacket->iError = network_GetLastSocketError( );
 	}
+}
+
+//*****************************************************************************
+//
+// Waits until the packet workers sent all packets of the last batch and takes
+// care of their statistics and errors.
+void NETWORK_WaitForPacketWorkers( void )
+{
+	if ( g_bPacketWorkersBusy == false )
+		return;
+
+	g_PacketWorkers.Wait( );
+	g_bPacketWorkersBusy = false;
+
+	for ( unsigned int i = 0; i < g_DeferredGroups.Size( ); ++i )
+	{
+		g_NetIOStats.qwSendCalls += g_DeferredGroups[i].ulSendCalls;
+
+#ifdef NETWORK_HAVE_MMSG
+		if ( g_DeferredGroups[i].bBatchIOFailed && g_bBatchIOAvailable )
+		{
+			Printf( "NETWORK_FlushPacketBatch: Batched packet I/O is not supported, falling back to single packets.\n" );
+			g_bBatchIOAvailable = false;
+		}
+#endif
+	}
+
+	for ( ULONG ulIdx = 0; ulIdx < g_ulNumDeferredPackets; ulIdx++ )
+	{
+		const DEFERREDPACKET_s *pPacket = g_DeferredPackets[ulIdx];
+
+		if ( pPacket->lBytesSent == -1 )
+		{
+			network_HandleSendError( pPacket->Address, pPacket->iError );
+			continue;
+		}
+
+		g_NetIOStats.qwPacketsSent++;
+
+		// Record this for our statistics window.
+		if ( NETWORK_GetState( ) == NETSTATE_SERVER )
+			SERVER_STATISTIC_AddToOutboundDataTransfer( pPacket->lBytesSent );
+	}
+
+	g_ulNumDeferredPackets = 0;
+}
+
+//*****************************************************************************
+//
+// Packets launched from now on are only queued until NETWORK_FlushPacketBatch
+// is called, so that they can be sent with as few system calls as possible.
+void NETWORK_BeginPacketBatch( void )
+{
+	NETWORK_WaitForPacketWorkers( );
+	g_bPacketBatchActive = ( net_batchpacketio != false ) || ( g_PacketWorkers.GetNumThreads( ) > 0 );
+}
+
+//*****************************************************************************
+//
+void NETWORK_FlushPacketBatch( void )
+{
+	g_bPacketBatchActive = false;
+
+	// Hand the deferred packets to the workers, split evenly between the threads
+	// but into groups no bigger than a single sendmmsg call.
+	if ( g_ulNumDeferredPackets > 0 )
+	{
+		const ULONG ulThreads = g_PacketWorkers.GetNumThreads( );
+		const ULONG ulGroups = MAX( ulThreads, ( g_ulNumDeferredPackets + NETWORK_BATCH_SIZE - 1 ) / NETWORK_BATCH_SIZE );
+		g_ulDeferredGroupSize = ( g_ulNumDeferredPackets + ulGroups - 1 ) / ulGroups;
+		g_DeferredGroups.Resize(( g_ulNumDeferredPackets + g_ulDeferredGroupSize - 1 ) / g_ulDeferredGroupSize );
+		g_bPacketWorkersBusy = true;
+		g_PacketWorkers.Start( network_SendDeferredPackets, g_DeferredGroups.Size( ));
+	}
+
+#ifdef NETWORK_HAVE_MMSG
+	ULONG	ulSent = 0;
+
+	for ( ULONG ulIdx = 0; ulIdx < g_ulSendBatchCount; ulIdx++ )
+	{
+		g_aSendIOVecs[ulIdx].iov_base = const_cast<UCHAR *>( g_aSendBatch[ulIdx].pucData );
+		g_aSendIOVecs[ulIdx].iov_len = g_aSendBatch[ulIdx].iSize;
+		memset( &g_aSendHeaders[ulIdx], 0, sizeof( g_aSendHeaders[ulIdx] ));
+		g_aSendHeaders[ulIdx].msg_hdr.msg_name = &g_aSendBatch[ulIdx].SocketAddress;
+		g_aSendHeaders[ulIdx].msg_hdr.msg_namelen = sizeof( g_aSendBatch[ulIdx].SocketAddress );
+		g_aSendHeaders[ulIdx].msg_hdr.msg_iov = &g_aSendIOVecs[ulIdx];
+		g_aSendHeaders[ulIdx].msg_hdr.msg_iovlen = 1;
+	}
+
+	while ( ulSent < g_ulSendBatchCount )
+	{
+		BATCHEDPACKET_s *pPacket = &g_aSendBatch[ulSent];
+
+		// The kernel doesn't support sendmmsg, send the rest one by one.
+		if ( g_bBatchIOAvailable == false )
+		{
+			network_SendDatagram( pPacket->pucData, pPacket->iSize, pPacket->Address, pPacket->SocketAddress );
+			ulSent++;
+			continue;
+		}
+
+		const int iNumPackets = sendmmsg( g_NetworkSocket, &g_aSendHeaders[ulSent], g_ulSendBatchCount - ulSent, 0 );
+		g_NetIOStats.qwSendCalls++;
+
+		// sendmmsg returns -1 if the first packet could not be sent. Skip it, just like sendto would.
+		if ( iNumPackets == -1 )
+		{
+			if ( errno == ENOSYS )
+			{
+				Printf( "NETWORK_FlushPacketBatch: Batched packet I/O is not supported, falling back to single packets.\n" );
+				g_bBatchIOAvailable = false;
+				continue;
+			}
+
+			network_HandleSendError( pPacket->Address, network_GetLastSocketError( ));
+			ulSent++;
+			continue;
+		}
+
+		for ( int i = 0; i < iNumPackets; i++ )
+		{
+			g_NetIOStats.qwPacketsSent++;
+
+			// Record this for our statistics window.
+			if ( NETWORK_GetState( ) == NETSTATE_SERVER )
+				SERVER_STATISTIC_AddToOutboundDataTransfer( g_aSendHeaders[ulSent + i].msg_len );
+		}
+
+		ulSent += iNumPackets;
+	}
+
+	g_ulSendBatchCount = 0;
+#endif
+}
+
+//*****************************************************************************
+//
+static void network_SendDatagram( const UCHAR *pucData, int iSize, const NETADDRESS_s &Address, const sockaddr_in &SocketAddress )
+{
+	LONG	lNumBytes;
+
+	lNumBytes = sendto( g_NetworkSocket, (const char*)pucData, iSize, 0, reinterpret_cast<const sockaddr*>(&SocketAddress), sizeof( SocketAddress ));
+	g_NetIOStats.qwSendCalls++;
+
+	// If sendto returns -1, there was an error.
+	if ( lNumBytes == -1 )
+	{
+		network_HandleSendError( Address, network_GetLastSocketError( ));
+		return;
+	}
+
+	g_NetIOStats.qwPacketsSent++;
 
 	// Record this for our statistics window.
 	if ( NETWORK_GetState( ) == NETSTATE_SERVER )
 		SERVER_STATISTIC_AddToOutboundDataTransfer( lNumBytes );
 }
 
+//*****************************************************************************
+//
+static int network_GetLastSocketError( void )
+{
+#ifdef __WIN32__
+	return WSAGetLastError( );
+#else
+	return errno;
+#endif
+}
+
+//*****************************************************************************
+//
+static void network_HandleSendError( const NETADDRESS_s &Address, int iError )
+{
+#ifdef __WIN32__
+	// Wouldblock is silent.
+	if ( iError == WSAEWOULDBLOCK )
+		return;
+
+	switch ( iError )
+	{
+	case WSAEACCES:
+
+		Printf( "NETWORK_LaunchPacket: Error #%d, WSAEACCES: Permission denied for address: %s\n", iError, Address.ToString() );
+		return;
+	case WSAEAFNOSUPPORT:
+
+		Printf( "NETWORK_LaunchPacket: Error #%d, WSAEAFNOSUPPORT: Address %s incompatible with the requested protocol\n", iError, Address.ToString() );
+		return;
+	case WSAEADDRNOTAVAIL:
+
+		Printf( "NETWORK_LaunchPacket: Error #%d, WSAEADDRENOTAVAIL: Address %s not available\n", iError, Address.ToString() );
+		return;
+	case WSAEHOSTUNREACH:
+
+		Printf( "NETWORK_LaunchPacket: Error #%d, WSAEHOSTUNREACH: Address %s unreachable\n", iError, Address.ToString() );
+		return;				
+	default:
+
+		Printf( "NETWORK_LaunchPacket: Error #%d\n", iError );
+		return;
+	}
+#else
+	if ( iError == EWOULDBLOCK )
+		return;
+
+	if ( iError == ECONNREFUSED )
+		return;
+
+	Printf( "NETWORK_LaunchPacket: %s\n", strerror( iError ));
+	Printf( "NETWORK_LaunchPacket: Address %s\n", Address.ToString() );
+#endif
+}
+
 //*****************************************************************************
 //
 NETADDRESS_s NETWORK_GetLocalAddress( void )
@@ -1191,6 +1947,13 @@ void NETWORK_AddLumpForAuthentication( const LONG LumpNumber )
 //
 void NETWORK_GenerateLumpMD5Hash( const int LumpNum, FString &MD5Hash )
 {
+	if ( HASHCACHE_FindLump( LumpNum, MD5Hash ))
+		return;
+
+	cycle_t timer;
+	timer.Reset( );
+	timer.Clock( );
+
 	const int lumpSize = Wads.LumpLength (LumpNum);
 	BYTE *pbData = new BYTE[lumpSize];
 
@@ -1202,6 +1965,9 @@ void NETWORK_GenerateLumpMD5Hash( const int LumpNum, FString &MD5Hash )
 	// Perform the checksum on our buffer, and free it.
 	CMD5Checksum::GetMD5( pbData, lumpSize, MD5Hash );
 	delete[] pbData;
+
+	timer.Unclock( );
+	HASHCACHE_StoreLump( LumpNum, MD5Hash, timer.TimeMS( ));
 }
 
 //*****************************************************************************
@@ -1630,18 +2396,22 @@ static void network_InitPWADList( void )
 
 	g_IWAD = Wads.GetWadName( ulRealIWADIdx );
 
+	// Hash all the files at once, so that those that aren't cached can be hashed in parallel.
+	TArray<FString> files, checksums;
+	for ( ULONG ulIdx = 0; Wads.GetWadName( ulIdx ) != NULL; ulIdx++ )
+		files.Push( Wads.GetWadFullName( ulIdx ));
+
+	HASHCACHE_HashFiles( files, checksums );
+
 	// Collect all the PWADs into a list.
 	for ( ULONG ulIdx = 0; Wads.GetWadName( ulIdx ) != NULL; ulIdx++ )
 	{
 		const bool bIsIwad = ( ulIdx == ulRealIWADIdx );
 		const bool bIsBaseWad = ( stricmp( Wads.GetWadName( ulIdx ), BASEWAD ) == 0 ); // [SB] Corrected to use BASEWAD instead of GAMENAMELOWERCASE ".pk3"
 
-		char MD5Sum[33];
-		MD5SumOfFile ( Wads.GetWadFullName( ulIdx ), MD5Sum );
-
 		NetworkPWAD pwad;
 		pwad.name = Wads.GetWadName( ulIdx );
-		pwad.checksum = MD5Sum;
+		pwad.checksum = checksums[ulIdx];
 		pwad.wadnum = ulIdx;
 
 		// Skip the IWAD, zandronum.pk3, files that were automatically loaded from subdirectories (such as skin files), and WADs loaded automatically within pk3 files.
@@ -1747,6 +2517,47 @@ void I_DoSelect (void)
 #endif
 } 
 
+//*****************************************************************************
+//
+// Blocks until the game socket becomes readable or until lTimeoutMS milliseconds
+// have passed. If bCheckConsole is true, console input on stdin also wakes us up
+// (only under Linux, stdin_ready is updated accordingly). Returns true if there
+// is something to read.
+bool NETWORK_WaitForPackets( LONG lTimeoutMS, bool bCheckConsole )
+{
+	struct timeval	timeout;
+	fd_set			fdset;
+	int				iMaxSocket = 0;
+
+	if ( g_NetworkSocket == INVALID_SOCKET )
+	{
+		if ( lTimeoutMS > 0 )
+			I_Sleep( lTimeoutMS );
+		return ( false );
+	}
+
+	FD_ZERO( &fdset );
+#ifndef	WIN32
+	if ( bCheckConsole && do_stdin )
+		FD_SET( 0, &fdset );
+#endif
+
+	FD_SET( g_NetworkSocket, &fdset );
+	iMaxSocket = static_cast<int>( g_NetworkSocket );
+
+	timeout.tv_sec = MAX<LONG>( lTimeoutMS, 0 ) / 1000;
+	timeout.tv_usec = ( MAX<LONG>( lTimeoutMS, 0 ) % 1000 ) * 1000;
+	if ( select( iMaxSocket + 1, &fdset, NULL, NULL, &timeout ) == -1 )
+		return ( false );
+
+#ifndef	WIN32
+	if ( bCheckConsole )
+		stdin_ready = FD_ISSET( 0, &fdset );
+#endif
+
+	return ( FD_ISSET( g_NetworkSocket, &fdset ) != 0 );
+}
+
 //*****************************************************************************
 // [BB] Let Skulltag's existing code use ZDoom's MD5 code.
 void CMD5Checksum::GetMD5(const BYTE* pBuf, UINT nLength, FString &OutString)
@@ -1810,6 +2621,86 @@ CCMD( netstate )
 	}
 }
 
+//*****************************************************************************
+//
+// Writes the unencoded packet as a two byte little endian size followed by the data.
+// The Huffman benchmark (tools/huffbench) reads these files.
+static void network_CapturePacket( const BYTE *pbData, ULONG ulSize )
+{
+	if ( ulSize > 0xFFFF )
+		return;
+
+	const BYTE abSize[2] = { static_cast<BYTE> ( ulSize & 0xFF ), static_cast<BYTE> ( ulSize >> 8 ) };
+	if (( fwrite( abSize, 1, 2, g_PacketCaptureFile ) != 2 ) || ( fwrite( pbData, 1, ulSize, g_PacketCaptureFile ) != ulSize ))
+	{
+		Printf( "Writing the packet capture failed, capture stopped.\n" );
+		fclose( g_PacketCaptureFile );
+		g_PacketCaptureFile = NULL;
+	}
+}
+
+//*****************************************************************************
+//
+CCMD( net_capturepackets )
+{
+	// [AK] This function may not be used by ConsoleCommand.
+	if ( ACS_IsCalledFromConsoleCommand( ))
+		return;
+
+	if ( argv.argc( ) < 2 )
+	{
+		Printf( "Usage: net_capturepackets <filename|off>\nWrites all sent and received packets to a file, e.g. for tools/huffbench.\n" );
+		Printf( "Packet capture is %s.\n", ( g_PacketCaptureFile != NULL ) ? "running" : "off" );
+		return;
+	}
+
+	if ( g_PacketCaptureFile != NULL )
+	{
+		fclose( g_PacketCaptureFile );
+		g_PacketCaptureFile = NULL;
+		Printf( "Packet capture stopped.\n" );
+	}
+
+	if ( stricmp( argv[1], "off" ) == 0 )
+		return;
+
+	if (( g_PacketCaptureFile = fopen( argv[1], "wb" )) == NULL )
+		Printf( "Can't open %s for writing.\n", argv[1] );
+	else
+		Printf( "Capturing packets to %s.\n", argv[1] );
+}
+
+//*****************************************************************************
+//
+CCMD( netiostats )
+{
+	if (( argv.argc( ) >= 2 ) && ( stricmp( argv[1], "reset" ) == 0 ))
+	{
+		memset( &g_NetIOStats, 0, sizeof( g_NetIOStats ));
+		g_NetIOStats.iStartTic = gametic;
+		Printf( "Network I/O statistics reset.\n" );
+		return;
+	}
+
+	const int iTics = MAX( gametic - g_NetIOStats.iStartTic, 1 );
+	bool bBatched = false;
+#ifdef NETWORK_HAVE_MMSG
+	bBatched = net_batchpacketio && g_bBatchIOAvailable;
+#endif
+
+	Printf( "Packet I/O mode: %s, %u packet threads\n", bBatched ? "batched" : "single packets", g_PacketWorkers.GetNumThreads( ));
+	Printf( "Over %d tics:\n", iTics );
+	Printf( "Receive calls: %llu (%.2f per tic), packets received: %llu (%.2f per tic)\n",
+		static_cast<unsigned long long> ( g_NetIOStats.qwReceiveCalls ), static_cast<double> ( g_NetIOStats.qwReceiveCalls ) / iTics,
+		static_cast<unsigned long long> ( g_NetIOStats.qwPacketsReceived ), static_cast<double> ( g_NetIOStats.qwPacketsReceived ) / iTics );
+	Printf( "Send calls: %llu (%.2f per tic), packets sent: %llu (%.2f per tic)\n",
+		static_cast<unsigned long long> ( g_NetIOStats.qwSendCalls ), static_cast<double> ( g_NetIOStats.qwSendCalls ) / iTics,
+		static_cast<unsigned long long> ( g_NetIOStats.qwPacketsSent ), static_cast<double> ( g_NetIOStats.qwPacketsSent ) / iTics );
+	Printf( "Huffman-encoded bytes: %llu, %llu of them (%.1f%%) reused the codes of shared commands\n",
+		static_cast<unsigned long long> ( g_NetIOStats.qwBytesEncoded ), static_cast<unsigned long long> ( g_NetIOStats.qwSharedBytesEncoded ),
+		( g_NetIOStats.qwBytesEncoded > 0 ) ? 100.0 * g_NetIOStats.qwSharedBytesEncoded / g_NetIOStats.qwBytesEncoded : 0.0 );
+}
+
 //*****************************************************************************
 //
 #if BUILD_ID != BUILD_RELEASE
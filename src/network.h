@@ -95,6 +95,31 @@ enum
 	PLAYER_ONLIFT		= 1 << 7,
 };
 
+// Fields of SVC2_MOVEPLAYERDELTA that differ from the baseline.
+enum
+{
+	MOVEDELTA_POSITION_EXACT	= 1 << 0,
+	MOVEDELTA_POSITION			= 1 << 1,
+	MOVEDELTA_Z					= 1 << 2,
+	MOVEDELTA_ANGLE_EXACT		= 1 << 3,
+	MOVEDELTA_ANGLE				= 1 << 4,
+	MOVEDELTA_VELX				= 1 << 5,
+	MOVEDELTA_VELY				= 1 << 6,
+	MOVEDELTA_VELZ				= 1 << 7,
+};
+
+// Precision of the position and angle differences of SVC2_MOVEPLAYERDELTA.
+#define	MOVEDELTA_POSITION_SHIFT	8
+#define	MOVEDELTA_ANGLE_SHIFT		16
+
+// Set in the player byte of CLC_ACKMOVESNAPSHOTS if the client is missing the baseline
+// of that player's last MovePlayerDelta, no tic follows then.
+#define	MOVEACK_NOBASELINE			0x80
+
+// Flags of SVC2_DEMOKEYFRAME, which sends a level snapshot in pieces.
+#define	DEMOKEYFRAME_FIRSTPIECE		0x01
+#define	DEMOKEYFRAME_LASTPIECE		0x02
+
 /* [BB] This is not used anywhere anymore.
 // Should we use huffman compression?
 #define	USE_HUFFMAN_COMPRESSION
@@ -295,6 +320,8 @@ enum
 extern FString g_lumpsAuthenticationChecksum;
 extern FString g_MapCollectionChecksum;
 
+class PacketSegmentList;
+
 //*****************************************************************************
 //	PROTOTYPES
 
@@ -304,7 +331,11 @@ void			NETWORK_Destruct( void );
 int				NETWORK_GetPackets( void );
 int				NETWORK_GetLANPackets( void );
 NETADDRESS_s	NETWORK_GetFromAddress( void );
-void			NETWORK_LaunchPacket( NETBUFFER_s *pBuffer, NETADDRESS_s Address );
+void			NETWORK_LaunchPacket( NETBUFFER_s *pBuffer, NETADDRESS_s Address, const PacketSegmentList *pSegments = NULL, ULONG ulSegmentOffset = 0, UCHAR *pucEncoded = NULL, int *piEncodedSize = NULL );
+void			NETWORK_SendEncodedPacket( const UCHAR *pucData, int iSize, NETADDRESS_s Address );
+void			NETWORK_BeginPacketBatch( void );
+void			NETWORK_FlushPacketBatch( void );
+void			NETWORK_WaitForPacketWorkers( void );
 NETADDRESS_s	NETWORK_GetLocalAddress( void );
 NETADDRESS_s	NETWORK_GetCachedLocalAddress( void );
 NETBUFFER_s		*NETWORK_GetNetworkMessageBuffer( void );
@@ -378,6 +409,7 @@ LONG			NETWORK_GetState( void );
 void			NETWORK_SetState( LONG lState );
 
 void			I_DoSelect( void );
+bool			NETWORK_WaitForPackets( LONG lTimeoutMS, bool bCheckConsole );
 
 // DEBUG FUNCTION!
 #ifdef	_DEBUG
@@ -0,0 +1,225 @@
+//-----------------------------------------------------------------------------
+//
+// Zandronum Source
+// Copyright (C) 2026 Zandronum Development Team
+// All rights reserved.
+//
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the Skulltag Development Team nor the names of its
+//    contributors may be used to endorse or promote products derived from this
+//    software without specific prior written permission.
+// 4. Redistributions in any form must be accompanied by information on how to
+//    obtain complete source code for the software and any accompanying
+//    software that uses the software. The source code must either be included
+//    in the distribution or be available for no more than the cost of
+//    distribution plus a nominal fee, and must be freely redistributable
+//    under reasonable conditions. For an executable file, complete source
+//    code means the source code for all modules it contains. It does not
+//    include source code for modules or files that typically accompany the
+//    major components of the operating system on which the executable file
+//    runs.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+//
+//
+//
+// Filename: demowriter.cpp
+//
+// Description: Writes the demo being recorded to its file on a thread of its own
+//
+//-----------------------------------------------------------------------------
+
+#include <zlib.h>
+#include "demowriter.h"
+#include "../networkshared.h"
+
+//*****************************************************************************
+//
+DemoWriter::DemoWriter( ) :
+	_file( NULL ),
+	_compress( false ),
+	_stopping( false ),
+	_failed( false )
+{
+}
+
+//*****************************************************************************
+//
+DemoWriter::~DemoWriter( )
+{
+	if ( IsOpen( ))
+		Close( 0 );
+}
+
+//*****************************************************************************
+//
+// Creates the file, writes the header to it as it is, and starts the thread
+// that writes the chunks of the body.
+bool DemoWriter::Open( const char *fileName, const BYTE *header, unsigned int headerSize, bool compress )
+{
+	if ( IsOpen( ))
+		return false;
+
+	_file = fopen( fileName, "wb" );
+	if ( _file == NULL )
+		return false;
+
+	if (( fwrite( header, headerSize, 1, _file ) != 1 ) || ( fflush( _file ) != 0 ))
+	{
+		fclose( _file );
+		_file = NULL;
+		return false;
+	}
+
+	_compress = compress;
+	_stopping = false;
+	_failed = false;
+	_thread = std::thread( &DemoWriter::WriterMain, this );
+	return true;
+}
+
+//*****************************************************************************
+//
+// Hands a copy of the data to the writer thread.
+void DemoWriter::Write( const BYTE *data, unsigned int size )
+{
+	Chunk chunk;
+
+	if (( size == 0 ) || ( IsOpen( ) == false ))
+		return;
+
+	chunk.data = new BYTE[size];
+	chunk.size = size;
+	memcpy( chunk.data, data, size );
+	{
+		std::lock_guard<std::mutex> lock( _mutex );
+		_queue.Push( chunk );
+	}
+	_chunksAvailable.notify_one( );
+}
+
+//*****************************************************************************
+//
+// Waits until everything is written, then fills in the length that follows
+// CLD_DEMOLENGTH in the header and closes the file. Returns false if anything
+// couldn't be written.
+bool DemoWriter::Close( LONG demoLength )
+{
+	BYTE			length[4];
+	BYTESTREAM_s	byteStream;
+
+	if ( IsOpen( ) == false )
+		return false;
+
+	{
+		std::lock_guard<std::mutex> lock( _mutex );
+		_stopping = true;
+	}
+	_chunksAvailable.notify_one( );
+	_thread.join( );
+
+	bool success = ( _failed == false );
+	byteStream.pbStream = length;
+	byteStream.pbStreamEnd = length + sizeof( length );
+	byteStream.WriteLong( demoLength );
+	if (( fseek( _file, 5, SEEK_SET ) != 0 ) || ( fwrite( length, sizeof( length ), 1, _file ) != 1 ))
+		success = false;
+	if ( fclose( _file ) != 0 )
+		success = false;
+	_file = NULL;
+
+	return success;
+}
+
+//*****************************************************************************
+//
+bool DemoWriter::IsOpen( ) const
+{
+	return ( _file != NULL );
+}
+
+//*****************************************************************************
+//
+// Chunks that don't get any smaller are stored as they are.
+bool DemoWriter::WriteChunk( FILE *file, const Chunk &chunk, bool compress )
+{
+	BYTE			*stored = chunk.data;
+	uLongf			storedSize = chunk.size;
+	BYTE			*compressed = NULL;
+	BYTE			header[8];
+	BYTESTREAM_s	byteStream;
+
+	if ( compress )
+	{
+		uLongf compressedSize = compressBound( chunk.size );
+		compressed = new BYTE[compressedSize];
+		if (( ::compress( compressed, &compressedSize, chunk.data, chunk.size ) == Z_OK ) && ( compressedSize < chunk.size ))
+		{
+			stored = compressed;
+			storedSize = compressedSize;
+		}
+	}
+
+	byteStream.pbStream = header;
+	byteStream.pbStreamEnd = header + sizeof( header );
+	byteStream.WriteLong( chunk.size );
+	byteStream.WriteLong( storedSize );
+
+	const bool written = ( fwrite( header, sizeof( header ), 1, file ) == 1 )
+		&& ( fwrite( stored, storedSize, 1, file ) == 1 )
+		&& ( fflush( file ) == 0 );
+
+	delete[] compressed;
+	return written;
+}
+
+//*****************************************************************************
+//
+void DemoWriter::WriterMain( )
+{
+	std::unique_lock<std::mutex> lock( _mutex );
+
+	for ( ;; )
+	{
+		_chunksAvailable.wait( lock, [this] { return _stopping || ( _queue.Size( ) > 0 ); } );
+
+		// Only stop once everything is written.
+		if ( _queue.Size( ) == 0 )
+			break;
+
+		TArray<Chunk> chunks = _queue;
+		_queue.Clear( );
+		lock.unlock( );
+
+		bool written = true;
+		for ( unsigned int i = 0; i < chunks.Size( ); ++i )
+		{
+			if ( written )
+				written = WriteChunk( _file, chunks[i], _compress );
+			delete[] chunks[i].data;
+		}
+
+		lock.lock( );
+		if ( written == false )
+			_failed = true;
+	}
+}
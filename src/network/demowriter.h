@@ -0,0 +1,98 @@
+//-----------------------------------------------------------------------------
+//
+// Zandronum Source
+// Copyright (C) 2026 Zandronum Development Team
+// All rights reserved.
+//
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the Skulltag Development Team nor the names of its
+//    contributors may be used to endorse or promote products derived from this
+//    software without specific prior written permission.
+// 4. Redistributions in any form must be accompanied by information on how to
+//    obtain complete source code for the software and any accompanying
+//    software that uses the software. The source code must either be included
+//    in the distribution or be available for no more than the cost of
+//    distribution plus a nominal fee, and must be freely redistributable
+//    under reasonable conditions. For an executable file, complete source
+//    code means the source code for all modules it contains. It does not
+//    include source code for modules or files that typically accompany the
+//    major components of the operating system on which the executable file
+//    runs.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+//
+//
+//
+// Filename: demowriter.h
+//
+// Description: Writes the demo being recorded to its file on a thread of its own
+//
+//-----------------------------------------------------------------------------
+
+#pragma once
+#include <stdio.h>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include "../doomtype.h"
+#include "tarray.h"
+
+//==========================================================================
+//
+// DemoWriter
+//
+// The header is written when the file is opened. Everything passed to Write
+// afterwards is appended as a chunk of [LONG size][LONG stored size][data] by
+// the writer thread, zlib compressed if the stored size differs from the size.
+// Each chunk is flushed, so that a crash loses little of the demo.
+//
+//==========================================================================
+class DemoWriter
+{
+public:
+	DemoWriter( );
+	~DemoWriter( );
+
+	bool Open( const char *fileName, const BYTE *header, unsigned int headerSize, bool compress );
+	void Write( const BYTE *data, unsigned int size );
+	bool Close( LONG demoLength );
+	bool IsOpen( ) const;
+
+private:
+	struct Chunk
+	{
+		BYTE			*data;
+		unsigned int	size;
+	};
+
+	static bool WriteChunk( FILE *file, const Chunk &chunk, bool compress );
+	void WriterMain( );
+
+	FILE					*_file;
+	std::mutex				_mutex;
+	std::condition_variable	_chunksAvailable;
+	std::thread				_thread;
+	TArray<Chunk>			_queue;
+	bool					_compress;
+	bool					_stopping;
+	bool					_failed;
+};
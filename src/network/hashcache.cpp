@@ -0,0 +1,464 @@
+//-----------------------------------------------------------------------------
+//
+// Zandronum Source
+// Copyright (C) 2026 Zandronum Development Team
+// All rights reserved.
+//
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the Skulltag Development Team nor the names of its
+//    contributors may be used to endorse or promote products derived from this
+//    software without specific prior written permission.
+// 4. Redistributions in any form must be accompanied by information on how to
+//    obtain complete source code for the software and any accompanying
+//    software that uses the software. The source code must either be included
+//    in the distribution or be available for no more than the cost of
+//    distribution plus a nominal fee, and must be freely redistributable
+//    under reasonable conditions. For an executable file, complete source
+//    code means the source code for all modules it contains. It does not
+//    include source code for modules or files that typically accompany the
+//    major components of the operating system on which the executable file
+//    runs.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+//
+//
+// Filename: hashcache.cpp
+//
+// Description: Persistent cache of the MD5 sums of wads and lumps
+//
+// Hashing multi-hundred-MB wad sets takes seconds on every start. The sums
+// are kept in a file in the cache directory, keyed by the path, size and
+// modification time of the file they were computed from. Lumps are keyed by
+// the file on disk that contains them and their position in it.
+//
+//-----------------------------------------------------------------------------
+
+#include <sys/stat.h>
+#include <stdio.h>
+#ifndef _WIN32
+#include <unistd.h>
+#else
+#include <process.h>
+#define getpid _getpid
+#endif
+#include <chrono>
+#include <thread>
+#include "../c_cvars.h"
+#include "../doomtype.h"
+#include "../m_misc.h"
+#include "../md5.h"
+#include "../templates.h"
+#include "../version.h"
+#include "../w_wad.h"
+#include "hashcache.h"
+#include "workerpool.h"
+
+// MSVC's sys/stat.h lacks the POSIX test macros.
+#ifndef S_ISREG
+#define S_ISREG( mode ) ((( mode ) & S_IFMT ) == S_IFREG )
+#endif
+
+//*****************************************************************************
+//	STRUCTURES
+
+struct HASHCACHEENTRY_s
+{
+	// Identity of the file the sum was computed from.
+	SQWORD		qwSize;
+	SQWORD		qwModified;
+
+	// How long computing the sum took, i.e. the time a cache hit saves.
+	double		HashMS;
+
+	FString		Checksum;
+};
+
+//*****************************************************************************
+struct FILEHASHJOB_s
+{
+	FString		Path;
+
+	// Results, empty if the file couldn't be read.
+	char		Checksum[33];
+	double		HashMS;
+};
+
+//*****************************************************************************
+//	VARIABLES
+
+// Keyed by the file path, or by the file path, a tab and the lump's position for lumps.
+static	TMap<FString, HASHCACHEENTRY_s>	g_HashCache;
+static	bool							g_bHashCacheLoaded = false;
+static	bool							g_bHashCacheChanged = false;
+
+// Statistics since the last report.
+static	unsigned int					g_ulCacheHits = 0;
+static	unsigned int					g_ulCacheMisses = 0;
+static	double							g_SavedMS = 0;
+static	double							g_HashingMS = 0;
+
+// The files HASHCACHE_HashFiles hashes on the worker threads.
+static	TArray<FILEHASHJOB_s>			g_FileHashJobs;
+
+//*****************************************************************************
+//	CONSOLE VARIABLES
+
+CVAR( Bool, net_hashcache, true, CVAR_ARCHIVE|CVAR_NOSETBYACS )
+
+//*****************************************************************************
+//	FUNCTIONS
+
+static double hashcache_GetTimeMS( void )
+{
+	return std::chrono::duration<double, std::milli>( std::chrono::steady_clock::now( ).time_since_epoch( )).count( );
+}
+
+//*****************************************************************************
+//
+static FString hashcache_GetCacheFileName( bool create )
+{
+	FString path = M_GetCachePath( create );
+	path << "/" GAMENAMELOWERCASE "-md5cache.txt";
+	return path;
+}
+
+//*****************************************************************************
+//
+// Gets the size and modification time of a file. Only regular files are cached,
+// the modification time of a directory says nothing about its contents.
+//
+static bool hashcache_GetFileIdentity( const char *path, SQWORD &size, SQWORD &modified )
+{
+	struct stat info;
+
+	if (( stat( path, &info ) != 0 ) || ( !S_ISREG( info.st_mode )))
+		return false;
+
+	size = info.st_size;
+	modified = info.st_mtime;
+	return true;
+}
+
+//*****************************************************************************
+//
+static void hashcache_Load( void )
+{
+	g_bHashCacheLoaded = true;
+
+	FILE *file = fopen( hashcache_GetCacheFileName( false ), "r" );
+	if ( file == NULL )
+		return;
+
+	// Entries of files that changed or vanished are dropped. Many entries share a file,
+	// so remember what stat found out.
+	TMap<FString, bool> validFiles;
+	char line[4096];
+
+	while ( fgets( line, sizeof( line ), file ) != NULL )
+	{
+		HASHCACHEENTRY_s entry;
+		long long size, modified;
+		char checksum[33];
+		int keyStart = 0;
+
+		if (( sscanf( line, "%lld %lld %lf %32s %n", &size, &modified, &entry.HashMS, checksum, &keyStart ) < 4 ) || ( keyStart == 0 ))
+			continue;
+
+		FString key = line + keyStart;
+		key.StripRight( "\r\n" );
+		entry.qwSize = size;
+		entry.qwModified = modified;
+		entry.Checksum = checksum;
+
+		const long tab = key.IndexOf( '\t' );
+		const FString path = ( tab >= 0 ) ? key.Left( tab ) : key;
+		bool *valid = validFiles.CheckKey( path );
+
+		if ( valid == NULL )
+		{
+			SQWORD currentSize, currentModified;
+			valid = &validFiles[path];
+			*valid = hashcache_GetFileIdentity( path, currentSize, currentModified )
+				&& ( currentSize == entry.qwSize ) && ( currentModified == entry.qwModified );
+		}
+
+		if ( *valid )
+			g_HashCache[key] = entry;
+		else
+			g_bHashCacheChanged = true;
+	}
+
+	fclose( file );
+}
+
+//*****************************************************************************
+//
+// Several servers may share the cache, so it's written under a name of its own and
+// then renamed into place, like the node cache. Readers thus either find the complete
+// old file or the complete new one.
+static void hashcache_Save( void )
+{
+	const FString path = hashcache_GetCacheFileName( true );
+	FString tempPath;
+	tempPath.Format( "%s.%d.tmp", path.GetChars( ), static_cast<int>( getpid( )));
+
+	FILE *file = fopen( tempPath, "w" );
+	if ( file == NULL )
+		return;
+
+	TMap<FString, HASHCACHEENTRY_s>::Iterator it( g_HashCache );
+	TMap<FString, HASHCACHEENTRY_s>::Pair *pair;
+
+	while ( it.NextPair( pair ))
+	{
+		fprintf( file, "%lld %lld %.3f %s %s\n", static_cast<long long>( pair->Value.qwSize ), static_cast<long long>( pair->Value.qwModified ),
+			pair->Value.HashMS, pair->Value.Checksum.GetChars( ), pair->Key.GetChars( ));
+	}
+
+	const bool written = ( ferror( file ) == 0 );
+	if (( fclose( file ) != 0 ) || ( written == false ))
+	{
+		remove( tempPath );
+		return;
+	}
+
+#ifdef _WIN32
+	// rename doesn't replace existing files here.
+	remove( path );
+#endif
+	if ( rename( tempPath, path ) != 0 )
+	{
+		remove( tempPath );
+		return;
+	}
+
+	g_bHashCacheChanged = false;
+}
+
+//*****************************************************************************
+//
+static HASHCACHEENTRY_s *hashcache_Find( const FString &key, const char *path )
+{
+	if ( net_hashcache == false )
+		return NULL;
+
+	if ( g_bHashCacheLoaded == false )
+		hashcache_Load( );
+
+	HASHCACHEENTRY_s *entry = g_HashCache.CheckKey( key );
+	SQWORD size, modified;
+
+	if (( entry == NULL ) || ( hashcache_GetFileIdentity( path, size, modified ) == false ))
+		return NULL;
+
+	// The file changed since the last start.
+	if (( entry->qwSize != size ) || ( entry->qwModified != modified ))
+	{
+		g_HashCache.Remove( key );
+		g_bHashCacheChanged = true;
+		return NULL;
+	}
+
+	g_ulCacheHits++;
+	g_SavedMS += entry->HashMS;
+	return entry;
+}
+
+//*****************************************************************************
+//
+static void hashcache_Store( const FString &key, const char *path, const FString &checksum, double hashMS )
+{
+	HASHCACHEENTRY_s entry;
+
+	g_ulCacheMisses++;
+
+	if (( net_hashcache == false ) || checksum.IsEmpty( ) || ( hashcache_GetFileIdentity( path, entry.qwSize, entry.qwModified ) == false ))
+		return;
+
+	entry.HashMS = hashMS;
+	entry.Checksum = checksum;
+	g_HashCache[key] = entry;
+	g_bHashCacheChanged = true;
+}
+
+//*****************************************************************************
+//
+// Runs on the worker threads, so it must not print anything or touch any shared strings.
+//
+static void hashcache_HashFile( unsigned int job )
+{
+	FILEHASHJOB_s &hashJob = g_FileHashJobs[job];
+	const double startMS = hashcache_GetTimeMS( );
+	FILE *file = fopen( hashJob.Path.GetChars( ), "rb" );
+
+	if ( file == NULL )
+		return;
+
+	MD5Context md5;
+	BYTE readbuf[65536];
+	size_t len;
+
+	while (( len = fread( readbuf, 1, sizeof( readbuf ), file )) > 0 )
+		md5.Update( readbuf, static_cast<unsigned int>( len ));
+
+	fclose( file );
+	md5.Final( readbuf );
+
+	for ( int i = 0; i < 16; ++i )
+		mysnprintf( hashJob.Checksum + 2 * i, 3, "%02x", readbuf[i] );
+
+	hashJob.HashMS = hashcache_GetTimeMS( ) - startMS;
+}
+
+//*****************************************************************************
+//
+void HASHCACHE_HashFiles( const TArray<FString> &Files, TArray<FString> &Checksums )
+{
+	TArray<unsigned int> misses;
+
+	Checksums.Resize( Files.Size( ));
+
+	for ( unsigned int i = 0; i < Files.Size( ); ++i )
+	{
+		const HASHCACHEENTRY_s *entry = hashcache_Find( Files[i], Files[i] );
+
+		if ( entry != NULL )
+		{
+			Checksums[i] = entry->Checksum;
+		}
+		else
+		{
+			Checksums[i] = "";
+			misses.Push( i );
+		}
+	}
+
+	if ( misses.Size( ) == 0 )
+		return;
+
+	const double startMS = hashcache_GetTimeMS( );
+
+	g_FileHashJobs.Clear( );
+	g_FileHashJobs.Resize( misses.Size( ));
+	for ( unsigned int i = 0; i < misses.Size( ); ++i )
+	{
+		g_FileHashJobs[i].Path = Files[misses[i]];
+		g_FileHashJobs[i].Checksum[0] = 0;
+		g_FileHashJobs[i].HashMS = 0;
+	}
+
+	// Reading the files is usually what takes the time, so don't use more threads than
+	// there are files.
+	WorkerPool workers;
+	const unsigned int numThreads = MIN<unsigned int>( MAX<unsigned int>( std::thread::hardware_concurrency( ), 1 ), misses.Size( ));
+
+	// With a single thread, the pool runs the jobs right away.
+	if ( numThreads > 1 )
+		workers.Resize( numThreads );
+
+	workers.Start( hashcache_HashFile, misses.Size( ));
+	workers.Wait( );
+
+	for ( unsigned int i = 0; i < misses.Size( ); ++i )
+	{
+		const FILEHASHJOB_s &hashJob = g_FileHashJobs[i];
+
+		if ( hashJob.Checksum[0] == 0 )
+			Printf( "%s: Couldn't read the file.\n", hashJob.Path.GetChars( ));
+
+		Checksums[misses[i]] = hashJob.Checksum;
+		hashcache_Store( hashJob.Path, hashJob.Path, Checksums[misses[i]], hashJob.HashMS );
+	}
+
+	g_HashingMS += hashcache_GetTimeMS( ) - startMS;
+	g_FileHashJobs.Clear( );
+}
+
+//*****************************************************************************
+//
+// The key of a lump is the file on disk that contains it, the name of the wad it's
+// in (which may be nested in the file) and its position and size in that wad.
+//
+static bool hashcache_GetLumpKey( int lump, FString &key, FString &path )
+{
+	const int wadnum = Wads.GetWadnumFromLumpnum( lump );
+	int topWadnum = wadnum;
+
+	if ( wadnum < 0 )
+		return false;
+
+	for ( int parent = Wads.GetParentWad( topWadnum ); parent != topWadnum; parent = Wads.GetParentWad( topWadnum ))
+		topWadnum = parent;
+
+	path = Wads.GetWadFullName( topWadnum );
+	key.Format( "%s\t%s#%d#%d", path.GetChars( ), Wads.GetWadFullName( wadnum ), lump - Wads.GetFirstLump( wadnum ), Wads.LumpLength( lump ));
+	return true;
+}
+
+//*****************************************************************************
+//
+bool HASHCACHE_FindLump( int lump, FString &Checksum )
+{
+	FString key, path;
+
+	if ( hashcache_GetLumpKey( lump, key, path ) == false )
+		return false;
+
+	const HASHCACHEENTRY_s *entry = hashcache_Find( key, path );
+
+	if ( entry == NULL )
+		return false;
+
+	Checksum = entry->Checksum;
+	return true;
+}
+
+//*****************************************************************************
+//
+void HASHCACHE_StoreLump( int lump, const FString &Checksum, double hashMS )
+{
+	FString key, path;
+
+	g_HashingMS += hashMS;
+
+	if ( hashcache_GetLumpKey( lump, key, path ))
+		hashcache_Store( key, path, Checksum, hashMS );
+	else
+		g_ulCacheMisses++;
+}
+
+//*****************************************************************************
+//
+void HASHCACHE_ReportAndSave( void )
+{
+	if ( g_ulCacheHits + g_ulCacheMisses > 0 )
+	{
+		Printf( "MD5 sums: %u cached (saved %.2f seconds), %u computed in %.2f seconds.\n",
+			g_ulCacheHits, g_SavedMS / 1000, g_ulCacheMisses, g_HashingMS / 1000 );
+	}
+
+	g_ulCacheHits = g_ulCacheMisses = 0;
+	g_SavedMS = g_HashingMS = 0;
+
+	if ( g_bHashCacheChanged )
+		hashcache_Save( );
+}
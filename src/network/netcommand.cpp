@@ -47,6 +47,24 @@
 //-----------------------------------------------------------------------------
 
 #include "netcommand.h"
+#include "packetsegments.h"
+#include "c_cvars.h"
+#include "nettraffic.h"
+#include "../huffman/huffman.h"
+
+// Commands that are sent to several clients are only serialized and Huffman-encoded once.
+CVAR( Bool, sv_sharedcommands, true, CVAR_ARCHIVE|CVAR_NOSETBYACS )
+
+// Commands smaller than this aren't worth sharing.
+#define	MIN_SHARED_COMMAND_SIZE	4
+
+// Buffers of destroyed NetCommands, reused by the next ones so that creating
+// a command doesn't allocate memory.
+static	TArray<BYTE *>	g_NetCommandBufferPool;
+
+// Counters for the server statistics.
+static	unsigned int	g_NetCommandsCreated = 0;
+static	unsigned int	g_NetCommandBufferAllocations = 0;
 
 //*****************************************************************************
 //
@@ -106,20 +124,20 @@ ULONG ClientIterator::operator++ ( ) {
 //*****************************************************************************
 //
 NetCommand::NetCommand ( const SVC Header ) :
-	_unreliable( false )
+	_unreliable( false ),
+	_huffmanBits( -1 )
 {
-	_buffer.Init( MAX_UDP_PACKET, BUFFERTYPE_WRITE );
-	_buffer.Clear();
+	initBuffer();
 	addByte( Header );
 }
 
 //*****************************************************************************
 //
 NetCommand::NetCommand ( const SVC2 Header2 ) :
-	_unreliable( false )
+	_unreliable( false ),
+	_huffmanBits( -1 )
 {
-	_buffer.Init( MAX_UDP_PACKET, BUFFERTYPE_WRITE );
-	_buffer.Clear();
+	initBuffer();
 	addByte( SVC_EXTENDEDCOMMAND );
 	addByte( Header2 );
 }
@@ -128,7 +146,44 @@ NetCommand::NetCommand ( const SVC2 Header2 ) :
 //
 NetCommand::~NetCommand ( )
 {
-	_buffer.Free();
+	// Keep the buffer for the next command instead of freeing it.
+	g_NetCommandBufferPool.Push( _buffer.pbData );
+	_buffer.pbData = NULL;
+}
+
+//*****************************************************************************
+//
+void NetCommand::initBuffer ( )
+{
+	BYTE *data;
+
+	if ( g_NetCommandBufferPool.Pop( data ) == false )
+	{
+		data = new BYTE[MAX_UDP_PACKET];
+		++g_NetCommandBufferAllocations;
+	}
+
+	++g_NetCommandsCreated;
+	_buffer.pbData = data;
+	_buffer.ulMaxSize = MAX_UDP_PACKET;
+	_buffer.BufferType = BUFFERTYPE_WRITE;
+	_buffer.Clear();
+}
+
+//*****************************************************************************
+//
+void NetCommand::getAllocationStats ( unsigned int &created, unsigned int &allocations )
+{
+	created = g_NetCommandsCreated;
+	allocations = g_NetCommandBufferAllocations;
+}
+
+//*****************************************************************************
+//
+void NetCommand::resetAllocationStats ( )
+{
+	g_NetCommandsCreated = 0;
+	g_NetCommandBufferAllocations = 0;
 }
 
 //*****************************************************************************
@@ -304,13 +359,44 @@ void NetCommand::sendCommandToClients ( ULONG ulPlayerExtra, ServerCommandFlags
 	if ( ( flags == 0 ) && ( ulPlayerExtra == MAXPLAYERS ) && ( static_cast<SVC>( _buffer.pbData[0] ) != SVC_MAPAUTHENTICATE ) )
 		flags |= SVCF_SKIP_CLIENTS_WITHOUT_FULLUPDATE;
 
+	SharedPacketSegment *segment = NULL;
+	if ( sv_sharedcommands && ( _buffer.CalcSize() >= MIN_SHARED_COMMAND_SIZE ))
+	{
+		ULONG ulNumClients = 0;
+		for ( ClientIterator it ( ulPlayerExtra, flags ); it.notAtEnd() && ( ulNumClients < 2 ); ++it )
+			++ulNumClients;
+
+		if ( ulNumClients > 1 )
+			segment = SharedPacketSegment::Create( _buffer.pbData, _buffer.CalcSize() );
+	}
+
 	for ( ClientIterator it ( ulPlayerExtra, flags ); it.notAtEnd(); ++it )
-		sendCommandToOneClient( *it );
+		sendCommandToClient( *it, segment );
+
+	if ( segment != NULL )
+		segment->RemoveReference();
 }
 
 //*****************************************************************************
 //
 void NetCommand::sendCommandToOneClient( ULONG i )
+{
+	sendCommandToClient( i, NULL );
+}
+
+//*****************************************************************************
+//
+PacketSegmentList& NetCommand::getSegmentsForClient( ULONG i ) const
+{
+	if ( _unreliable )
+		return SERVER_GetClient( i )->UnreliablePacketSegments;
+
+	return SERVER_GetClient( i )->PacketSegments;
+}
+
+//*****************************************************************************
+//
+void NetCommand::sendCommandToClient( ULONG i, SharedPacketSegment *segment )
 {
 	SERVER_CheckClientBuffer( i, _buffer.ulCurrentSize, _unreliable == false );
 
@@ -326,7 +412,39 @@ void NetCommand::sendCommandToOneClient( ULONG i )
 			SERVER_PrintWarning ( "NetCommand %s created a packet to client %lu exceeding sv_maxpacketsize (%d >= %lu)!\n", getHeaderAsString(), i, estimateSize, SERVER_GetMaxPacketSize( ));
 	}
 
+	const LONG offset = getBufferForClient( i ).CalcSize();
+
+	// The segments of a packet that was cleared without being sent are outdated.
+	if (( offset == 0 ) && ( getSegmentsForClient( i ).IsEmpty() == false ))
+		getSegmentsForClient( i ).Clear();
+
 	writeCommandToStream( getBytestreamForClient( i ));
+
+	if ( segment != NULL )
+		getSegmentsForClient( i ).Add( offset, segment );
+
+	if ( NETTRAFFIC_IsMeasuring( ))
+		NETTRAFFIC_AddCommandTraffic( i, _buffer.pbData, _buffer.CalcSize(), getHuffmanBits( segment ), _unreliable );
+}
+
+//*****************************************************************************
+//
+// The size of the command's Huffman codes, only counted once for all recipients.
+int NetCommand::getHuffmanBits( const SharedPacketSegment *segment )
+{
+	if ( _huffmanBits >= 0 )
+		return _huffmanBits;
+
+	if (( segment != NULL ) && ( segment->GetCodes() != NULL ))
+		_huffmanBits = segment->GetCodeBits();
+	else if ( HUFFMAN_GetCodec() != NULL )
+		_huffmanBits = HUFFMAN_GetCodec()->codeBitCount( _buffer.pbData, _buffer.CalcSize() );
+
+	// Values without a code make the packet be sent unencoded.
+	if ( _huffmanBits < 0 )
+		_huffmanBits = _buffer.CalcSize() * 8;
+
+	return _huffmanBits;
 }
 
 //*****************************************************************************
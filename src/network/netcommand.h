@@ -50,6 +50,9 @@
 #include "network_enums.h"
 #include "sv_commands.h"
 
+class SharedPacketSegment;
+class PacketSegmentList;
+
 /**
  * \brief Iterate over all clients, possibly skipping one or all but one.
  *
@@ -84,6 +87,12 @@ public:
 class NetCommand {
 	NETBUFFER_s	_buffer;
 	bool		_unreliable;
+	int			_huffmanBits;
+
+	void initBuffer ( );
+	int getHuffmanBits( const SharedPacketSegment *segment );
+	PacketSegmentList& getSegmentsForClient( ULONG i ) const;
+	void sendCommandToClient( ULONG i, SharedPacketSegment *segment );
 
 public:
 	NetCommand ( const SVC Header );
@@ -111,4 +120,7 @@ public:
 	bool isUnreliable() const;
 	void setUnreliable ( bool a );
 	int calcSize() const;
+
+	static void getAllocationStats ( unsigned int &created, unsigned int &allocations );
+	static void resetAllocationStats ( );
 };
@@ -49,10 +49,15 @@
 #include "network.h"
 #include "c_dispatch.h"
 #include "p_acs.h"
+#include "doomstat.h"
+#include "network_enums.h"
+#include "sv_demo.h"
+#include "cmdlib.h"
 
 #include <map>
 #include <vector>
 #include <algorithm>
+#include <ctime>
 
 //*****************************************************************************
 //	VARIABLES
@@ -68,8 +73,126 @@ struct ltstr
 std::map<const char*, int, ltstr> g_actorTrafficMap;
 std::map<int, int> g_ACSScriptTrafficMap;
 
+// [SVC] commands and [SVC2] commands after them.
+enum
+{
+	NUM_TRAFFICCOMMANDS = NUM_SERVER_COMMANDS + NUM_SVC2_COMMANDS
+};
+
+// What the instances of a command sent to a client took. Every command has two of these,
+// the one for reliable packets and the one for unreliable packets.
+struct COMMANDTRAFFIC_s
+{
+	ULONG	ulCount;
+	QWORD	qwBytes;
+	QWORD	qwHuffmanBits;
+};
+
+// The commands sent to each client since the measurement was reset, and since the
+// command log was last written.
+std::vector<COMMANDTRAFFIC_s> g_CommandTraffic[MAXPLAYERS];
+std::vector<COMMANDTRAFFIC_s> g_CommandTrafficSinceLog[MAXPLAYERS];
+
+// When the command traffic measurement was reset and when the command log was last written.
+int g_CommandTrafficStartTic = 0;
+int g_CommandTrafficLogTic = 0;
+
 CVAR( Bool, sv_measureoutboundtraffic, false, 0 )
 
+// Every sv_commandtrafficloginterval seconds, the commands sent to each client are appended to this CSV file.
+CVAR( String, sv_commandtrafficlog, "", 0 )
+CVAR( Int, sv_commandtrafficloginterval, 10, 0 )
+
+//*****************************************************************************
+//
+static int nettraffic_GetCommandIndex ( const BYTE *pbCommand, const ULONG ulSize )
+{
+	if ( ( ulSize == 0 ) || ( pbCommand[0] >= NUM_SERVER_COMMANDS ) )
+		return -1;
+
+	if ( pbCommand[0] != SVC_EXTENDEDCOMMAND )
+		return pbCommand[0];
+
+	if ( ( ulSize < 2 ) || ( pbCommand[1] >= NUM_SVC2_COMMANDS ) )
+		return -1;
+
+	return NUM_SERVER_COMMANDS + pbCommand[1];
+}
+
+//*****************************************************************************
+//
+static const char *nettraffic_GetCommandName ( const int CommandIndex )
+{
+	if ( CommandIndex < NUM_SERVER_COMMANDS )
+		return GetStringSVC ( static_cast<SVC> ( CommandIndex ) );
+
+	return GetStringSVC2 ( static_cast<SVC2> ( CommandIndex - NUM_SERVER_COMMANDS ) );
+}
+
+//*****************************************************************************
+//
+static void nettraffic_AddTo ( COMMANDTRAFFIC_s &Traffic, const ULONG ulSize, const int HuffmanBits )
+{
+	Traffic.ulCount++;
+	Traffic.qwBytes += ulSize;
+	Traffic.qwHuffmanBits += HuffmanBits;
+}
+
+//*****************************************************************************
+//
+static void nettraffic_AddUp ( COMMANDTRAFFIC_s &Sum, const COMMANDTRAFFIC_s &Traffic )
+{
+	Sum.ulCount += Traffic.ulCount;
+	Sum.qwBytes += Traffic.qwBytes;
+	Sum.qwHuffmanBits += Traffic.qwHuffmanBits;
+}
+
+//*****************************************************************************
+//
+// Appends the commands sent since the log was last written to sv_commandtrafficlog.
+static void nettraffic_WriteCommandLog ( )
+{
+	FString fileName = *sv_commandtrafficlog;
+	FixPathSeperator ( fileName );
+
+	FILE *pFile = fopen ( fileName.GetChars(), "a" );
+	if ( pFile == NULL )
+	{
+		Printf ( "Couldn't open the command traffic log \"%s\".\n", fileName.GetChars() );
+		return;
+	}
+
+	if ( ftell ( pFile ) == 0 )
+		fprintf ( pFile, "time,seconds,client,command,reliable count,reliable bytes,reliable huffman bytes,unreliable count,unreliable bytes,unreliable huffman bytes\n" );
+
+	const int seconds = ( gametic - g_CommandTrafficLogTic ) / TICRATE;
+	const long now = static_cast<long> ( time ( NULL ) );
+
+	for ( ULONG ulClient = 0; ulClient < MAXPLAYERS; ++ulClient )
+	{
+		std::vector<COMMANDTRAFFIC_s> &traffic = g_CommandTrafficSinceLog[ulClient];
+
+		for ( size_t i = 0; i < traffic.size(); i += 2 )
+		{
+			const COMMANDTRAFFIC_s &reliable = traffic[i];
+			const COMMANDTRAFFIC_s &unreliable = traffic[i + 1];
+
+			if ( ( reliable.ulCount == 0 ) && ( unreliable.ulCount == 0 ) )
+				continue;
+
+			fprintf ( pFile, "%ld,%d,%lu,%s,%lu,%llu,%llu,%lu,%llu,%llu\n", now, seconds, ulClient, nettraffic_GetCommandName ( i / 2 ),
+				reliable.ulCount, static_cast<unsigned long long> ( reliable.qwBytes ),
+				static_cast<unsigned long long> ( ( reliable.qwHuffmanBits + 7 ) / 8 ),
+				unreliable.ulCount, static_cast<unsigned long long> ( unreliable.qwBytes ),
+				static_cast<unsigned long long> ( ( unreliable.qwHuffmanBits + 7 ) / 8 ) );
+		}
+
+		traffic.assign ( traffic.size(), COMMANDTRAFFIC_s() );
+	}
+
+	fclose ( pFile );
+}
+
 //*****************************************************************************
 //
 void NETTRAFFIC_AddActorTraffic ( const AActor* pActor, const int BytesUsed )
@@ -96,12 +219,82 @@ void NETTRAFFIC_AddACSScriptTraffic ( const int ScriptNum, const int BytesUsed )
 	g_ACSScriptTrafficMap [ ScriptNum ] += BytesUsed;
 }
 
+//*****************************************************************************
+//
+// HuffmanBits is the size of the command's Huffman codes, the packet also adds a byte
+// and is sent unencoded if that would be bigger.
+void NETTRAFFIC_AddCommandTraffic ( const ULONG ulClient, const BYTE *pbCommand, const ULONG ulSize, const int HuffmanBits, const bool bUnreliable )
+{
+	if ( ( NETTRAFFIC_IsMeasuring() == false ) || ( ulClient >= MAXPLAYERS ) )
+		return;
+
+	// Nothing the demo recorder is sent goes over the network.
+	if ( SERVERDEMO_IsRecorder ( ulClient ) )
+		return;
+
+	const int commandIndex = nettraffic_GetCommandIndex ( pbCommand, ulSize );
+	if ( commandIndex < 0 )
+		return;
+
+	if ( g_CommandTraffic[ulClient].empty() )
+	{
+		g_CommandTraffic[ulClient].resize ( NUM_TRAFFICCOMMANDS * 2 );
+		g_CommandTrafficSinceLog[ulClient].resize ( NUM_TRAFFICCOMMANDS * 2 );
+	}
+
+	const int index = commandIndex * 2 + ( bUnreliable ? 1 : 0 );
+	nettraffic_AddTo ( g_CommandTraffic[ulClient][index], ulSize, HuffmanBits );
+	nettraffic_AddTo ( g_CommandTrafficSinceLog[ulClient][index], ulSize, HuffmanBits );
+}
+
+//*****************************************************************************
+//
+bool NETTRAFFIC_IsMeasuring ( )
+{
+	return ( ( NETWORK_GetState( ) == NETSTATE_SERVER ) && sv_measureoutboundtraffic );
+}
+
 //*****************************************************************************
 //
 void NETTRAFFIC_Reset ( )
 {
 	g_actorTrafficMap.clear();
 	g_ACSScriptTrafficMap.clear();
+
+	// The command log keeps what it didn't write yet.
+	for ( ULONG ulClient = 0; ulClient < MAXPLAYERS; ++ulClient )
+		g_CommandTraffic[ulClient].assign ( g_CommandTraffic[ulClient].size(), COMMANDTRAFFIC_s() );
+	g_CommandTrafficStartTic = gametic;
+}
+
+//*****************************************************************************
+//
+// Called when a client connects, what was sent to the previous client in this slot
+// doesn't belong to it.
+void NETTRAFFIC_ResetClient ( const ULONG ulClient )
+{
+	if ( ulClient >= MAXPLAYERS )
+		return;
+
+	g_CommandTraffic[ulClient].assign ( g_CommandTraffic[ulClient].size(), COMMANDTRAFFIC_s() );
+	g_CommandTrafficSinceLog[ulClient].assign ( g_CommandTrafficSinceLog[ulClient].size(), COMMANDTRAFFIC_s() );
+}
+
+//*****************************************************************************
+//
+void NETTRAFFIC_Tick ( )
+{
+	if ( ( NETTRAFFIC_IsMeasuring() == false ) || ( strlen ( sv_commandtrafficlog ) == 0 ) )
+	{
+		g_CommandTrafficLogTic = gametic;
+		return;
+	}
+
+	if ( gametic - g_CommandTrafficLogTic < MAX<int> ( sv_commandtrafficloginterval, 1 ) * TICRATE )
+		return;
+
+	nettraffic_WriteCommandLog ( );
+	g_CommandTrafficLogTic = gametic;
 }
 
 //*****************************************************************************
@@ -141,6 +334,133 @@ CCMD( dumptrafficmeasure )
 	}
 }
 
+//*****************************************************************************
+//
+// Lists the commands sent to all clients, or to one player, since the measurement was reset.
+// The table can be sorted by any of its columns.
+CCMD( dumpcommandtraffic )
+{
+	if ( NETWORK_GetState( ) != NETSTATE_SERVER )
+		return;
+
+	enum { SORT_NAME, SORT_COUNT, SORT_RELIABLE, SORT_UNRELIABLE, SORT_BYTES, SORT_HUFFMAN };
+	static const char *const sortNames[] = { "name", "count", "reliable", "unreliable", "bytes", "huffman" };
+
+	int sortColumn = SORT_HUFFMAN;
+	bool bSortDescending = false;
+	ULONG ulOnlyClient = MAXPLAYERS;
+
+	for ( int arg = 1; arg < argv.argc(); ++arg )
+	{
+		if ( stricmp ( argv[arg], "desc" ) == 0 )
+		{
+			bSortDescending = true;
+			continue;
+		}
+
+		if ( isdigit ( argv[arg][0] ) )
+		{
+			ulOnlyClient = atoi ( argv[arg] );
+			if ( ( ulOnlyClient >= MAXPLAYERS ) || ( playeringame[ulOnlyClient] == false ) )
+			{
+				Printf ( "There is no player %s.\n", argv[arg] );
+				return;
+			}
+			continue;
+		}
+
+		size_t i;
+		for ( i = 0; i < countof ( sortNames ); ++i )
+		{
+			if ( stricmp ( argv[arg], sortNames[i] ) == 0 )
+				break;
+		}
+
+		if ( i == countof ( sortNames ) )
+		{
+			Printf ( "Usage: dumpcommandtraffic [player number] [name|count|reliable|unreliable|bytes|huffman] [desc]\n" );
+			return;
+		}
+		sortColumn = static_cast<int> ( i );
+	}
+
+	// Sum up the clients, keeping reliable and unreliable packets apart.
+	std::vector<std::pair<COMMANDTRAFFIC_s, COMMANDTRAFFIC_s>> sums ( NUM_TRAFFICCOMMANDS );
+	for ( ULONG ulClient = 0; ulClient < MAXPLAYERS; ++ulClient )
+	{
+		if ( ( ulOnlyClient != MAXPLAYERS ) && ( ulClient != ulOnlyClient ) )
+			continue;
+
+		const std::vector<COMMANDTRAFFIC_s> &traffic = g_CommandTraffic[ulClient];
+		for ( size_t i = 0; i < traffic.size(); i += 2 )
+		{
+			nettraffic_AddUp ( sums[i / 2].first, traffic[i] );
+			nettraffic_AddUp ( sums[i / 2].second, traffic[i + 1] );
+		}
+	}
+
+	struct Row
+	{
+		int command;
+		QWORD values[SORT_HUFFMAN + 1];
+	};
+
+	std::vector<Row> rows;
+	COMMANDTRAFFIC_s total = COMMANDTRAFFIC_s();
+	for ( int i = 0; i < NUM_TRAFFICCOMMANDS; ++i )
+	{
+		COMMANDTRAFFIC_s sum = COMMANDTRAFFIC_s();
+		nettraffic_AddUp ( sum, sums[i].first );
+		nettraffic_AddUp ( sum, sums[i].second );
+
+		if ( sum.ulCount == 0 )
+			continue;
+
+		Row row;
+		row.command = i;
+		row.values[SORT_NAME] = 0;
+		row.values[SORT_COUNT] = sum.ulCount;
+		row.values[SORT_RELIABLE] = sums[i].first.qwBytes;
+		row.values[SORT_UNRELIABLE] = sums[i].second.qwBytes;
+		row.values[SORT_BYTES] = sum.qwBytes;
+		row.values[SORT_HUFFMAN] = ( sum.qwHuffmanBits + 7 ) / 8;
+		rows.push_back ( row );
+		nettraffic_AddUp ( total, sum );
+	}
+
+	std::sort ( rows.begin(), rows.end(), [=]( const Row &a, const Row &b )
+	{
+		if ( sortColumn == SORT_NAME )
+		{
+			const int result = stricmp ( nettraffic_GetCommandName ( a.command ), nettraffic_GetCommandName ( b.command ) );
+			return bSortDescending ? ( result > 0 ) : ( result < 0 );
+		}
+
+		return bSortDescending ? ( a.values[sortColumn] > b.values[sortColumn] ) : ( a.values[sortColumn] < b.values[sortColumn] );
+	});
+
+	const double seconds = MAX ( gametic - g_CommandTrafficStartTic, 1 ) / static_cast<double> ( TICRATE );
+
+	if ( ulOnlyClient != MAXPLAYERS )
+		Printf ( "Server commands sent to %s in the last %.0f seconds:\n", players[ulOnlyClient].userinfo.GetName(), seconds );
+	else
+		Printf ( "Server commands sent in the last %.0f seconds:\n", seconds );
+
+	Printf ( "%-36s %9s %11s %11s %11s %11s %6s %9s\n", "Command", "Count", "Reliable", "Unreliable", "Bytes", "Huffman", "Ratio", "Huff B/s" );
+	for ( auto it = rows.cbegin(); it != rows.cend(); ++it )
+	{
+		Printf ( "%-36s %9llu %11llu %11llu %11llu %11llu %5.1f%% %9.0f\n", nettraffic_GetCommandName ( it->command ),
+			static_cast<unsigned long long> ( it->values[SORT_COUNT] ), static_cast<unsigned long long> ( it->values[SORT_RELIABLE] ),
+			static_cast<unsigned long long> ( it->values[SORT_UNRELIABLE] ), static_cast<unsigned long long> ( it->values[SORT_BYTES] ),
+			static_cast<unsigned long long> ( it->values[SORT_HUFFMAN] ),
+			100.0 * it->values[SORT_HUFFMAN] / MAX<QWORD> ( it->values[SORT_BYTES], 1 ), it->values[SORT_HUFFMAN] / seconds );
+	}
+
+	Printf ( "%-36s %9lu %11s %11s %11llu %11llu %5.1f%% %9.0f\n", "Total", total.ulCount, "", "",
+		static_cast<unsigned long long> ( total.qwBytes ), static_cast<unsigned long long> ( ( total.qwHuffmanBits + 7 ) / 8 ),
+		100.0 * ( total.qwHuffmanBits + 7 ) / 8 / MAX<QWORD> ( total.qwBytes, 1 ), ( total.qwHuffmanBits + 7 ) / 8 / seconds );
+}
+
 //*****************************************************************************
 //
 CCMD( cleartrafficmeasure )
@@ -52,6 +52,10 @@
 
 void	NETTRAFFIC_AddActorTraffic ( const AActor* pActor, const int BytesUsed );
 void	NETTRAFFIC_AddACSScriptTraffic ( const int ScriptNum, const int BytesUsed );
+void	NETTRAFFIC_AddCommandTraffic ( const ULONG ulClient, const BYTE *pbCommand, const ULONG ulSize, const int HuffmanBits, const bool bUnreliable );
+bool	NETTRAFFIC_IsMeasuring ( );
 void	NETTRAFFIC_Reset ( );
+void	NETTRAFFIC_ResetClient ( const ULONG ulClient );
+void	NETTRAFFIC_Tick ( );
 
 #endif	// __NETTRAFFIC_H__
@@ -56,6 +56,8 @@
 //*****************************************************************************
 //
 PacketArchive::PacketArchive() :
+	_slotData ( NULL ),
+	_slotSize ( 0 ),
 	_initialized ( false )
 {
 	Clear();
@@ -74,9 +76,12 @@ void PacketArchive::Initialize( size_t maxPacketSize )
 {
 	if ( _initialized == false )
 	{
-		_packetData.Init( maxPacketSize * PACKET_BUFFER_SIZE, BUFFERTYPE_WRITE );
-		Clear();
+		// Room for the header, the sequence number and the one byte the encoding may add.
+		_slotSize = maxPacketSize + 6;
+		_slotData = new UCHAR[_slotSize * PACKET_BUFFER_SIZE];
+		_scratch.Init( MAX_UDP_PACKET + 5, BUFFERTYPE_WRITE );
 		_initialized = true;
+		Clear();
 	}
 }
 
@@ -86,36 +91,65 @@ void PacketArchive::Free()
 {
 	if ( _initialized )
 	{
-		_packetData.Free();
+		// The packet workers may still be encoding into the slots.
+		NETWORK_WaitForPacketWorkers();
+
+		delete[] _slotData;
+		_slotData = NULL;
+		_scratch.Free();
+
+		for ( size_t i = 0; i < countof( _slots ); ++i )
+		{
+			_slots[i].overflow.Clear();
+			_slots[i].overflow.ShrinkToFit();
+		}
+
 		_initialized = false;
 	}
 }
 
 //*****************************************************************************
 //
-unsigned int PacketArchive::StorePacket( const NETBUFFER_s& packet )
+UCHAR *PacketArchive::SlotData( unsigned int index )
+{
+	if ( _slots[index].overflow.Size() > 0 )
+		return &_slots[index].overflow[0];
+
+	return _slotData + index * _slotSize;
+}
+
+//*****************************************************************************
+//
+// Stores the packet under the next sequence number and sends it to address. The packet
+// is encoded only once, right into its slot, so that it can be retransmitted as it is.
+unsigned int PacketArchive::StorePacket( const NETBUFFER_s& packet, const NETADDRESS_s &address, const PacketSegmentList *segments )
 {
 	if ( _initialized == false )
 		return 0;
 
-	_packetData.ulCurrentSize = _packetData.CalcSize();
+	// The packet workers may still be encoding into the slot we are about to reuse.
+	NETWORK_WaitForPacketWorkers();
 
-	// If we've reached the end of our reliable packets buffer, start writing at the beginning.
-	if (( _packetData.ulCurrentSize + packet.CalcSize() ) >= _packetData.ulMaxSize )
-	{
-		_packetData.ByteStream.pbStream = _packetData.pbData;
-		_packetData.ulCurrentSize = 0;
-	}
+	const unsigned int i = _sequenceNumber % PACKET_BUFFER_SIZE;
+	Slot &slot = _slots[i];
 
-	// Save where the beginning is of each packet within the reliable packets
-	// buffer.
-	unsigned int i = _sequenceNumber % PACKET_BUFFER_SIZE;
-	_records[i].position = _packetData.ulCurrentSize;
-	_records[i].sequenceNumber = _sequenceNumber;
+	_scratch.Clear();
+	_scratch.ByteStream.WriteHeader( SVC_HEADER );
+	_scratch.ByteStream.WriteLong( _sequenceNumber );
+	packet.WriteTo( _scratch.ByteStream );
+	const size_t size = _scratch.CalcSize();
+
+	slot.sequenceNumber = _sequenceNumber;
+	slot.used = true;
+	slot.encodedSize = -1;
+
+	if ( size + 1 > _slotSize )
+		slot.overflow.Resize( static_cast<unsigned int> ( size + 1 ) );
+	else
+		slot.overflow.Clear();
 
-	// Write what we want to send out to our reliable packets buffer, so that it can be
-	// retransmitted later if necessary. Also save the size.
-	_records[i].size = packet.WriteTo( _packetData.ByteStream );
+	// The payload starts after the header and the packet number.
+	NETWORK_LaunchPacket( &_scratch, address, segments, 5, SlotData( i ), &slot.encodedSize );
 
 	return _sequenceNumber++;
 }
@@ -125,46 +159,41 @@ unsigned int PacketArchive::StorePacket( const NETBUFFER_s& packet )
 void PacketArchive::Clear()
 {
 	if ( _initialized )
-		_packetData.Clear();
+		NETWORK_WaitForPacketWorkers();
 
 	_sequenceNumber = 0;
 
-	for ( size_t i = 0; i < countof( _records ); ++i )
-		_records[i].position = _records[i].size = _records[i].sequenceNumber = 0;
+	for ( size_t i = 0; i < countof( _slots ); ++i )
+	{
+		_slots[i].sequenceNumber = 0;
+		_slots[i].used = false;
+		_slots[i].encodedSize = 0;
+		_slots[i].overflow.Clear();
+	}
 }
 
 //*****************************************************************************
 //
-bool PacketArchive::FindPacket( unsigned int packetNumber, const BYTE*& data, size_t& size ) const
+// Returns the encoded packet with the given sequence number. Its size is -1 if it
+// is part of the packet batch that is still open and hasn't been encoded yet.
+bool PacketArchive::FindPacket( unsigned int packetNumber, const UCHAR*& data, int& size ) const
 {
 	if ( _initialized == false )
 		return false;
 
 	// [BB] We know the internal index the packet should have.
-	size_t index = packetNumber % PACKET_BUFFER_SIZE;
-	if ( _records[index].sequenceNumber == packetNumber )
-	{
-		data = _packetData.pbData + _records[index].position;
-		size = _records[index].size;
-		return true;
-	}
-	// [BB] If we still have it, we should have found the packet above.
-	// Nevertheless, to guarantee consistency with the old behaviort, look
-	// through all packets.
+	const size_t index = packetNumber % PACKET_BUFFER_SIZE;
+	const Slot &slot = _slots[index];
+	if (( slot.used == false ) || ( slot.sequenceNumber != packetNumber ))
+		return false;
 
-	// Search through all PACKET_BUFFER_SIZE of the stored packets. We're looking for the packet that
-	// that we want to send to the client by matching the sequences.
-	for ( size_t i = 0; i < countof( _records ); ++i )
-	{
-		if ( _records[i].sequenceNumber == packetNumber )
-		{
-			data = _packetData.pbData + _records[i].position;
-			size = _records[i].size;
-			return true;
-		}
-	}
+	// The packet workers write the encoded packet and its size, so they have to be done
+	// with the last batch before we can look at them.
+	NETWORK_WaitForPacketWorkers();
 
-	return false;
+	data = const_cast<PacketArchive *> ( this )->SlotData( index );
+	size = slot.encodedSize;
+	return true;
 }
 
 //*****************************************************************************
@@ -184,6 +213,7 @@ OutgoingPacketBuffer::OutgoingPacketBuffer ( )
 {
 	_packetsSentThisTick = 0;
 	_clientIdx = MAXPLAYERS;
+	ResetRetransmitStats();
 }
 
 //*****************************************************************************
@@ -195,13 +225,20 @@ void OutgoingPacketBuffer::SetClientIndex ( const unsigned int ClientIdx )
 
 //*****************************************************************************
 //
-void OutgoingPacketBuffer::ScheduleUnsentPacket ( const NETBUFFER_s &Packet )
+void OutgoingPacketBuffer::StoreAndSendPacket ( const NETBUFFER_s &Packet, const PacketSegmentList *Segments )
+{
+	++_packetsSentThisTick;
+	this->StorePacket ( Packet, SERVER_GetClient ( _clientIdx )->Address, Segments );
+}
+
+//*****************************************************************************
+//
+void OutgoingPacketBuffer::ScheduleUnsentPacket ( const NETBUFFER_s &Packet, const PacketSegmentList *Segments )
 {
+	// Only packets that are sent right away can reuse the codes of their shared segments.
 	if ( ( _unsentPackets.Size () == 0 ) && ( _packetsSentThisTick < static_cast<unsigned int> ( sv_maxpacketspertick ) ) )
 	{
-		++_packetsSentThisTick;
-		const int packetNumber = this->StorePacket ( Packet );
-		SendPacket( packetNumber, SERVER_GetClient ( _clientIdx )->Address );
+		StoreAndSendPacket ( Packet, Segments );
 	}
 	else
 	{
@@ -211,27 +248,28 @@ void OutgoingPacketBuffer::ScheduleUnsentPacket ( const NETBUFFER_s &Packet )
 
 //*****************************************************************************
 //
-bool OutgoingPacketBuffer::SendPacket( unsigned int packetNumber, const NETADDRESS_s &Address ) const
+// Retransmits a packet from the archive, without encoding it again.
+bool OutgoingPacketBuffer::SendPacket( unsigned int packetNumber, const NETADDRESS_s &Address )
 {
 	// Find the packet from the saved packet archive.
-	const BYTE* packetData;
-	size_t packetSize;
+	const UCHAR* packetData;
+	int packetSize;
 	bool found = this->FindPacket( packetNumber, packetData, packetSize );
 
 	// We could not find the correct packet.
 	if ( found == false )
 		return false;
 
-	// Now that we've found the packet, send it.
-	NETBUFFER_s TempBuffer;
-	TempBuffer.Init( MAX_UDP_PACKET, BUFFERTYPE_WRITE );
-	TempBuffer.Clear();
-	TempBuffer.ByteStream.WriteHeader( SVC_HEADER );
-	TempBuffer.ByteStream.WriteLong( packetNumber );
-	if ( packetSize > 0 )
-		TempBuffer.ByteStream.WriteBuffer( packetData, packetSize );
-	NETWORK_LaunchPacket( &TempBuffer, Address );
-	TempBuffer.Free();
+	// The packet hasn't been encoded yet, send it again once it is.
+	if ( packetSize < 0 )
+	{
+		_scheduledPacketIndices.Push ( packetNumber );
+		return true;
+	}
+
+	++_retransmittedPackets;
+	_retransmittedBytes += packetSize;
+	NETWORK_SendEncodedPacket( packetData, packetSize, Address );
 	return true;
 }
 
@@ -247,8 +285,8 @@ bool OutgoingPacketBuffer::SchedulePacket ( unsigned int packetNumber )
 	else
 	{
 		_scheduledPacketIndices.Push ( packetNumber );
-		const BYTE* packetData;
-		size_t packetSize;
+		const UCHAR* packetData;
+		int packetSize;
 		return this->FindPacket( packetNumber, packetData, packetSize );
 	}
 }
@@ -261,12 +299,21 @@ void OutgoingPacketBuffer::ClearScheduling ( )
 	_scheduledPacketIndices.Clear();
 }
 
+//*****************************************************************************
+//
+void OutgoingPacketBuffer::ResetRetransmitStats ( )
+{
+	_retransmittedPackets = 0;
+	_retransmittedBytes = 0;
+}
+
 //*****************************************************************************
 //
 void OutgoingPacketBuffer::Clear ( )
 {
 	PacketArchive::Clear();
 	ClearScheduling();
+	ResetRetransmitStats();
 	for ( unsigned int i = 0; i < _unsentPackets.Size(); ++i )
 		_unsentPackets[i].Free();
 	_unsentPackets.Clear();
@@ -276,17 +323,17 @@ void OutgoingPacketBuffer::Clear ( )
 //
 void OutgoingPacketBuffer::ForceSendAll()
 {
-	for ( unsigned int i = 0; i < _scheduledPacketIndices.Size(); ++i )
+	// Packets that can't be sent yet are scheduled again behind these.
+	const unsigned int scheduledPackets = _scheduledPacketIndices.Size();
+	for ( unsigned int i = 0; i < scheduledPackets; ++i )
 	{
 		++_packetsSentThisTick;
 		SendPacket( _scheduledPacketIndices[i], SERVER_GetClient ( _clientIdx )->Address );
 	}
-	_scheduledPacketIndices.Clear();
+	_scheduledPacketIndices.Delete( 0, scheduledPackets );
 	for ( unsigned int i = 0; i < _unsentPackets.Size(); ++i )
 	{
-		++_packetsSentThisTick;
-		const int packetNumber = this->StorePacket ( _unsentPackets[i] );
-		SendPacket ( packetNumber, SERVER_GetClient (_clientIdx)->Address );
+		StoreAndSendPacket ( _unsentPackets[i] );
 		_unsentPackets[i].Free ();
 	}
 	_unsentPackets.Clear();
@@ -314,9 +361,7 @@ void OutgoingPacketBuffer::Tick ( )
 		const int unsentPacketsToSend = MIN ( sv_maxpacketspertick - static_cast<int> ( _packetsSentThisTick ), static_cast<int> ( _unsentPackets.Size () ) );
 		for ( int i = 0; i < unsentPacketsToSend; ++i )
 		{
-			++_packetsSentThisTick;
-			const int packetNumber = this->StorePacket ( _unsentPackets[i] );
-			SendPacket ( packetNumber, SERVER_GetClient( _clientIdx )->Address );
+			StoreAndSendPacket ( _unsentPackets[i] );
 			_unsentPackets[i].Free ();
 		}
 		_unsentPackets.Delete( 0, unsentPacketsToSend );
@@ -51,6 +51,8 @@
 #pragma once
 #include "../networkshared.h"
 
+class PacketSegmentList;
+
 class PacketArchive
 {
 public:
@@ -60,26 +62,32 @@ public:
 	void Initialize( size_t maxPacketSize );
 	void Free();
 	void Clear();
-	unsigned int StorePacket( const NETBUFFER_s& packet );
-	bool FindPacket( unsigned int packetNumber, const BYTE*& data, size_t& size ) const;
+	unsigned int StorePacket( const NETBUFFER_s& packet, const NETADDRESS_s &address, const PacketSegmentList *segments = NULL );
+	bool FindPacket( unsigned int packetNumber, const UCHAR*& data, int& size ) const;
 
 private:
-	struct Record
+	struct Slot
 	{
-		size_t position; // The position of this packet within _packetData.
-		size_t size; // The packet size of the stored packet.
 		unsigned int sequenceNumber; // The corresponding sequence number of this packet.
+		bool used; // Does this slot hold a packet at all?
+		int encodedSize; // The size of the encoded packet, or -1 until the packet workers encoded it.
+		TArray<UCHAR> overflow; // Packets that don't fit into the slot are kept here.
 	};
 
-	// Buffer containing all data of the saved packets.
-	NETBUFFER_s _packetData;
+	UCHAR *SlotData( unsigned int index );
+
+	// The encoded packets (including header and sequence number), _slotSize bytes each.
+	// The slot of a packet is its sequence number modulo PACKET_BUFFER_SIZE.
+	UCHAR *_slotData;
+	size_t _slotSize;
+	Slot _slots[PACKET_BUFFER_SIZE];
+
+	// The packets are assembled here before they are encoded.
+	NETBUFFER_s _scratch;
 
 	// Last packet number sent to this client.
 	unsigned int _sequenceNumber;
 
-	// Records of all saved packets.
-	Record _records[PACKET_BUFFER_SIZE];
-
 	// Is this initialized or not?
 	bool _initialized;
 };
@@ -97,15 +105,21 @@ class OutgoingPacketBuffer : public PacketArchive
 	unsigned int _clientIdx;
 	TArray<unsigned int> _scheduledPacketIndices;
 	TArray<NETBUFFER_s> _unsentPackets;
+	unsigned int _retransmittedPackets;
+	QWORD _retransmittedBytes;
 private:
-	bool SendPacket( unsigned int packetNumber, const NETADDRESS_s &Address ) const;
+	bool SendPacket( unsigned int packetNumber, const NETADDRESS_s &Address );
+	void StoreAndSendPacket( const NETBUFFER_s &Packet, const PacketSegmentList *Segments = NULL );
 public:
 	OutgoingPacketBuffer ( );
 	void SetClientIndex ( const unsigned int ClientIdx );
-	void ScheduleUnsentPacket ( const NETBUFFER_s &Packet );
+	void ScheduleUnsentPacket ( const NETBUFFER_s &Packet, const PacketSegmentList *Segments = NULL );
 	bool SchedulePacket( unsigned int packetNumber );
 	void ClearScheduling();
 	void ForceSendAll();
 	void Clear();
 	void Tick ( );
+	unsigned int GetRetransmittedPackets ( ) const { return _retransmittedPackets; }
+	QWORD GetRetransmittedBytes ( ) const { return _retransmittedBytes; }
+	void ResetRetransmitStats ( );
 };
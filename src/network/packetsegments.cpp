@@ -0,0 +1,195 @@
+//-----------------------------------------------------------------------------
+//
+// Zandronum Source
+// Copyright (C) 2026 Zandronum Development Team
+// All rights reserved.
+//
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the Skulltag Development Team nor the names of its
+//    contributors may be used to endorse or promote products derived from this
+//    software without specific prior written permission.
+// 4. Redistributions in any form must be accompanied by information on how to
+//    obtain complete source code for the software and any accompanying
+//    software that uses the software. The source code must either be included
+//    in the distribution or be available for no more than the cost of
+//    distribution plus a nominal fee, and must be freely redistributable
+//    under reasonable conditions. For an executable file, complete source
+//    code means the source code for all modules it contains. It does not
+//    include source code for modules or files that typically accompany the
+//    major components of the operating system on which the executable file
+//    runs.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+//
+//
+// Filename: packetsegments.cpp
+//
+// Description: Server commands shared by the packets of several clients
+//
+//-----------------------------------------------------------------------------
+
+#include "../doomtype.h"
+#include "../huffman/huffman.h"
+#include "packetsegments.h"
+
+// Released segments waiting to be reused by SharedPacketSegment::Create.
+static	TArray<SharedPacketSegment *>	g_FreeSegments;
+
+// Counters for the server statistics.
+static	unsigned int	g_SegmentsCreated = 0;
+static	unsigned int	g_SegmentAllocations = 0;
+
+//*****************************************************************************
+//
+SharedPacketSegment *SharedPacketSegment::Create( const BYTE *data, size_t size )
+{
+	SharedPacketSegment *segment;
+
+	if ( g_FreeSegments.Pop( segment ) == false )
+	{
+		segment = new SharedPacketSegment( );
+		++g_SegmentAllocations;
+	}
+
+	++g_SegmentsCreated;
+	segment->Assign( data, size );
+	return segment;
+}
+
+//*****************************************************************************
+//
+void SharedPacketSegment::GetAllocationStats( unsigned int &created, unsigned int &allocations )
+{
+	created = g_SegmentsCreated;
+	allocations = g_SegmentAllocations;
+}
+
+//*****************************************************************************
+//
+void SharedPacketSegment::ResetAllocationStats( )
+{
+	g_SegmentsCreated = 0;
+	g_SegmentAllocations = 0;
+}
+
+//*****************************************************************************
+//
+SharedPacketSegment::SharedPacketSegment( ) :
+	_data ( NULL ),
+	_size ( 0 ),
+	_references ( 0 ),
+	_capacity ( 0 ),
+	_codeStorage ( NULL ),
+	_codes ( NULL ),
+	_codeBits ( 0 )
+{
+}
+
+//*****************************************************************************
+//
+SharedPacketSegment::~SharedPacketSegment( )
+{
+	delete[] _data;
+	delete[] _codeStorage;
+}
+
+//*****************************************************************************
+//
+void SharedPacketSegment::Assign( const BYTE *data, size_t size )
+{
+	if ( size > _capacity )
+	{
+		delete[] _data;
+		delete[] _codeStorage;
+
+		_capacity = 64;
+		while ( _capacity < size )
+			_capacity *= 2;
+
+		// Every code is shorter than 32 bits, so one word per byte is always enough.
+		_data = new BYTE[_capacity];
+		_codeStorage = new unsigned int[_capacity + 1];
+		g_SegmentAllocations += 2;
+	}
+
+	memcpy( _data, data, size );
+	_size = size;
+	_references = 1;
+	_codes = NULL;
+	_codeBits = 0;
+
+	skulltag::HuffmanCodec *codec = HUFFMAN_GetCodec( );
+	if ( codec != NULL )
+	{
+		_codeBits = codec->precomputeCodes( _data, static_cast<int>( size ), _codeStorage, static_cast<int>( _capacity ) + 1 );
+		if ( _codeBits >= 0 )
+			_codes = _codeStorage;
+		else
+			_codeBits = 0;
+	}
+}
+
+//*****************************************************************************
+//
+void SharedPacketSegment::AddReference( )
+{
+	++_references;
+}
+
+//*****************************************************************************
+//
+void SharedPacketSegment::RemoveReference( )
+{
+	if ( --_references == 0 )
+		g_FreeSegments.Push( this );
+}
+
+//*****************************************************************************
+//
+PacketSegmentList::~PacketSegmentList( )
+{
+	Clear( );
+}
+
+//*****************************************************************************
+//
+void PacketSegmentList::Add( size_t offset, SharedPacketSegment *segment )
+{
+	if ( segment->GetCodes( ) == NULL )
+		return;
+
+	Entry entry;
+	entry.offset = offset;
+	entry.segment = segment;
+	segment->AddReference( );
+	_entries.Push( entry );
+}
+
+//*****************************************************************************
+//
+void PacketSegmentList::Clear( )
+{
+	for ( unsigned int i = 0; i < _entries.Size( ); ++i )
+		_entries[i].segment->RemoveReference( );
+
+	_entries.Clear( );
+}
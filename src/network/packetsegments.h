@@ -0,0 +1,132 @@
+//-----------------------------------------------------------------------------
+//
+// Zandronum Source
+// Copyright (C) 2026 Zandronum Development Team
+// All rights reserved.
+//
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the Skulltag Development Team nor the names of its
+//    contributors may be used to endorse or promote products derived from this
+//    software without specific prior written permission.
+// 4. Redistributions in any form must be accompanied by information on how to
+//    obtain complete source code for the software and any accompanying
+//    software that uses the software. The source code must either be included
+//    in the distribution or be available for no more than the cost of
+//    distribution plus a nominal fee, and must be freely redistributable
+//    under reasonable conditions. For an executable file, complete source
+//    code means the source code for all modules it contains. It does not
+//    include source code for modules or files that typically accompany the
+//    major components of the operating system on which the executable file
+//    runs.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+//
+//
+// Filename: packetsegments.h
+//
+// Description: Server commands shared by the packets of several clients
+//
+//-----------------------------------------------------------------------------
+
+#pragma once
+#include "../networkshared.h"
+#include "tarray.h"
+
+//==========================================================================
+//
+// SharedPacketSegment
+//
+// A server command that is sent unchanged to several clients. It's
+// serialized once and its Huffman codes are computed once, the packets of
+// all recipients refer to it until they are launched. Released segments are
+// kept for reuse, so creating one doesn't allocate memory in steady state.
+//
+//==========================================================================
+class SharedPacketSegment
+{
+public:
+	static SharedPacketSegment *Create( const BYTE *data, size_t size );
+	static void GetAllocationStats( unsigned int &created, unsigned int &allocations );
+	static void ResetAllocationStats( );
+
+	void AddReference();
+	void RemoveReference();
+
+	const BYTE *GetData() const { return _data; }
+	size_t GetSize() const { return _size; }
+	const unsigned int *GetCodes() const { return _codes; }
+	int GetCodeBits() const { return _codeBits; }
+
+private:
+	SharedPacketSegment( );
+	~SharedPacketSegment();
+	SharedPacketSegment( const SharedPacketSegment & );
+	SharedPacketSegment &operator= ( const SharedPacketSegment & );
+
+	void Assign( const BYTE *data, size_t size );
+
+	BYTE *_data;
+	size_t _size;
+	unsigned int _references;
+
+	// Segments are pooled, the storage only grows when a bigger command comes along.
+	size_t _capacity;
+	unsigned int *_codeStorage;
+
+	// The Huffman codes of _data, NULL if they couldn't be computed.
+	unsigned int *_codes;
+	int _codeBits;
+};
+
+//==========================================================================
+//
+// PacketSegmentList
+//
+// Remembers where shared segments were written to a packet that is being
+// assembled. The packet still holds a copy of every segment (the packet
+// archive needs it for retransmissions), the list only allows
+// NETWORK_LaunchPacket to reuse their Huffman codes. Entries that don't
+// match the packet data are ignored, so the packet may be cleared without
+// clearing its list.
+//
+//==========================================================================
+class PacketSegmentList
+{
+public:
+	~PacketSegmentList();
+
+	void Add( size_t offset, SharedPacketSegment *segment );
+	void Clear();
+	unsigned int Size() const { return _entries.Size(); }
+	bool IsEmpty() const { return _entries.Size() == 0; }
+	size_t GetOffset( unsigned int i ) const { return _entries[i].offset; }
+	const SharedPacketSegment *GetSegment( unsigned int i ) const { return _entries[i].segment; }
+
+private:
+	struct Entry
+	{
+		size_t offset; // Position of the segment in the packet payload.
+		SharedPacketSegment *segment;
+	};
+
+	TArray<Entry> _entries;
+};
@@ -0,0 +1,178 @@
+//-----------------------------------------------------------------------------
+//
+// Zandronum Source
+// Copyright (C) 2026 Zandronum Development Team
+// All rights reserved.
+//
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the Skulltag Development Team nor the names of its
+//    contributors may be used to endorse or promote products derived from this
+//    software without specific prior written permission.
+// 4. Redistributions in any form must be accompanied by information on how to
+//    obtain complete source code for the software and any accompanying
+//    software that uses the software. The source code must either be included
+//    in the distribution or be available for no more than the cost of
+//    distribution plus a nominal fee, and must be freely redistributable
+//    under reasonable conditions. For an executable file, complete source
+//    code means the source code for all modules it contains. It does not
+//    include source code for modules or files that typically accompany the
+//    major components of the operating system on which the executable file
+//    runs.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+//
+//
+//
+// Filename: workerpool.cpp
+//
+// Description: Threads that process batches of independent jobs
+//
+//-----------------------------------------------------------------------------
+
+#include "workerpool.h"
+
+//*****************************************************************************
+//
+WorkerPool::WorkerPool( ) :
+	_function( NULL ),
+	_numJobs( 0 ),
+	_nextJob( 0 ),
+	_jobsRunning( 0 ),
+	_stopping( false )
+{
+}
+
+//*****************************************************************************
+//
+WorkerPool::~WorkerPool( )
+{
+	Stop( );
+}
+
+//*****************************************************************************
+//
+// Waits for the current batch and replaces the threads by numThreads new ones.
+void WorkerPool::Resize( unsigned int numThreads )
+{
+	Stop( );
+
+	_stopping = false;
+	for ( unsigned int i = 0; i < numThreads; ++i )
+		_threads.Push( new std::thread( &WorkerPool::WorkerMain, this ));
+}
+
+//*****************************************************************************
+//
+unsigned int WorkerPool::GetNumThreads( ) const
+{
+	return _threads.Size( );
+}
+
+//*****************************************************************************
+//
+void WorkerPool::Start( JobFunction function, unsigned int numJobs )
+{
+	Wait( );
+
+	if ( numJobs == 0 )
+		return;
+
+	// Without threads, the jobs are run right away.
+	if ( _threads.Size( ) == 0 )
+	{
+		for ( unsigned int i = 0; i < numJobs; ++i )
+			function( i );
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock( _mutex );
+		_function = function;
+		_numJobs = numJobs;
+		_nextJob = 0;
+	}
+	_jobsAvailable.notify_all( );
+}
+
+//*****************************************************************************
+//
+void WorkerPool::Wait( )
+{
+	std::unique_lock<std::mutex> lock( _mutex );
+	while (( _nextJob < _numJobs ) || ( _jobsRunning > 0 ))
+		_jobsDone.wait( lock );
+}
+
+//*****************************************************************************
+//
+bool WorkerPool::IsBusy( ) const
+{
+	std::lock_guard<std::mutex> lock( _mutex );
+	return (( _nextJob < _numJobs ) || ( _jobsRunning > 0 ));
+}
+
+//*****************************************************************************
+//
+void WorkerPool::Stop( )
+{
+	Wait( );
+
+	{
+		std::lock_guard<std::mutex> lock( _mutex );
+		_stopping = true;
+	}
+	_jobsAvailable.notify_all( );
+
+	for ( unsigned int i = 0; i < _threads.Size( ); ++i )
+	{
+		_threads[i]->join( );
+		delete _threads[i];
+	}
+	_threads.Clear( );
+}
+
+//*****************************************************************************
+//
+void WorkerPool::WorkerMain( )
+{
+	std::unique_lock<std::mutex> lock( _mutex );
+
+	for ( ;; )
+	{
+		while (( _stopping == false ) && ( _nextJob >= _numJobs ))
+			_jobsAvailable.wait( lock );
+
+		if ( _stopping )
+			return;
+
+		const unsigned int job = _nextJob++;
+		const JobFunction function = _function;
+		++_jobsRunning;
+
+		lock.unlock( );
+		function( job );
+		lock.lock( );
+
+		if (( --_jobsRunning == 0 ) && ( _nextJob >= _numJobs ))
+			_jobsDone.notify_all( );
+	}
+}
@@ -380,6 +380,8 @@ BEGIN_ENUM( SVC2 )
 	ENUM_ELEMENT ( SVC2_SRP_USER_PROCESS_CHALLENGE ),
 	ENUM_ELEMENT ( SVC2_SRP_USER_VERIFY_SESSION ),
 	ENUM_ELEMENT ( SVC2_RCONACCESS ),
+	ENUM_ELEMENT ( SVC2_MOVEPLAYERDELTA ),
+	ENUM_ELEMENT ( SVC2_DEMOKEYFRAME ),
 
 	ENUM_ELEMENT ( NUM_SVC2_COMMANDS ),
 }
@@ -446,6 +448,8 @@ BEGIN_ENUM( CLC )
 	ENUM_ELEMENT( CLC_SETWANTHIDEACCOUNT ),
 	ENUM_ELEMENT( CLC_SETVIDEORESOLUTION ),
 	ENUM_ELEMENT( CLC_RCONSETCVAR ),
+	ENUM_ELEMENT( CLC_ACKMOVESNAPSHOTS ),
+	ENUM_ELEMENT( CLC_REQUESTDEMOKEYFRAME ),
 
 	ENUM_ELEMENT( NUM_CLIENT_COMMANDS )
 }
@@ -730,6 +730,46 @@ void IPStringArray::SetFrom ( const NETADDRESS_s &Address )
 		itoa( Address.abIP[i], szAddress[i], 10 );
 }
 
+//*****************************************************************************
+//
+// Converts the address to the form used by IPList's lookup index. Octets gets the numbers, the
+// bits of WildcardMask tell which octets are wildcards. Returns false if an octet is neither,
+// e.g. has leading zeros. Such an octet never matches an address set by SetFrom.
+bool IPStringArray::GetPattern ( ULONG &Octets, unsigned int &WildcardMask ) const
+{
+	Octets = 0;
+	WildcardMask = 0;
+
+	for ( int i = 0; i < 4; ++i )
+	{
+		const char *pszOctet = szAddress[i];
+		ULONG ulValue = 0;
+
+		if ( pszOctet[0] == '*' )
+			WildcardMask |= 1 << i;
+		else if (( pszOctet[0] == '0' ) && ( pszOctet[1] == 0 ))
+			ulValue = 0;
+		else if (( pszOctet[0] >= '1' ) && ( pszOctet[0] <= '9' ))
+		{
+			for ( const char *p = pszOctet; *p; ++p )
+			{
+				if (( *p < '0' ) || ( *p > '9' ))
+					return false;
+				ulValue = ulValue * 10 + ( *p - '0' );
+			}
+
+			if ( ulValue > 255 )
+				return false;
+		}
+		else
+			return false;
+
+		Octets |= ulValue << ( 24 - 8 * i );
+	}
+
+	return true;
+}
+
 //*****************************************************************************
 //
 bool IPStringArray::SetFromString ( const char *pszAddressString )
@@ -1079,6 +1119,7 @@ bool IPList::clearAndLoadFromFile( const char *Filename )
 	IPFileParser parser( 65536 );
 
 	success = parser.parseIPList( Filename, _ipVector );
+	_indexValid = false;
 	if ( !success )
 		_error = parser.getErrorMessage();
 
@@ -1130,26 +1171,103 @@ void IPList::removeExpiredEntries( void )
 
 //*****************************************************************************
 //
-ULONG IPList::getFirstMatchingEntryIndex( const IPStringArray &szAddress ) const
+void IPList::rebuildIndex( ) const
 {
+	for ( unsigned int mask = 0; mask < countof( _index ); mask++ )
+		_index[mask].clear( );
+
 	for ( ULONG ulIdx = 0; ulIdx < _ipVector.size(); ulIdx++ )
 	{
-		if ( szAddress.Matches ( _ipVector[ulIdx].szIP ) )
+		ULONG ulOctets;
+		unsigned int wildcardMask;
+
+		// Entries that can't match any address aren't indexed.
+		if ( _ipVector[ulIdx].szIP.GetPattern( ulOctets, wildcardMask ) == false )
+			continue;
+
+		INDEXENTRY_s entry = { ulOctets, ulIdx };
+		_index[wildcardMask].push_back( entry );
+	}
+
+	// Of several entries with the same address, only the first one is needed.
+	for ( unsigned int mask = 0; mask < countof( _index ); mask++ )
+	{
+		std::vector<INDEXENTRY_s> &index = _index[mask];
+		std::sort( index.begin( ), index.end( ));
+		index.erase( std::unique( index.begin( ), index.end( ),
+			[] ( const INDEXENTRY_s &a, const INDEXENTRY_s &b ) { return a.ulOctets == b.ulOctets; } ), index.end( ));
+	}
+
+	_indexValid = true;
+}
+
+//*****************************************************************************
+//
+ULONG IPList::lookupIndex( ULONG ulOctets ) const
+{
+	if ( _indexValid == false )
+		rebuildIndex( );
+
+	ULONG ulFirstIdx = size();
+
+	for ( unsigned int mask = 0; mask < countof( _index ); mask++ )
+	{
+		const std::vector<INDEXENTRY_s> &index = _index[mask];
+		if ( index.empty( ))
+			continue;
+
+		// Clear the octets that are wildcards in the entries of this list.
+		ULONG ulKey = ulOctets;
+		for ( int i = 0; i < 4; i++ )
 		{
-			return ( ulIdx );
+			if ( mask & ( 1 << i ))
+				ulKey &= ~( 0xFFul << ( 24 - 8 * i ));
 		}
+
+		const INDEXENTRY_s key = { ulKey, 0 };
+		std::vector<INDEXENTRY_s>::const_iterator it = std::lower_bound( index.begin( ), index.end( ), key );
+		if (( it != index.end( )) && ( it->ulOctets == ulKey ) && ( it->ulIdx < ulFirstIdx ))
+			ulFirstIdx = it->ulIdx;
 	}
 
-	return ( size() );
+	return ( ulFirstIdx );
+}
+
+//*****************************************************************************
+//
+ULONG IPList::getFirstMatchingEntryIndex( const IPStringArray &szAddress ) const
+{
+	ULONG ulOctets;
+	unsigned int wildcardMask;
+
+	// Only plain addresses can be looked up in the index.
+	if ( szAddress.GetPattern( ulOctets, wildcardMask ) && ( wildcardMask == 0 ))
+		return lookupIndex( ulOctets );
+
+	return scanForFirstMatchingEntryIndex( szAddress );
 }
 
 //*****************************************************************************
 //
 ULONG IPList::getFirstMatchingEntryIndex( const NETADDRESS_s &Address ) const
 {
-	IPStringArray szAddress;
-	szAddress.SetFrom ( Address );
-	return getFirstMatchingEntryIndex( szAddress );
+	return lookupIndex(( static_cast<ULONG>( Address.abIP[0] ) << 24 ) | ( Address.abIP[1] << 16 ) | ( Address.abIP[2] << 8 ) | Address.abIP[3] );
+}
+
+//*****************************************************************************
+//
+// Checks all entries one by one, without the index.
+ULONG IPList::scanForFirstMatchingEntryIndex( const IPStringArray &szAddress ) const
+{
+	for ( ULONG ulIdx = 0; ulIdx < _ipVector.size(); ulIdx++ )
+	{
+		if ( szAddress.Matches ( _ipVector[ulIdx].szIP ) )
+		{
+			return ( ulIdx );
+		}
+	}
+
+	return ( size() );
 }
 
 //*****************************************************************************
@@ -1324,6 +1442,7 @@ void IPList::addEntry( const IPStringArray &szAddress, const char *pszPlayerName
 	newIPEntry.szComment[127] = 0;
 	newIPEntry.tExpirationDate = tExpiration;
 	_ipVector.push_back( newIPEntry );
+	_indexValid = false;
 
 	// Finally, append the IP to the file.
 	if ( (pFile = fopen( _filename.c_str(), "a" )) )
@@ -1393,6 +1512,7 @@ void IPList::removeEntry( ULONG ulEntryIdx )
 			_ipVector[ulIdx] = _ipVector[ulIdx+1];
 
 	_ipVector.pop_back();
+	_indexValid = false;
 	rewriteListToFile ();
 }
 
@@ -1479,6 +1599,7 @@ struct ASCENDINGIPSORT_S
 void IPList::sort()
 {
 	std::sort( _ipVector.begin(), _ipVector.end(), ASCENDINGIPSORT_S() );
+	_indexValid = false;
 }
 
 //=============================================================================
@@ -1496,7 +1617,43 @@ void IPList::sort()
 void QueryIPQueue::adjustHead( const LONG CurrentTime )
 {
 	while (( _iQueueHead != _iQueueTail ) && ( CurrentTime >= _IPQueue[_iQueueHead].lNextAllowedTime ))
-		_iQueueHead = ( _iQueueHead + 1 ) % MAX_QUERY_IPS;
+		removeHead( );
+}
+
+//=============================================================================
+//
+// hashAddress
+//
+// Returns the hash bucket of the given IP. The port is ignored.
+//
+//=============================================================================
+
+unsigned int QueryIPQueue::hashAddress( const NETADDRESS_s &Address )
+{
+	const unsigned int ip = ( static_cast<unsigned int>( Address.abIP[0] ) << 24 ) | ( Address.abIP[1] << 16 ) | ( Address.abIP[2] << 8 ) | Address.abIP[3];
+	return (( ip * 2654435761u ) >> 16 ) & ( NUM_HASH_BUCKETS - 1 );
+}
+
+//=============================================================================
+//
+// removeHead
+//
+// Removes the oldest entry, which is the last one of its hash bucket.
+//
+//=============================================================================
+
+void QueryIPQueue::removeHead( )
+{
+	const int head = static_cast<int>( _iQueueHead );
+	int *pLink = &_aiHashBuckets[hashAddress( _IPQueue[head].Address )];
+
+	while (( *pLink != -1 ) && ( *pLink != head ))
+		pLink = &_IPQueue[*pLink].iNextInBucket;
+
+	if ( *pLink == head )
+		*pLink = -1;
+
+	_iQueueHead = ( _iQueueHead + 1 ) % MAX_QUERY_IPS;
 }
 
 //=============================================================================
@@ -1509,8 +1666,8 @@ void QueryIPQueue::adjustHead( const LONG CurrentTime )
 
 bool QueryIPQueue::addressInQueue( const NETADDRESS_s AddressFrom ) const
 {
-	// Search through the queue.
-	for ( unsigned int i = _iQueueHead; i != _iQueueTail; i = ( i + 1 ) % MAX_QUERY_IPS )
+	// Search through the entries with the same hash.
+	for ( int i = _aiHashBuckets[hashAddress( AddressFrom )]; i != -1; i = _IPQueue[i].iNextInBucket )
 	{
 		if ( AddressFrom.CompareNoPort( _IPQueue[i].Address ))
 			return true;
@@ -1545,8 +1702,11 @@ bool QueryIPQueue::isFull( ) const
 void QueryIPQueue::addAddress( const NETADDRESS_s AddressFrom, const LONG lCurrentTime, std::ostream *errorOut )
 {
 	// Add and advance the tail.
+	const unsigned int bucket = hashAddress( AddressFrom );
 	_IPQueue[_iQueueTail].Address = AddressFrom;
 	_IPQueue[_iQueueTail].lNextAllowedTime = lCurrentTime + _iEntryLength;
+	_IPQueue[_iQueueTail].iNextInBucket = _aiHashBuckets[bucket];
+	_aiHashBuckets[bucket] = static_cast<int>( _iQueueTail );
 	_iQueueTail = ( _iQueueTail + 1 ) % MAX_QUERY_IPS;
 
 	// Is the queue full?
@@ -1555,6 +1715,6 @@ void QueryIPQueue::addAddress( const NETADDRESS_s AddressFrom, const LONG lCurre
 		if ( errorOut )
 			*errorOut << "WARNING! The IP flood queue is full.\n";
 
-		_iQueueHead = ( _iQueueHead + 1 ) % MAX_QUERY_IPS; // [RC] Start removing older entries.
+		removeHead( ); // [RC] Start removing older entries.
 	}
 }
@@ -239,6 +239,8 @@ public:
 		return 0;
 	}
 
+	bool GetPattern ( ULONG &Octets, unsigned int &WildcardMask ) const;
+
 	bool Matches ( const IPStringArray& otherWithWildcards ) const
 	{
 		for ( int i = 0; i < 4; ++i )
@@ -460,15 +462,36 @@ private:
 
 class IPList
 {
+	// An entry of the lookup index: the address of an entry with its wildcard octets set
+	// to zero, and the index of the first entry with that address.
+	struct INDEXENTRY_s
+	{
+		ULONG	ulOctets;
+		ULONG	ulIdx;
+
+		bool operator< ( const INDEXENTRY_s &Other ) const
+		{
+			return ( ulOctets != Other.ulOctets ) ? ( ulOctets < Other.ulOctets ) : ( ulIdx < Other.ulIdx );
+		}
+	};
+
 	std::vector<IPADDRESSBAN_s>		_ipVector;
 	std::string						_filename;
 	std::string						_error;
 
+	// The entries sorted by address, one list for each combination of wildcard octets.
+	// Rebuilt on the next lookup after the list was changed.
+	mutable std::vector<INDEXENTRY_s>	_index[16];
+	mutable bool					_indexValid;
+
 //*************************************************************************
 public:
+	IPList() : _indexValid( false ) { }
+
 	bool			clearAndLoadFromFile( const char *Filename );
 	ULONG			getFirstMatchingEntryIndex( const IPStringArray &szAddress ) const;
 	ULONG			getFirstMatchingEntryIndex( const NETADDRESS_s &Address ) const;
+	ULONG			scanForFirstMatchingEntryIndex( const IPStringArray &szAddress ) const;
 	bool			isIPInList( const IPStringArray &szAddress ) const;
 	bool			isIPInList( const NETADDRESS_s &Address ) const;
 	ULONG			doesEntryExist( const IPStringArray &szAddress ) const;
@@ -487,15 +510,17 @@ public:
 	void			removeExpiredEntries( void ); // [RC]
 
 	unsigned int	size() const { return static_cast<unsigned int>( _ipVector.size( )); }
-	void			clear() { _ipVector.clear(); }
-	void			push_back ( IPADDRESSBAN_s &IP ) { _ipVector.push_back(IP); }
+	void			clear() { _ipVector.clear(); _indexValid = false; }
+	void			push_back ( IPADDRESSBAN_s &IP ) { _ipVector.push_back(IP); _indexValid = false; }
 	const char*		getErrorMessage() const { return _error.c_str(); }
 	
-	std::vector<IPADDRESSBAN_s>&	getVector() { return _ipVector; }
+	std::vector<IPADDRESSBAN_s>&	getVector() { _indexValid = false; return _ipVector; }
 
 //*************************************************************************
 private:
 	bool rewriteListToFile ();
+	void rebuildIndex () const;
+	ULONG lookupIndex ( ULONG ulOctets ) const;
 };
 
 //==========================================================================
@@ -518,14 +543,24 @@ class QueryIPQueue
 		// Expiration date.
 		long				lNextAllowedTime;
 
+		// The next older entry in the same hash bucket, or -1.
+		int					iNextInBucket;
+
 	};
 
 	// The maximum number of entries that we can store.
 	static const unsigned int	MAX_QUERY_IPS = 512;
 
+	// Number of hash buckets, a power of two.
+	static const unsigned int	NUM_HASH_BUCKETS = 1024;
+
 	// The array of IPs.
 	STORED_QUERY_IP_t			_IPQueue[MAX_QUERY_IPS];
 
+	// The newest entry of each hash bucket, or -1. The entries of a bucket are
+	// chained from newest to oldest, so the head of the queue is always last.
+	int							_aiHashBuckets[NUM_HASH_BUCKETS];
+
 	// Head and tail of the queue.
 	unsigned int				_iQueueHead;
 	unsigned int				_iQueueTail;
@@ -533,16 +568,22 @@ class QueryIPQueue
 	// How long entries will last (seconds).
 	unsigned int				_iEntryLength;
 
+	static unsigned int	hashAddress( const NETADDRESS_s &Address );
+	void				removeHead( );
+
 //*************************************************************************
 public:
 	QueryIPQueue( int iEntryLength ) : _iQueueHead( 0 ), _iQueueTail( 0 ), _iEntryLength( iEntryLength )
 	{
+		for ( unsigned int i = 0; i < NUM_HASH_BUCKETS; ++i )
+			_aiHashBuckets[i] = -1;
 	}
 
 	void	adjustHead( const LONG CurrentTime );
 	bool	addressInQueue( const NETADDRESS_s AddressFrom ) const;
 	void	addAddress( const NETADDRESS_s AddressFrom, const LONG lCurrentTime, std::ostream *errorOut = NULL );
 	bool	isFull( ) const;
+	void	setEntryLength( unsigned int iEntryLength ) { _iEntryLength = iEntryLength; }
 };
 
 //==========================================================================
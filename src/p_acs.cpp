@@ -36,6 +36,7 @@
 */
 
 #include <assert.h>
+#include <algorithm>
 
 #include "templates.h"
 #include "doomdef.h"
@@ -65,6 +66,7 @@
 #include "gstrings.h"
 #include "gi.h"
 #include "sc_man.h"
+#include "stats.h"
 #include "c_bind.h"
 #include "info.h"
 #include "r_data/r_translate.h"
@@ -85,6 +87,7 @@
 #include "cooperative.h"
 #include "invasion.h"
 #include "sv_commands.h"
+#include "sv_profiler.h"
 #include "network/nettraffic.h"
 #include "za_database.h"
 #include "cl_commands.h"
@@ -427,8 +430,11 @@ int ACS_PushAndReturnDynamicString ( const FString &Work )
 
 ACSStringPool::ACSStringPool()
 {
-	memset(PoolBuckets, 0xFF, sizeof(PoolBuckets));
-	FirstFreeEntry = 0;
+	NumStrings = 0;
+	LiveAfterFullGC = 0;
+	bMarkingYoung = false;
+	Rehash(MIN_BUCKETS);
+	ResetStats();
 }
 
 //============================================================================
@@ -442,8 +448,12 @@ ACSStringPool::ACSStringPool()
 void ACSStringPool::Clear()
 {
 	Pool.Clear();
-	memset(PoolBuckets, 0xFF, sizeof(PoolBuckets));
-	FirstFreeEntry = 0;
+	FreeEntries.Clear();
+	YoungEntries.Clear();
+	NumStrings = 0;
+	LiveAfterFullGC = 0;
+	bMarkingYoung = false;
+	Rehash(MIN_BUCKETS);
 }
 
 //============================================================================
@@ -459,26 +469,24 @@ int ACSStringPool::AddString(const char *str)
 {
 	size_t len = strlen(str);
 	unsigned int h = SuperFastHash(str, len);
-	unsigned int bucketnum = h % NUM_BUCKETS;
-	int i = FindString(str, len, h, bucketnum);
+	int i = FindString(str, len, h);
 	if (i >= 0)
 	{
 		return i | STRPOOL_LIBRARYID_OR;
 	}
 	FString fstr(str);
-	return InsertString(fstr, h, bucketnum);
+	return InsertString(fstr, h);
 }
 
 int ACSStringPool::AddString(FString &str)
 {
 	unsigned int h = SuperFastHash(str.GetChars(), str.Len());
-	unsigned int bucketnum = h % NUM_BUCKETS;
-	int i = FindString(str, str.Len(), h, bucketnum);
+	int i = FindString(str, str.Len(), h);
 	if (i >= 0)
 	{
 		return i | STRPOOL_LIBRARYID_OR;
 	}
-	return InsertString(str, h, bucketnum);
+	return InsertString(str, h);
 }
 
 //============================================================================
@@ -545,7 +553,25 @@ void ACSStringPool::MarkString(int strnum)
 	assert((strnum & LIBRARYID_MASK) == STRPOOL_LIBRARYID_OR);
 	strnum &= ~LIBRARYID_MASK;
 	assert((unsigned)strnum < Pool.Size());
-	Pool[strnum].LockCount |= 0x80000000;
+	Mark(strnum);
+}
+
+//============================================================================
+//
+// ACSStringPool :: Mark
+//
+// Sets the mark checked by the purge functions. While collecting the young
+// strings, older strings are left alone: they aren't purged, so there's no
+// mark to clear on them afterwards.
+//
+//============================================================================
+
+void ACSStringPool::Mark(unsigned int num)
+{
+	if (!bMarkingYoung || Pool[num].Young)
+	{
+		Pool[num].LockCount |= 0x80000000;
+	}
 }
 
 //============================================================================
@@ -619,7 +645,7 @@ void ACSStringPool::MarkStringArray(const int *strnum, unsigned int count)
 			num &= ~LIBRARYID_MASK;
 			if ((unsigned)num < Pool.Size())
 			{
-				Pool[num].LockCount |= 0x80000000;
+				Mark(num);
 			}
 		}
 	}
@@ -646,7 +672,7 @@ void ACSStringPool::MarkStringMap(const FWorldGlobalArray &aray)
 			num &= ~LIBRARYID_MASK;
 			if ((unsigned)num < Pool.Size())
 			{
-				Pool[num].LockCount |= 0x80000000;
+				Mark(num);
 			}
 		}
 	}
@@ -679,37 +705,154 @@ void ACSStringPool::UnlockAll()
 
 void ACSStringPool::PurgeStrings()
 {
-	// Clear the hash buckets. We'll rebuild them as we decide what strings
-	// to keep and which to toss.
-	memset(PoolBuckets, 0xFF, sizeof(PoolBuckets));
-	size_t usedcount = 0, freedcount = 0;
-	for (unsigned int i = 0; i < Pool.Size(); ++i)
+	unsigned int usedcount = 0, freedcount = 0;
+
+	// Rebuild the free list from the top down, so that the lowest entries
+	// are handed out first.
+	FreeEntries.Clear();
+	for (unsigned int i = Pool.Size(); i-- > 0; )
 	{
 		PoolEntry *entry = &Pool[i];
-		if (entry->Next != FREE_ENTRY)
+		entry->Young = false;
+		if (entry->Next == FREE_ENTRY)
 		{
-			if (entry->LockCount == 0)
-			{
-				freedcount++;
-				// Mark this entry as free.
-				entry->Next = FREE_ENTRY;
-				if (i < FirstFreeEntry)
-				{
-					FirstFreeEntry = i;
-				}
-				// And free the string.
-				entry->Str = "";
-			}
-			else
+			FreeEntries.Push(i);
+		}
+		else if (entry->LockCount == 0)
+		{
+			freedcount++;
+			// Mark this entry as free.
+			entry->Next = FREE_ENTRY;
+			FreeEntries.Push(i);
+			// And free the string.
+			entry->Str = "";
+		}
+		else
+		{
+			usedcount++;
+			// Remove MarkString's mark.
+			entry->LockCount &= 0x7FFFFFFF;
+		}
+	}
+	YoungEntries.Clear();
+	bMarkingYoung = false;
+	NumStrings = usedcount;
+	LiveAfterFullGC = usedcount;
+
+	// Rehash the survivors. Only shrink the table if it's become mostly
+	// empty, so it doesn't flip back and forth between two sizes.
+	unsigned int numbuckets = PoolBuckets.Size();
+	while (numbuckets > MIN_BUCKETS && usedcount < numbuckets / 4)
+	{
+		numbuckets >>= 1;
+	}
+	Rehash(numbuckets);
+
+	Stats.FullCollections++;
+	Stats.FullFreed += freedcount;
+}
+
+//============================================================================
+//
+// ACSStringPool :: BeginYoungCollection
+//
+// Restricts marking to the strings added since the last collection, until
+// the next call to PurgeYoungStrings.
+//
+//============================================================================
+
+void ACSStringPool::BeginYoungCollection()
+{
+	bMarkingYoung = true;
+}
+
+//============================================================================
+//
+// ACSStringPool :: PurgeYoungStrings
+//
+// Remove the unlocked strings that were added since the last collection.
+// Most dynamic strings are only used for a moment, so this frees nearly as
+// much as PurgeStrings without visiting the whole pool. The strings that
+// survive are left to the next full collection.
+//
+//============================================================================
+
+void ACSStringPool::PurgeYoungStrings()
+{
+	unsigned int freedcount = 0, promotedcount = 0;
+	unsigned int mask = PoolBuckets.Size() - 1;
+
+	for (unsigned int j = 0; j < YoungEntries.Size(); ++j)
+	{
+		unsigned int i = YoungEntries[j];
+		PoolEntry *entry = &Pool[i];
+		if (entry->Next == FREE_ENTRY || !entry->Young)
+		{
+			continue;
+		}
+		entry->Young = false;
+		if (entry->LockCount == 0)
+		{
+			// Unlink this entry from its hash chain.
+			unsigned int *link = &PoolBuckets[entry->Hash & mask];
+			while (*link != i)
 			{
-				usedcount++;
-				// Rehash this entry.
-				unsigned int h = entry->Hash % NUM_BUCKETS;
-				entry->Next = PoolBuckets[h];
-				PoolBuckets[h] = i;
-				// Remove MarkString's mark.
-				entry->LockCount &= 0x7FFFFFFF;
+				assert(*link != NO_ENTRY);
+				link = &Pool[*link].Next;
 			}
+			*link = entry->Next;
+
+			freedcount++;
+			entry->Next = FREE_ENTRY;
+			entry->Str = "";
+			FreeEntries.Push(i);
+		}
+		else
+		{
+			promotedcount++;
+			entry->LockCount &= 0x7FFFFFFF;
+		}
+	}
+	YoungEntries.Clear();
+	bMarkingYoung = false;
+	NumStrings -= freedcount;
+
+	Stats.YoungCollections++;
+	Stats.YoungFreed += freedcount;
+	Stats.Promoted += promotedcount;
+}
+
+//============================================================================
+//
+// ACSStringPool :: Rehash
+//
+// Rebuilds the hash chains with the given number of buckets, which must be
+// a power of two.
+//
+//============================================================================
+
+void ACSStringPool::Rehash(unsigned int numbuckets)
+{
+	assert((numbuckets & (numbuckets - 1)) == 0);
+	if (numbuckets != PoolBuckets.Size())
+	{
+		if (PoolBuckets.Size() != 0)
+		{
+			Stats.Rehashes++;
+		}
+		PoolBuckets.Resize(numbuckets);
+	}
+	memset(&PoolBuckets[0], 0xFF, numbuckets * sizeof(PoolBuckets[0]));
+
+	unsigned int mask = numbuckets - 1;
+	for (unsigned int i = 0; i < Pool.Size(); ++i)
+	{
+		PoolEntry *entry = &Pool[i];
+		if (entry->Next != FREE_ENTRY)
+		{
+			unsigned int h = entry->Hash & mask;
+			entry->Next = PoolBuckets[h];
+			PoolBuckets[h] = i;
 		}
 	}
 }
@@ -723,9 +866,9 @@ void ACSStringPool::PurgeStrings()
 //
 //============================================================================
 
-int ACSStringPool::FindString(const char *str, size_t len, unsigned int h, unsigned int bucketnum)
+int ACSStringPool::FindString(const char *str, size_t len, unsigned int h)
 {
-	unsigned int i = PoolBuckets[bucketnum];
+	unsigned int i = PoolBuckets[h & (PoolBuckets.Size() - 1)];
 	while (i != NO_ENTRY)
 	{
 		PoolEntry *entry = &Pool[i];
@@ -748,51 +891,54 @@ int ACSStringPool::FindString(const char *str, size_t len, unsigned int h, unsig
 //
 //============================================================================
 
-int ACSStringPool::InsertString(FString &str, unsigned int h, unsigned int bucketnum)
+int ACSStringPool::InsertString(FString &str, unsigned int h)
 {
-	unsigned int index = FirstFreeEntry;
-	if (index >= MIN_GC_SIZE && index == Pool.Max())
-	{ // We will need to grow the array. Try a garbage collection first.
-		P_CollectACSGlobalStrings();
-		index = FirstFreeEntry;
+	if (YoungEntries.Size() >= YOUNG_GC_SIZE)
+	{
+		P_CollectACSYoungStrings();
+	}
+	if (FreeEntries.Size() == 0 && Pool.Size() >= MIN_GC_SIZE && Pool.Size() == Pool.Max())
+	{ // We will need to grow the array. Try collecting the young strings first,
+	  // and only look at the whole pool if it has doubled since the last time.
+		if (YoungEntries.Size() != 0)
+		{
+			P_CollectACSYoungStrings();
+		}
+		if (FreeEntries.Size() == 0 && NumStrings >= 2 * MAX<unsigned int>(LiveAfterFullGC, MIN_GC_SIZE))
+		{
+			P_CollectACSGlobalStrings();
+		}
 	}
-	if (FirstFreeEntry >= STRPOOL_LIBRARYID_OR)
-	{ // If we go any higher, we'll collide with the library ID marker.
-		return -1;
+	unsigned int index;
+	if (FreeEntries.Size() != 0)
+	{
+		FreeEntries.Pop(index);
 	}
-	if (index == Pool.Size())
+	else
 	{ // There were no free entries; make a new one.
+		index = Pool.Size();
+		if (index >= STRPOOL_LIBRARYID_OR)
+		{ // If we go any higher, we'll collide with the library ID marker.
+			return -1;
+		}
 		Pool.Reserve(1);
-		FirstFreeEntry++;
-	}
-	else
-	{ // Scan for the next free entry
-		FindFirstFreeEntry(FirstFreeEntry + 1);
 	}
+	unsigned int bucketnum = h & (PoolBuckets.Size() - 1);
 	PoolEntry *entry = &Pool[index];
 	entry->Str = str;
 	entry->Hash = h;
 	entry->Next = PoolBuckets[bucketnum];
 	entry->LockCount = 0;
+	entry->Young = true;
 	PoolBuckets[bucketnum] = index;
-	return index | STRPOOL_LIBRARYID_OR;
-}
-
-//============================================================================
-//
-// ACSStringPool :: FindFirstFreeEntry
-//
-// Finds the first free entry, starting at base.
-//
-//============================================================================
+	YoungEntries.Push(index);
 
-void ACSStringPool::FindFirstFreeEntry(unsigned base)
-{
-	while (base < Pool.Size() && Pool[base].Next != FREE_ENTRY)
+	// Keep the chains short by doubling the table once it's fully loaded.
+	if (++NumStrings > PoolBuckets.Size())
 	{
-		base++;
+		Rehash(PoolBuckets.Size() * 2);
 	}
-	FirstFreeEntry = base;
+	return index | STRPOOL_LIBRARYID_OR;
 }
 
 //============================================================================
@@ -812,38 +958,47 @@ void ACSStringPool::ReadStrings(PNGHandle *png, DWORD id)
 	{
 		FPNGChunkArchive arc(png->File->GetFile(), id, len);
 		int32 i, j, poolsize;
-		unsigned int h, bucketnum;
 		char *str = NULL;
 
 		arc << poolsize;
 
 		Pool.Resize(poolsize);
-		i = 0;
+		for (i = 0; i < poolsize; ++i)
+		{
+			Pool[i].Next = FREE_ENTRY;
+			Pool[i].LockCount = 0;
+			Pool[i].Young = false;
+		}
 		j = arc.ReadCount();
 		while (j >= 0)
 		{
-			// Mark skipped entries as free
-			for (; i < j; ++i)
-			{
-				Pool[i].Next = FREE_ENTRY;
-				Pool[i].LockCount = 0;
-			}
 			arc << str;
-			h = SuperFastHash(str, strlen(str));
-			bucketnum = h % NUM_BUCKETS;
-			Pool[i].Str = str;
-			Pool[i].Hash = h;
-			Pool[i].LockCount = arc.ReadCount();
-			Pool[i].Next = PoolBuckets[bucketnum];
-			PoolBuckets[bucketnum] = i;
-			i++;
+			Pool[j].Str = str;
+			Pool[j].Hash = SuperFastHash(str, strlen(str));
+			Pool[j].LockCount = arc.ReadCount();
+			Pool[j].Next = NO_ENTRY;
+			NumStrings++;
 			j = arc.ReadCount();
 		}
 		if (str != NULL)
 		{
 			delete[] str;
 		}
-		FindFirstFreeEntry(0);
+		for (i = poolsize; i-- > 0; )
+		{
+			if (Pool[i].Next == FREE_ENTRY)
+			{
+				FreeEntries.Push(i);
+			}
+		}
+		LiveAfterFullGC = NumStrings;
+
+		unsigned int numbuckets = MIN_BUCKETS;
+		while (numbuckets < NumStrings)
+		{
+			numbuckets <<= 1;
+		}
+		Rehash(numbuckets);
 	}
 }
 
@@ -893,10 +1048,77 @@ void ACSStringPool::Dump() const
 	{
 		if (Pool[i].Next != FREE_ENTRY)
 		{
-			Printf("%4u. (%2d) \"%s\"\n", i, Pool[i].LockCount, Pool[i].Str.GetChars());
+			Printf("%4u. (%2d) \"%s\"%s\n", i, Pool[i].LockCount, Pool[i].Str.GetChars(), Pool[i].Young ? " young" : "");
 		}
 	}
-	Printf("First free %u\n", FirstFreeEntry);
+	Printf("%u free\n", FreeEntries.Size());
+}
+
+//============================================================================
+//
+// ACSStringPool :: DumpStats
+//
+// Prints the pool's size, the shape of its hash table, and how much time
+// has been spent collecting it.
+//
+//============================================================================
+
+void ACSStringPool::DumpStats() const
+{
+	unsigned int longest = 0, used = 0;
+	for (unsigned int b = 0; b < PoolBuckets.Size(); ++b)
+	{
+		unsigned int chain = 0;
+		for (unsigned int i = PoolBuckets[b]; i != NO_ENTRY; i = Pool[i].Next)
+		{
+			chain++;
+		}
+		if (chain != 0)
+		{
+			used++;
+		}
+		longest = MAX(longest, chain);
+	}
+
+	Printf("%u strings (%u young) in %u entries, %u free\n",
+		NumStrings, YoungEntries.Size(), Pool.Size(), FreeEntries.Size());
+	Printf("%u buckets (%u used), load %.2f, longest chain %u, %u rehashes\n",
+		PoolBuckets.Size(), used, double(NumStrings) / PoolBuckets.Size(), longest, Stats.Rehashes);
+	Printf("Young collections: %u, %u freed, %u promoted, %.3f ms (max %.3f ms)\n",
+		Stats.YoungCollections, Stats.YoungFreed, Stats.Promoted, Stats.YoungMS, Stats.MaxYoungMS);
+	Printf("Full collections: %u, %u freed, %.3f ms (max %.3f ms)\n",
+		Stats.FullCollections, Stats.FullFreed, Stats.FullMS, Stats.MaxFullMS);
+}
+
+//============================================================================
+//
+// ACSStringPool :: ResetStats
+//
+//============================================================================
+
+void ACSStringPool::ResetStats()
+{
+	memset(&Stats, 0, sizeof(Stats));
+}
+
+//============================================================================
+//
+// ACSStringPool :: AddCollectionTime
+//
+//============================================================================
+
+void ACSStringPool::AddCollectionTime(bool young, double ms)
+{
+	if (young)
+	{
+		Stats.YoungMS += ms;
+		Stats.MaxYoungMS = MAX(Stats.MaxYoungMS, ms);
+	}
+	else
+	{
+		Stats.FullMS += ms;
+		Stats.MaxFullMS = MAX(Stats.MaxFullMS, ms);
+	}
 }
 
 //============================================================================
@@ -956,13 +1178,13 @@ void P_MarkGlobalVarStrings()
 
 //============================================================================
 //
-// P_CollectACSGlobalStrings
+// MarkACSStringRoots
 //
-// Garbage collect ACS global strings.
+// Marks every string that's still referenced by a stack or a variable.
 //
 //============================================================================
 
-void P_CollectACSGlobalStrings()
+static void MarkACSStringRoots()
 {
 	for (FACSStack *stack = FACSStack::head; stack != NULL; stack = stack->next)
 	{
@@ -984,7 +1206,58 @@ void P_CollectACSGlobalStrings()
 	FBehavior::StaticMarkLevelVarStrings();
 	P_MarkWorldVarStrings();
 	P_MarkGlobalVarStrings();
+}
+
+//============================================================================
+//
+// P_CollectACSGlobalStrings
+//
+// Garbage collect ACS global strings.
+//
+//============================================================================
+
+void P_CollectACSGlobalStrings()
+{
+	cycle_t clock;
+
+	clock.Reset();
+	clock.Clock();
+	MarkACSStringRoots();
 	GlobalACSStrings.PurgeStrings();
+	clock.Unclock();
+	GlobalACSStrings.AddCollectionTime(false, clock.TimeMS());
+}
+
+//============================================================================
+//
+// P_CollectACSYoungStrings
+//
+// Garbage collect only the ACS global strings that were added since the
+// last collection.
+//
+//============================================================================
+
+void P_CollectACSYoungStrings()
+{
+	cycle_t clock;
+
+	clock.Reset();
+	clock.Clock();
+	GlobalACSStrings.BeginYoungCollection();
+	MarkACSStringRoots();
+	GlobalACSStrings.PurgeYoungStrings();
+	clock.Unclock();
+	GlobalACSStrings.AddCollectionTime(true, clock.TimeMS());
+}
+
+CCMD(acsstringstats)
+{
+	if (argv.argc() > 1 && stricmp(argv[1], "reset") == 0)
+	{
+		GlobalACSStrings.ResetStats();
+		return;
+	}
+	GlobalACSStrings.DumpStats();
 }
 
 #ifdef _DEBUG
@@ -3490,6 +3763,7 @@ DACSThinker::DACSThinker ()
 		Scripts = NULL;
 		LastScript = NULL;
 		RunningScripts.Clear();
+		ResetSchedule ();
 	}
 }
 
@@ -3532,19 +3806,39 @@ void DACSThinker::Serialize (FArchive &arc)
 			RunningScripts[scriptnum] = script;
 			arc << script;
 		}
+		RebuildSchedule ();
 	}
 }
 
 void DACSThinker::Tick ()
 {
-	DLevelScript *script = Scripts;
+	static TArray<DLevelScript *> woken;
+
+	TickCount++;
+	WheelAdvance (woken);
+	PollWaiters (woken);
+	RunQueueMerge (woken);
 
-	while (script)
+	// Visit the runnable scripts in list order. This matches walking the
+	// whole list: scripts put in front of the current one wait for the next
+	// tic, and the walk ends after the script that was last in the list.
+	bIterating = true;
+	Cursor = RunQueue;
+	while (Cursor != NULL)
 	{
-		DLevelScript *next = script->next;
+		DLevelScript *script = Cursor;
+		const bool last = (script->next == NULL);
+
+		CursorKey = script->OrderKey + 1;
+		Cursor = script->QueueNext;
 		script->RunScript ();
-		script = next;
+		if (last)
+		{
+			break;
+		}
 	}
+	bIterating = false;
+	Cursor = NULL;
 
 //	GlobalACSStrings.Clear();
 
@@ -3601,6 +3895,396 @@ void DACSThinker::StopAndDestroyAllScripts ()
 	}
 }
 
+// Script scheduling --------------------------------------------------------
+
+static bool TaggedSectorsBusy (int tag)
+{
+	int secnum = -1;
+
+	while ((secnum = P_FindSectorFromTag (tag, secnum)) >= 0)
+		if (sectors[secnum].floordata || sectors[secnum].ceilingdata)
+			return true;
+
+	return false;
+}
+
+void DACSThinker::ResetSchedule ()
+{
+	RunQueue = RunQueueTail = NULL;
+	Cursor = NULL;
+	CursorKey = 0;
+	bIterating = false;
+	FirstKey = LastKey = 0;
+	TickCount = 0;
+	WheelTime = 1;
+	memset (Wheel, 0, sizeof(Wheel));
+	for (int i = 0; i < NUM_QUEUES; ++i)
+	{
+		WaitLists[i].Clear();
+		QueueCounts[i] = 0;
+	}
+}
+
+void DACSThinker::RebuildSchedule ()
+{
+	ResetSchedule ();
+
+	// Saves only keep the list itself, so number it again from the head.
+	SQWORD key = 0;
+	for (DLevelScript *script = Scripts; script != NULL; script = script->next)
+	{
+		script->OrderKey = key++;
+		script->Queue = QUEUE_None;
+		script->QueueNext = script->QueuePrev = NULL;
+		Schedule (script);
+	}
+	LastKey = key - 1;
+}
+
+void DACSThinker::Schedule (DLevelScript *script)
+{
+	int queue;
+
+	Unschedule (script);
+
+	switch (script->state)
+	{
+	case DLevelScript::SCRIPT_Suspended:
+		// Only P_GetScriptGoing or SetScriptState can get it going again.
+		return;
+
+	case DLevelScript::SCRIPT_Delayed:
+		script->WakeTick = (script->statedata > INT_MAX - TickCount) ? INT_MAX : TickCount + script->statedata;
+		WheelInsert (script);
+		return;
+
+	case DLevelScript::SCRIPT_TagWait:		queue = QUEUE_TagWait;			break;
+	case DLevelScript::SCRIPT_PolyWait:		queue = QUEUE_PolyWait;			break;
+	case DLevelScript::SCRIPT_ScriptWaitPre:	queue = QUEUE_ScriptWaitPre;	break;
+	case DLevelScript::SCRIPT_ScriptWait:	queue = QUEUE_ScriptWait;		break;
+
+	default:
+		RunQueueInsert (script);
+		return;
+	}
+
+	DLevelScript **head = WaitLists[queue].CheckKey (script->statedata);
+
+	script->QueuePrev = NULL;
+	script->QueueNext = (head != NULL) ? *head : NULL;
+	if (script->QueueNext != NULL)
+	{
+		script->QueueNext->QueuePrev = script;
+	}
+	WaitLists[queue][script->statedata] = script;
+	script->Queue = queue;
+	script->QueueKey = script->statedata;
+	QueueCounts[queue]++;
+}
+
+void DACSThinker::Unschedule (DLevelScript *script)
+{
+	DLevelScript *prev = script->QueuePrev;
+	DLevelScript *next = script->QueueNext;
+
+	switch (script->Queue)
+	{
+	case QUEUE_None:
+		return;
+
+	case QUEUE_Run:
+		if (Cursor == script)
+		{
+			Cursor = next;
+		}
+		if (prev != NULL)
+			prev->QueueNext = next;
+		else
+			RunQueue = next;
+		if (next != NULL)
+			next->QueuePrev = prev;
+		else
+			RunQueueTail = prev;
+		break;
+
+	case QUEUE_Wheel:
+		// Keep the remaining delay in case the script gets filed again.
+		script->statedata = MAX (1, script->WakeTick - TickCount);
+		if (prev != NULL)
+			prev->QueueNext = next;
+		else
+			Wheel[script->QueueKey] = next;
+		if (next != NULL)
+			next->QueuePrev = prev;
+		break;
+
+	default:
+		if (prev != NULL)
+			prev->QueueNext = next;
+		else if (next != NULL)
+			WaitLists[script->Queue][script->QueueKey] = next;
+		else
+			WaitLists[script->Queue].Remove (script->QueueKey);
+		if (next != NULL)
+			next->QueuePrev = prev;
+		break;
+	}
+
+	QueueCounts[script->Queue]--;
+	script->Queue = QUEUE_None;
+	script->QueueNext = script->QueuePrev = NULL;
+}
+
+void DACSThinker::RunQueueLink (DLevelScript *script, DLevelScript *before)
+{
+	script->QueueNext = before;
+	script->QueuePrev = (before != NULL) ? before->QueuePrev : RunQueueTail;
+	if (script->QueuePrev != NULL)
+		script->QueuePrev->QueueNext = script;
+	else
+		RunQueue = script;
+	if (before != NULL)
+		before->QueuePrev = script;
+	else
+		RunQueueTail = script;
+	script->Queue = QUEUE_Run;
+	QueueCounts[QUEUE_Run]++;
+
+	// A script that lands between the current one and the cursor
+	// still gets its turn during this tic.
+	if (bIterating && script->OrderKey >= CursorKey &&
+		(Cursor == NULL || script->OrderKey < Cursor->OrderKey))
+	{
+		Cursor = script;
+	}
+}
+
+void DACSThinker::RunQueueInsert (DLevelScript *script)
+{
+	DLevelScript *before;
+
+	// New scripts go to the head of the list, so check that first.
+	if (RunQueue == NULL || script->OrderKey < RunQueue->OrderKey)
+	{
+		before = RunQueue;
+	}
+	else
+	{
+		DLevelScript *after = RunQueueTail;
+		while (after->OrderKey > script->OrderKey)
+		{
+			after = after->QueuePrev;
+		}
+		before = after->QueueNext;
+	}
+	RunQueueLink (script, before);
+}
+
+void DACSThinker::RunQueueMerge (TArray<DLevelScript *> &scripts)
+{
+	if (scripts.Size() == 0)
+	{
+		return;
+	}
+
+	std::sort (&scripts[0], &scripts[0] + scripts.Size(),
+		[]( const DLevelScript *a, const DLevelScript *b ) { return a->OrderKey < b->OrderKey; });
+
+	DLevelScript *before = RunQueue;
+	for (unsigned int i = 0; i < scripts.Size(); ++i)
+	{
+		while (before != NULL && before->OrderKey < scripts[i]->OrderKey)
+		{
+			before = before->QueueNext;
+		}
+		RunQueueLink (scripts[i], before);
+	}
+	scripts.Clear();
+}
+
+//==========================================================================
+//
+// The timing wheel has WHEEL_LEVELS levels of WHEEL_SIZE slots each. Level 0
+// holds the scripts due within the next WHEEL_SIZE tics, one slot per tic.
+// Every level above covers WHEEL_SIZE times as much, and its slots are
+// moved down a level whenever the level beneath wraps around.
+//
+//==========================================================================
+
+void DACSThinker::WheelInsert (DLevelScript *script)
+{
+	const int range = 1 << (WHEEL_BITS * WHEEL_LEVELS);
+	int expires = script->WakeTick;
+	int delta = expires - WheelTime;
+	int level = 0;
+
+	if (delta < 0)
+	{
+		expires = WheelTime;
+	}
+	else
+	{
+		// Anything further away than the wheel can hold waits at its far end
+		// and is filed again from there.
+		if (delta >= range)
+		{
+			expires = WheelTime + range - 1;
+			delta = range - 1;
+		}
+		while (level < WHEEL_LEVELS - 1 && delta >= 1 << (WHEEL_BITS * (level + 1)))
+		{
+			level++;
+		}
+	}
+
+	const int slot = level * WHEEL_SIZE + ((expires >> (WHEEL_BITS * level)) & WHEEL_MASK);
+
+	script->QueuePrev = NULL;
+	script->QueueNext = Wheel[slot];
+	if (Wheel[slot] != NULL)
+	{
+		Wheel[slot]->QueuePrev = script;
+	}
+	Wheel[slot] = script;
+	script->Queue = QUEUE_Wheel;
+	script->QueueKey = slot;
+	QueueCounts[QUEUE_Wheel]++;
+}
+
+void DACSThinker::WheelCascade (int level, int slot)
+{
+	DLevelScript *script = Wheel[level * WHEEL_SIZE + slot];
+
+	Wheel[level * WHEEL_SIZE + slot] = NULL;
+	while (script != NULL)
+	{
+		DLevelScript *next = script->QueueNext;
+		QueueCounts[QUEUE_Wheel]--;
+		WheelInsert (script);
+		script = next;
+	}
+}
+
+void DACSThinker::WheelAdvance (TArray<DLevelScript *> &woken)
+{
+	while (WheelTime <= TickCount)
+	{
+		const int index = WheelTime & WHEEL_MASK;
+
+		if (index == 0)
+		{
+			for (int level = 1; level < WHEEL_LEVELS; ++level)
+			{
+				const int slot = (WheelTime >> (WHEEL_BITS * level)) & WHEEL_MASK;
+				WheelCascade (level, slot);
+				if (slot != 0)
+				{
+					break;
+				}
+			}
+		}
+
+		DLevelScript *script = Wheel[index];
+		Wheel[index] = NULL;
+		while (script != NULL)
+		{
+			DLevelScript *next = script->QueueNext;
+			QueueCounts[QUEUE_Wheel]--;
+			script->Queue = QUEUE_None;
+			script->QueueNext = script->QueuePrev = NULL;
+			// RunScript does the last decrement and gets it running again.
+			script->statedata = 1;
+			woken.Push (script);
+			script = next;
+		}
+		WheelTime++;
+	}
+}
+
+void DACSThinker::TakeWaiters (int queue, int key, TArray<DLevelScript *> &woken)
+{
+	DLevelScript **head = WaitLists[queue].CheckKey (key);
+
+	if (head == NULL)
+	{
+		return;
+	}
+
+	DLevelScript *script = *head;
+	WaitLists[queue].Remove (key);
+	while (script != NULL)
+	{
+		DLevelScript *next = script->QueueNext;
+		QueueCounts[queue]--;
+		script->Queue = QUEUE_None;
+		script->QueueNext = script->QueuePrev = NULL;
+		woken.Push (script);
+		script = next;
+	}
+}
+
+// The scripts only get another look; RunScript checks for themselves
+// whether what they wait for is really over.
+void DACSThinker::WakeWaiters (int queue, int key)
+{
+	TArray<DLevelScript *> woken;
+
+	TakeWaiters (queue, key, woken);
+	RunQueueMerge (woken);
+}
+
+// Not everything that stops a sector or polyobject tells us about it, so
+// every object that is waited for is checked once per tic as well. That is
+// one check per object instead of one per waiting script.
+void DACSThinker::PollWaiters (TArray<DLevelScript *> &woken)
+{
+	static TArray<int> ready;
+
+	for (int queue = QUEUE_TagWait; queue < NUM_QUEUES; ++queue)
+	{
+		WaitMap::Iterator it(WaitLists[queue]);
+		WaitMap::Pair *pair;
+
+		ready.Clear();
+		while (it.NextPair(pair))
+		{
+			bool bReady;
+
+			switch (queue)
+			{
+			case QUEUE_TagWait:			bReady = !TaggedSectorsBusy (pair->Key);					break;
+			case QUEUE_PolyWait:		bReady = !PO_Busy (pair->Key);							break;
+			case QUEUE_ScriptWaitPre:	bReady = (RunningScripts.CheckKey (pair->Key) != NULL);	break;
+			default:					bReady = (RunningScripts.CheckKey (pair->Key) == NULL);	break;
+			}
+			if (bReady)
+			{
+				ready.Push (pair->Key);
+			}
+		}
+		for (unsigned int i = 0; i < ready.Size(); ++i)
+		{
+			TakeWaiters (queue, ready[i], woken);
+		}
+	}
+}
+
+void DACSThinker::NotifyTagIdle (int tag)
+{
+	if (ActiveThinker != NULL)
+	{
+		ActiveThinker->WakeWaiters (QUEUE_TagWait, tag);
+	}
+}
+
+void DACSThinker::NotifyPolyIdle (int polynum)
+{
+	if (ActiveThinker != NULL)
+	{
+		ActiveThinker->WakeWaiters (QUEUE_PolyWait, polynum);
+	}
+}
+
 IMPLEMENT_POINTY_CLASS (DLevelScript)
  DECLARE_POINTER(next)
  DECLARE_POINTER(prev)
@@ -3624,6 +4308,12 @@ void DLevelScript::Serialize (FArchive &arc)
 
 	P_SerializeACSScriptNumber(arc, script, false);
 
+	// Delayed scripts in the timing wheel don't count down statedata.
+	if (arc.IsStoring() && Queue == DACSThinker::QUEUE_Wheel)
+	{
+		statedata = MAX (1, WakeTick - DACSThinker::ActiveThinker->TickCount);
+	}
+
 	arc	<< state
 		<< statedata
 		<< activator
@@ -3682,6 +4372,10 @@ void DLevelScript::Serialize (FArchive &arc)
 DLevelScript::DLevelScript ()
 {
 	next = prev = NULL;
+	OrderKey = 0;
+	QueueNext = QueuePrev = NULL;
+	Queue = DACSThinker::QUEUE_None;
+	QueueKey = WakeTick = 0;
 	if (DACSThinker::ActiveThinker == NULL)
 		new DACSThinker;
 	activefont = SmallFont;
@@ -3699,6 +4393,8 @@ void DLevelScript::Unlink ()
 {
 	DACSThinker *controller = DACSThinker::ActiveThinker;
 
+	controller->Unschedule (this);
+
 	if (controller->LastScript == this)
 	{
 		controller->LastScript = prev;
@@ -3739,6 +4435,8 @@ void DLevelScript::Link ()
 	{
 		controller->LastScript = this;
 	}
+	OrderKey = --controller->FirstKey;
+	controller->Schedule (this);
 }
 
 void DLevelScript::PutLast ()
@@ -3760,9 +4458,17 @@ void DLevelScript::PutLast ()
 		prev = controller->LastScript;
 		next = NULL;
 		controller->LastScript = this;
+		OrderKey = ++controller->LastKey;
+		controller->Schedule (this);
 	}
 }
 
+void DLevelScript::SetState (EScriptState newstate)
+{
+	state = newstate;
+	DACSThinker::ActiveThinker->Schedule (this);
+}
+
 void DLevelScript::PutFirst ()
 {
 	DACSThinker *controller = DACSThinker::ActiveThinker;
@@ -8377,6 +9083,9 @@ int DLevelScript::RunScript ()
 	// [BB] Start to measure how much outbound net traffic this call of DLevelScript::RunScript() needs.
 	NETWORK_StartTrafficMeasurement ( );
 
+	// Measure how long this call took for the server profiler.
+	const SQWORD qwProfilerStart = SERVERPROFILER_IsActive( ) ? SERVERPROFILER_Now( ) : 0;
+
 	switch (state)
 	{
 	// [AK] If this is the first tic of an event script, initialize the result value to whatever the current
@@ -8399,17 +9108,15 @@ int DLevelScript::RunScript ()
 	case SCRIPT_TagWait:
 		// Wait for tagged sector(s) to go inactive, then enter
 		// state running
-	{
-		int secnum = -1;
-
-		while ((secnum = P_FindSectorFromTag (statedata, secnum)) >= 0)
-			if (sectors[secnum].floordata || sectors[secnum].ceilingdata)
-				return resultValue;
+		if (TaggedSectorsBusy (statedata))
+		{
+			controller->Schedule (this);
+			return resultValue;
+		}
 
 		// If we got here, none of the tagged sectors were busy
 		state = SCRIPT_Running;
-	}
-	break;
+		break;
 
 	case SCRIPT_PolyWait:
 		// Wait for polyobj(s) to stop moving, then enter state running
@@ -8428,7 +9135,10 @@ int DLevelScript::RunScript ()
 	case SCRIPT_ScriptWait:
 		// Wait for a script to stop running, then enter state running
 		if (controller->RunningScripts.CheckKey(statedata) != NULL)
+		{
+			controller->Schedule (this);
 			return resultValue;
+		}
 
 		state = SCRIPT_Running;
 		PutFirst ();
@@ -12243,12 +12953,14 @@ scriptwait:
 			*running == this)
 		{
 			controller->RunningScripts.Remove(script);
+			controller->WakeWaiters (DACSThinker::QUEUE_ScriptWait, script);
 		}
 	}
 	else
 	{
 		this->pc = pc;
 		assert (sp == 0);
+		controller->Schedule (this);
 	}
 
 	// [AK] We're done running this script so any action or line specials activated now aren't done in ACS.
@@ -12257,6 +12969,8 @@ scriptwait:
 	// [BB] Stop the net traffic measurement and add the result to this script's traffic.
 	NETTRAFFIC_AddACSScriptTraffic ( script, NETWORK_StopTrafficMeasurement ( ) );
 
+	SERVERPROFILER_AddACSScriptTime ( script, qwProfilerStart );
+
 	return resultValue;
 }
 
@@ -12337,11 +13051,19 @@ DLevelScript::DLevelScript (AActor *who, line_t *where, int num, const ScriptPtr
 	// set in an editor. If an open script sets them, it looks dumb if a second
 	// goes by while they're in their default state.
 
+	OrderKey = 0;
+	QueueNext = QueuePrev = NULL;
+	Queue = DACSThinker::QUEUE_None;
+	QueueKey = WakeTick = 0;
+
 	if (!(flags & ACS_ALWAYS))
 		DACSThinker::ActiveThinker->RunningScripts[num] = this;
 
 	Link();
 
+	if (!(flags & ACS_ALWAYS))
+		DACSThinker::ActiveThinker->WakeWaiters (DACSThinker::QUEUE_ScriptWaitPre, num);
+
 	if (level.flags2 & LEVEL2_HEXENHACK)
 	{
 		PutLast();
@@ -12586,6 +13308,9 @@ void DACSThinker::DumpScriptStatus ()
 		Printf("%s: %s\n", ScriptPresentation(script->script).GetChars(), stateNames[script->state]);
 		script = script->next;
 	}
+
+	Printf("%d runnable, %d delayed, %d waiting\n", QueueCounts[QUEUE_Run], QueueCounts[QUEUE_Wheel],
+		QueueCounts[QUEUE_TagWait] + QueueCounts[QUEUE_PolyWait] + QueueCounts[QUEUE_ScriptWaitPre] + QueueCounts[QUEUE_ScriptWait]);
 }
 
 // Profiling support --------------------------------------------------------
@@ -122,35 +122,56 @@ public:
 	void UnlockStringArray(const int *strnum, unsigned int count);
 	void MarkStringArray(const int *strnum, unsigned int count);
 	void MarkStringMap(const FWorldGlobalArray &array);
+	void BeginYoungCollection();
 	void PurgeStrings();
+	void PurgeYoungStrings();
 	void Clear();
 	void Dump() const;
+	void DumpStats() const;
+	void ResetStats();
+	void AddCollectionTime(bool young, double ms);
 	void ReadStrings(PNGHandle *png, DWORD id);
 	void WriteStrings(FILE *file, DWORD id) const;
 
 private:
-	int FindString(const char *str, size_t len, unsigned int h, unsigned int bucketnum);
-	int InsertString(FString &str, unsigned int h, unsigned int bucketnum);
-	void FindFirstFreeEntry(unsigned int base);
+	int FindString(const char *str, size_t len, unsigned int h);
+	int InsertString(FString &str, unsigned int h);
+	void Rehash(unsigned int numbuckets);
+	void Mark(unsigned int num);
 
-	enum { NUM_BUCKETS = 251 };
+	enum { MIN_BUCKETS = 256 };			// Always a power of two
 	enum { FREE_ENTRY = 0xFFFFFFFE };	// Stored in PoolEntry's Next field
 	enum { NO_ENTRY = 0xFFFFFFFF };
 	enum { MIN_GC_SIZE = 100 };			// Don't auto-collect until there are this many strings
+	enum { YOUNG_GC_SIZE = 4096 };		// Collect the young strings once there are this many
 	struct PoolEntry
 	{
 		FString Str;
 		unsigned int Hash;
 		unsigned int Next;
 		unsigned int LockCount;
+		bool Young;						// Added since the last collection
+	};
+	struct PoolStats
+	{
+		unsigned int YoungCollections, FullCollections;
+		unsigned int YoungFreed, FullFreed, Promoted;
+		unsigned int Rehashes;
+		double YoungMS, FullMS, MaxYoungMS, MaxFullMS;
 	};
 	TArray<PoolEntry> Pool;
-	unsigned int PoolBuckets[NUM_BUCKETS];
-	unsigned int FirstFreeEntry;
+	TArray<unsigned int> PoolBuckets;	// Grows to keep about one string per bucket
+	TArray<unsigned int> FreeEntries;
+	TArray<unsigned int> YoungEntries;
+	unsigned int NumStrings;
+	unsigned int LiveAfterFullGC;		// Strings left by the last full collection
+	bool bMarkingYoung;
+	PoolStats Stats;
 };
 extern ACSStringPool GlobalACSStrings;
 
 void P_CollectACSGlobalStrings();
+void P_CollectACSYoungStrings();
 void P_ReadACSVars(PNGHandle *);
 void P_WriteACSVars(FILE*);
 void P_ClearACSVars(bool);
@@ -1046,7 +1067,7 @@ public:
 	void Serialize (FArchive &arc);
 	int RunScript ();
 
-	inline void SetState (EScriptState newstate) { state = newstate; }
+	void SetState (EScriptState newstate);
 	inline EScriptState GetState () { return state; }
 
 	DLevelScript *GetNext() const { return next; }
@@ -1089,6 +1110,14 @@ protected:
 	TObjPtr<AActor> pDamageInflictor;
 	TObjPtr<AActor> pDamageTarget;
 
+	// Scheduling links owned by DACSThinker. They are not archived; the
+	// thinker rebuilds them from state and statedata after a load.
+	SQWORD			OrderKey;		// Increases from the head to the tail of the script list
+	DLevelScript	*QueueNext, *QueuePrev;
+	BYTE			Queue;			// Which of the thinker's queues this script is on
+	int				QueueKey;		// Wheel slot or wait list key
+	int				WakeTick;
+
 	void Link ();
 	void Unlink ();
 	void PutLast ();
@@ -1154,10 +1183,65 @@ public:
 	// [BB] Added StopAndDestroyAllScripts, which is needed in GAME_ResetMap.
 	void StopAndDestroyAllScripts ();
 
+	// Wake up scripts waiting for this tag or polyobject once it stops moving.
+	static void NotifyTagIdle (int tag);
+	static void NotifyPolyIdle (int polynum);
+
 private:
 	DLevelScript *LastScript;
 	DLevelScript *Scripts;				// List of all running scripts
 
+	// Only scripts that can make progress are visited each tic. Delayed
+	// scripts sit in a hierarchical timing wheel and waiting scripts are kept
+	// on per-object wait lists until whatever they wait for changes.
+	enum
+	{
+		WHEEL_BITS = 6,
+		WHEEL_SIZE = 1 << WHEEL_BITS,
+		WHEEL_MASK = WHEEL_SIZE - 1,
+		WHEEL_LEVELS = 4,
+	};
+
+	enum EScriptQueue
+	{
+		QUEUE_None,
+		QUEUE_Run,
+		QUEUE_Wheel,
+		QUEUE_TagWait,
+		QUEUE_PolyWait,
+		QUEUE_ScriptWaitPre,
+		QUEUE_ScriptWait,
+
+		NUM_QUEUES
+	};
+
+	typedef TMap<int, DLevelScript *> WaitMap;
+
+	DLevelScript *RunQueue, *RunQueueTail;	// Sorted by OrderKey
+	DLevelScript *Cursor;					// Next script to visit during Tick
+	SQWORD CursorKey;
+	bool bIterating;
+	SQWORD FirstKey, LastKey;
+	int TickCount;
+	int WheelTime;							// Next tic the wheel will expire
+	DLevelScript *Wheel[WHEEL_LEVELS * WHEEL_SIZE];
+	WaitMap WaitLists[NUM_QUEUES];
+	int QueueCounts[NUM_QUEUES];
+
+	void Schedule (DLevelScript *script);
+	void Unschedule (DLevelScript *script);
+	void RunQueueLink (DLevelScript *script, DLevelScript *before);
+	void RunQueueInsert (DLevelScript *script);
+	void RunQueueMerge (TArray<DLevelScript *> &scripts);
+	void WheelInsert (DLevelScript *script);
+	void WheelCascade (int level, int slot);
+	void WheelAdvance (TArray<DLevelScript *> &woken);
+	void TakeWaiters (int queue, int key, TArray<DLevelScript *> &woken);
+	void WakeWaiters (int queue, int key);
+	void PollWaiters (TArray<DLevelScript *> &woken);
+	void ResetSchedule ();
+	void RebuildSchedule ();
+
 	friend class DLevelScript;
 	friend class FBehavior;
 };
@@ -40,8 +40,10 @@
 
 #else
 #include <direct.h>
+#include <process.h>
 
 #define rmdir _rmdir
+#define getpid _getpid
 
 #endif
 
@@ -65,8 +67,7 @@
 #include "version.h"
 #include "md5.h"
 #include "m_misc.h"
-// [BB] New #includes.
-#include "network.h"
+#include "m_crc32.h"
 
 void P_GetPolySpots (MapData * lump, TArray<FNodeBuilder::FPolyStart> &spots, TArray<FNodeBuilder::FPolyStart> &anchors);
 
@@ -74,8 +75,8 @@ CVAR(Bool, gl_cachenodes, true, CVAR_ARCHIVE|CVAR_GLOBALCONFIG)
 CVAR(Float, gl_cachetime, 0.6f, CVAR_ARCHIVE|CVAR_GLOBALCONFIG)
 
 void P_LoadZNodes (FileReader &dalump, DWORD id);
-static bool CheckCachedNodes(MapData *map);
-static void CreateCachedNodes(MapData *map);
+static bool CheckCachedNodes(MapData *map, const int **oldvertextable);
+static void CreateCachedNodes(MapData *map, const int *oldvertextable);
 
 
 // fixed 32 bit gl_vert format v2.0+ (glBsp 1.91)
@@ -834,9 +835,13 @@ static int FindGLNodesInFile(FResourceFile * f, const char * label)
 // Checks for the presence of GL nodes in the loaded WADs or a .GWA file
 // returns true if successful
 //
+// If the nodes come from the cache and the node builder had renumbered
+// the map's vertices, the table that maps the old vertex numbers to the
+// new ones is returned in oldvertextable.
+//
 //==========================================================================
 
-bool P_LoadGLNodes(MapData * map)
+bool P_LoadGLNodes(MapData * map, const int **oldvertextable)
 {
 	if (map->MapLumps[ML_GLZNODES].Reader && map->MapLumps[ML_GLZNODES].Reader->GetLength() != 0)
 	{
@@ -882,7 +887,7 @@ bool P_LoadGLNodes(MapData * map)
 		}
 	}
 
-	if (!CheckCachedNodes(map))
+	if (!CheckCachedNodes(map, oldvertextable))
 	{
 		FileReader *gwalumps[4] = { NULL, NULL, NULL, NULL };
 		char path[256];
@@ -958,7 +963,7 @@ bool P_LoadGLNodes(MapData * map)
 //
 //==========================================================================
 
-bool P_CheckNodes(MapData * map, bool rebuilt, int buildtime)
+bool P_CheckNodes(MapData * map, bool rebuilt, int buildtime, const int *oldvertextable)
 {
 	bool ret = false;
 
@@ -1008,21 +1013,7 @@ bool P_CheckNodes(MapData * map, bool rebuilt, int buildtime)
 		}
 	}
 
-#ifdef DEBUG
-	// Building nodes in debug is much slower so let's cache them only if cachetime is 0
-	buildtime = 0;
-#endif
-	// [BB] Reportedly, the server can crash in case "gl_cachenodes true".
-	if ( ( NETWORK_GetState( ) != NETSTATE_SERVER ) && gl_cachenodes && buildtime/1000.f >= gl_cachetime)
-	{
-		DPrintf("Caching nodes\n");
-		CreateCachedNodes(map);
-	}
-	else
-	{
-		DPrintf("Not caching nodes (time = %f)\n", buildtime/1000.f);
-	}
-
+	P_CacheNodes(map, buildtime, rebuilt ? oldvertextable : NULL);
 
 	if (!gamenodes)
 	{
@@ -1077,10 +1068,87 @@ static void WriteLong(MemFile &f, DWORD b)
 	f[v+3] = (BYTE)(b>>24);
 }
 
-static void CreateCachedNodes(MapData *map)
+//==========================================================================
+//
+// A cache file starts with a header of NODECACHE_HEADERSIZE bytes:
+// "CACH", the version of the format, the number of lines, the checksum of
+// the map, the size of the old vertex table and the size and CRC32 of the
+// rest of the file. The rest holds the vertices of each line, the old
+// vertex table and the compressed ZGL2 nodes.
+//
+// Bump NODECACHE_VERSION whenever the layout changes, so that the files
+// written by older versions are rebuilt instead of being misread.
+//
+//==========================================================================
+
+enum
+{
+	NODECACHE_VERSION = 2,
+	NODECACHE_HEADERSIZE = 40,
+};
+
+static void PutCacheLong(BYTE *p, DWORD v)
+{
+	v = LittleLong(v);
+	memcpy(p, &v, 4);
+}
+
+static DWORD GetCacheLong(const BYTE *p)
+{
+	DWORD v;
+	memcpy(&v, p, 4);
+	return LittleLong(v);
+}
+
+//==========================================================================
+//
+// Several processes may share one cache directory, so the file is first
+// written under a name of its own and then renamed into place. Readers
+// thus either find the complete old file or the complete new one.
+//
+//==========================================================================
+
+static void WriteCacheFile(const FString &path, const BYTE *data, size_t size)
+{
+	FString temppath;
+	temppath.Format("%s.%d.tmp", path.GetChars(), (int)getpid());
+
+	FILE *f = fopen(temppath, "wb");
+	if (f == NULL)
+	{
+		Printf("Could not write the node cache %s\n", temppath.GetChars());
+		return;
+	}
+
+	const bool written = fwrite(data, 1, size, f) == size;
+	if (fclose(f) != 0 || !written)
+	{
+		Printf("Could not write the node cache %s\n", temppath.GetChars());
+		remove(temppath);
+		return;
+	}
+
+#ifdef _WIN32
+	// rename doesn't replace existing files here. Someone loading the map
+	// right now may miss the cache, but then just builds the nodes again.
+	remove(path);
+#endif
+	if (rename(temppath, path) != 0)
+	{
+		remove(temppath);
+	}
+}
+
+static void CreateCachedNodes(MapData *map, const int *oldvertextable)
 {
 	MemFile ZNodes;
 
+	// Only GL nodes can be cached.
+	if (glsegextras == NULL)
+	{
+		return;
+	}
+
 	WriteLong(ZNodes, 0);
 	WriteLong(ZNodes, numvertexes);
 	for(int i=0;i<numvertexes;i++)
@@ -1142,9 +1210,10 @@ static void CreateCachedNodes(MapData *map)
 		}
 	}
 
+	const int numoldverts = oldvertextable != NULL ? numvertexdatas : 0;
 	uLongf outlen = ZNodes.Size();
 	BYTE *compressed;
-	int offset = numlines * 8 + 12 + 16;
+	int offset = NODECACHE_HEADERSIZE + numlines * 8 + numoldverts * 4 + 4;
 	int r;
 	do
 	{
@@ -1159,59 +1228,71 @@ static void CreateCachedNodes(MapData *map)
 	while (r == Z_BUF_ERROR);
 
 	memcpy(compressed, "CACH", 4);
-	DWORD len = LittleLong(numlines);
-	memcpy(compressed+4, &len, 4);
-	map->GetChecksum(compressed+8);
+	PutCacheLong(compressed+4, NODECACHE_VERSION);
+	PutCacheLong(compressed+8, numlines);
+	map->GetChecksum(compressed+12);
+	PutCacheLong(compressed+28, numoldverts);
+
+	BYTE *data = compressed + NODECACHE_HEADERSIZE;
 	for(int i=0;i<numlines;i++)
 	{
-		DWORD ndx[2] = {LittleLong(DWORD(lines[i].v1 - vertexes)), LittleLong(DWORD(lines[i].v2 - vertexes)) };
-		memcpy(compressed+8+16+8*i, ndx, 8);
+		PutCacheLong(data+8*i, DWORD(lines[i].v1 - vertexes));
+		PutCacheLong(data+8*i+4, DWORD(lines[i].v2 - vertexes));
+	}
+	data += numlines * 8;
+	for(int i=0;i<numoldverts;i++)
+	{
+		PutCacheLong(data+4*i, oldvertextable[i]);
 	}
 	memcpy(compressed + offset - 4, "ZGL2", 4);
 
-	FString path = CreateCacheName(map, true);
-	FILE *f = fopen(path, "wb");
-	fwrite(compressed, 1, outlen+offset, f);
-	fclose(f);
+	const DWORD datasize = DWORD(outlen + offset - NODECACHE_HEADERSIZE);
+	PutCacheLong(compressed+32, datasize);
+	PutCacheLong(compressed+36, CalcCRC32(compressed + NODECACHE_HEADERSIZE, datasize));
+
+	WriteCacheFile(CreateCacheName(map, true), compressed, outlen + offset);
 	delete [] compressed;
 }
 
 
-static bool CheckCachedNodes(MapData *map)
+static bool CheckCachedNodes(MapData *map, const int **oldvertextable)
 {
-	char magic[4] = {0,0,0,0};
-	BYTE md5[16];
+	BYTE header[NODECACHE_HEADERSIZE];
 	BYTE md5map[16];
-	DWORD numlin;
-	DWORD *verts = NULL;
+	BYTE *data = NULL;
+	DWORD numoldverts, datasize, nodesofs;
+	long filesize;
 
 	FString path = CreateCacheName(map, false);
 	FILE *f = fopen(path, "rb");
 	if (f == NULL) return false;
 
-	if (fread(magic, 1, 4, f) != 4) goto errorout;
-	if (memcmp(magic, "CACH", 4))  goto errorout;
+	if (fread(header, 1, NODECACHE_HEADERSIZE, f) != NODECACHE_HEADERSIZE) goto errorout;
+	if (memcmp(header, "CACH", 4))  goto errorout;
+	if (GetCacheLong(header+4) != NODECACHE_VERSION) goto errorout;
+	if ((int)GetCacheLong(header+8) != numlines) goto errorout;
 
-	if (fread(&numlin, 4, 1, f) != 1) goto errorout; 
-	numlin = LittleLong(numlin);
-	if ((int)numlin != numlines) goto errorout;
-
-	if (fread(md5, 1, 16, f) != 16) goto errorout;
 	map->GetChecksum(md5map);
-	if (memcmp(md5, md5map, 16)) goto errorout;
+	if (memcmp(header+12, md5map, 16)) goto errorout;
 
-	verts = new DWORD[numlin * 8];
-	if (fread(verts, 8, numlin, f) != numlin) goto errorout;
+	numoldverts = GetCacheLong(header+28);
+	if (numoldverts != 0 && (int)numoldverts != numvertexdatas) goto errorout;
 
-	if (fread(magic, 1, 4, f) != 4) goto errorout;
-	if (memcmp(magic, "ZGL2", 4))  goto errorout;
+	// A file that was cut short or damaged must not be loaded.
+	datasize = GetCacheLong(header+32);
+	nodesofs = numlines * 8 + numoldverts * 4 + 4;
+	if (fseek(f, 0, SEEK_END) != 0 || (filesize = ftell(f)) < 0) goto errorout;
+	if (datasize != DWORD(filesize - NODECACHE_HEADERSIZE) || datasize < nodesofs) goto errorout;
+	if (fseek(f, NODECACHE_HEADERSIZE, SEEK_SET) != 0) goto errorout;
 
+	data = new BYTE[datasize];
+	if (fread(data, 1, datasize, f) != datasize) goto errorout;
+	if (CalcCRC32(data, datasize) != GetCacheLong(header+36)) goto errorout;
+	if (memcmp(data + nodesofs - 4, "ZGL2", 4))  goto errorout;
 
 	try
 	{
-		long pos = ftell(f);
-		FileReader fr(f);
-		fr.Seek(pos, SEEK_SET);
+		MemoryReader fr((const char *)data + nodesofs, datasize - nodesofs);
 		P_LoadZNodes (fr, MAKE_ID('Z','G','L','2'));
 	}
 	catch (CRecoverableError &error)
@@ -1238,23 +1319,57 @@ static bool CheckCachedNodes(MapData *map)
 
 	for(int i=0;i<numlines;i++)
 	{
-		lines[i].v1 = &vertexes[LittleLong(verts[i*2])];
-		lines[i].v2 = &vertexes[LittleLong(verts[i*2+1])];
+		lines[i].v1 = &vertexes[GetCacheLong(data+8*i)];
+		lines[i].v2 = &vertexes[GetCacheLong(data+8*i+4)];
 	}
-	delete [] verts;
+
+	if (numoldverts != 0 && oldvertextable != NULL)
+	{
+		int *table = new int[numoldverts];
+		for(DWORD i=0;i<numoldverts;i++)
+		{
+			table[i] = GetCacheLong(data+numlines*8+4*i);
+		}
+		*oldvertextable = table;
+	}
+	delete [] data;
 
 	fclose(f);
 	return true;
 
 errorout:
-	if (verts != NULL)
+	if (data != NULL)
 	{
-		delete[] verts;
+		delete[] data;
 	}
 	fclose(f);
 	return false;
 }
 
+//==========================================================================
+//
+// Writes freshly built GL nodes to the cache if building them took long
+// enough to be worth it. With -buildnodecache every map is cached.
+//
+//==========================================================================
+
+void P_CacheNodes(MapData *map, int buildtime, const int *oldvertextable)
+{
+#ifdef DEBUG
+	// Building nodes in debug is much slower so let's cache them only if cachetime is 0
+	buildtime = 0;
+#endif
+	if (Args->CheckParm("-buildnodecache") || (gl_cachenodes && buildtime/1000.f >= gl_cachetime))
+	{
+		DPrintf("Caching nodes\n");
+		CreateCachedNodes(map, oldvertextable);
+	}
+	else
+	{
+		DPrintf("Not caching nodes (time = %f)\n", buildtime/1000.f);
+	}
+}
+
 UNSAFE_CCMD(clearnodecache)
 {
 	TArray<FFileList> list;
@@ -36,6 +36,7 @@
 #include "templates.h"
 #include "p_local.h"
 #include "p_lnspec.h"
+#include "unlagged.h"
 
 enum
 {
@@ -99,6 +100,7 @@ static bool MoveCeiling(sector_t *sector, int crush, fixed_t move)
 
 	// [BB] Ceiling height was changed.
 	sector->bCeilingHeightChange = true;
+	UNLAGGED_SectorMoved( sector );
 
 	if (P_ChangeSector(sector, crush, move, 1, true)) return false;
 
@@ -117,6 +119,7 @@ static bool MoveFloor(sector_t *sector, int crush, fixed_t move)
 
 	// [BB] Floor height was changed.
 	sector->bFloorHeightChange = true;
+	UNLAGGED_SectorMoved( sector );
 
 	if (P_ChangeSector(sector, crush, move, 0, true)) return false;
 
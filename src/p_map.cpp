@@ -4000,7 +4000,7 @@ fixed_t P_AimLineAttack(AActor *t1, angle_t angle, fixed_t distance, AActor **pL
 	// [Spleen]
 	if(!(flags & ALF_NOUNLAGGED))
 	{
-		UNLAGGED_Reconcile( t1 );
+		UNLAGGED_Reconcile( t1, angle, distance );
 	}
 
 	angle >>= ANGLETOFINESHIFT;
@@ -4206,7 +4206,7 @@ AActor *P_LineAttack(AActor *t1, angle_t angle, fixed_t distance,
 	vz = -finesine[pitch];
 
 	// [Spleen]
-	UNLAGGED_Reconcile( t1 );
+	UNLAGGED_Reconcile( t1, srcangle, distance );
 
 	shootz = t1->z - t1->floorclip + (t1->height >> 1);
 	if (t1->player != NULL)
@@ -4828,7 +4828,7 @@ void P_RailAttack(AActor *source, int damage, int offset_xy, fixed_t offset_z, i
 	fixed_t shootz;
 
 	// [Spleen]
-	UNLAGGED_Reconcile( source );
+	UNLAGGED_Reconcile( source, source->angle + angleoffset, distance, abs( offset_xy ) << FRACBITS );
 
 	if (puffclass == NULL) puffclass = PClass::FindClass(NAME_BulletPuff);
 
@@ -87,6 +87,7 @@
 #include "joinqueue.h"
 #include "cl_demo.h"
 #include "domination.h"
+#include "unlagged.h"
 
 // [BB] New #includes..
 #include "gl/dynlights/gl_dynlight.h"
@@ -3767,6 +3768,7 @@ void P_FreeLevelData ()
 		sectors = NULL;
 	}
 	numsectors = 0;
+	UNLAGGED_ClearSectors();
 	if (gamenodes != NULL && gamenodes != nodes)
 	{
 		delete[] gamenodes;
@@ -4245,7 +4247,7 @@ void P_SetupLevel (char *lumpname, int position)
 		// If loading the regular nodes failed try GL nodes before considering a rebuild
 		if (ForceNodeBuild)
 		{
-			if (P_LoadGLNodes(map)) 
+			if (P_LoadGLNodes(map, &oldvertextable)) 
 			{
 				ForceNodeBuild = false;
 				reloop = true;
@@ -4330,12 +4332,17 @@ void P_SetupLevel (char *lumpname, int position)
 		// If the original nodes being loaded are not GL nodes they will be kept around for
 		// use in P_PointInSubsector to avoid problems with maps that depend on the specific
 		// nodes they were built with (P:AR E1M3 is a good example for a map where this is the case.)
-		reloop |= P_CheckNodes(map, BuildGLNodes, endTime - startTime);
+		reloop |= P_CheckNodes(map, BuildGLNodes, endTime - startTime, oldvertextable);
 		hasglnodes = true;
 	}
 	else
 	{
 		hasglnodes = P_CheckForGLNodes();
+
+		// Multiplayer games build GL nodes even without a renderer that needs
+		// them, e.g. on the server, so they're worth caching just the same.
+		if (BuildGLNodes)
+			P_CacheNodes(map, endTime - startTime, oldvertextable);
 	}
 
 	times[10].Clock();
@@ -123,8 +123,9 @@ int P_TranslateSectorSpecial (int);
 int GetUDMFInt(int type, int index, const char *key);
 fixed_t GetUDMFFixed(int type, int index, const char *key);
 
-bool P_LoadGLNodes(MapData * map);
-bool P_CheckNodes(MapData * map, bool rebuilt, int buildtime);
+bool P_LoadGLNodes(MapData * map, const int **oldvertextable = NULL);
+bool P_CheckNodes(MapData * map, bool rebuilt, int buildtime, const int *oldvertextable);
+void P_CacheNodes(MapData * map, int buildtime, const int *oldvertextable);
 bool P_CheckForGLNodes();
 void P_SetRenderSector();
 
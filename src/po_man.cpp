@@ -27,6 +27,7 @@
 #include "g_level.h"
 #include "po_man.h"
 #include "p_setup.h"
+#include "p_acs.h"
 #include "vectors.h"
 #include "farchive.h"
 // [BC] New #includes.
@@ -279,6 +280,7 @@ void DPolyAction::Destroy()
 	if (poly->specialdata == this)
 	{
 		poly->specialdata = NULL;
+		DACSThinker::NotifyPolyIdle (m_PolyObj);
 	}
 
 	StopInterpolation();
@@ -817,6 +817,12 @@ struct sector_t
 	// [BC] Has the height changed during the course of the level?
 	bool		bCeilingHeightChange;
 	bool		bFloorHeightChange;
+
+	// The last gametic the unlagged history of this sector's heights changed, and whether
+	// the sector is among the ones UNLAGGED_Reconcile rewinds.
+	int			lUnlaggedMoveTic;
+	bool		bUnlaggedMoving;
+
 	secplane_t	SavedCeilingPlane;
 	secplane_t	SavedFloorPlane;
 	fixed_t		SavedCeilingTexZ;
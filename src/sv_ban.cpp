@@ -57,6 +57,8 @@
 #include "version.h"
 #include "v_text.h"
 #include "p_acs.h"
+#include "m_random.h"
+#include "stats.h"
 
 //--------------------------------------------------------------------------------------------------------------------------------------------------
 //-- VARIABLES -------------------------------------------------------------------------------------------------------------------------------------
@@ -758,3 +760,109 @@ CCMD( reloadbans )
 
 	serverban_LoadBansAndBanExemptions( );
 }
+
+//*****************************************************************************
+//
+// Replays random addresses against a ban list, with and without its lookup index.
+// About half of the addresses are taken from the entries, so that they match.
+CCMD( benchmarkbanlist )
+{
+	static FRandom pr_benchmarkbanlist( "BenchmarkBanList" );
+
+	// This function may not be used by ConsoleCommand.
+	if ( ACS_IsCalledFromConsoleCommand( ))
+		return;
+
+	IPList fileList;
+	const IPList *pList = &g_MasterServerBans;
+
+	if ( argv.argc( ) < 2 )
+	{
+		Printf( "Usage: benchmarkbanlist <file|master> [lookups]\n" );
+		return;
+	}
+
+	if ( stricmp( argv[1], "master" ) != 0 )
+	{
+		if ( fileList.clearAndLoadFromFile( argv[1] ) == false )
+		{
+			Printf( "%s", fileList.getErrorMessage( ));
+			return;
+		}
+
+		pList = &fileList;
+	}
+
+	const int numLookups = ( argv.argc( ) >= 3 ) ? MAX( atoi( argv[2] ), 1 ) : 100000;
+
+	if ( pList->size( ) == 0 )
+	{
+		Printf( "The ban list is empty.\n" );
+		return;
+	}
+
+	TArray<NETADDRESS_s> addresses;
+	addresses.Resize( numLookups );
+	for ( int i = 0; i < numLookups; i++ )
+	{
+		ULONG ulOctets = pr_benchmarkbanlist.GenRand32( );
+		unsigned int wildcardMask = 0xF;
+
+		if (( i & 1 ) == 0 )
+		{
+			ULONG ulEntryOctets;
+			if ( pList->getEntry( pr_benchmarkbanlist.GenRand32( ) % pList->size( )).szIP.GetPattern( ulEntryOctets, wildcardMask ))
+			{
+				for ( int octet = 0; octet < 4; octet++ )
+				{
+					if (( wildcardMask & ( 1 << octet )) == 0 )
+						ulOctets = ( ulOctets & ~( 0xFFul << ( 24 - 8 * octet ))) | ( ulEntryOctets & ( 0xFFul << ( 24 - 8 * octet )));
+				}
+			}
+		}
+
+		for ( int octet = 0; octet < 4; octet++ )
+			addresses[i].abIP[octet] = static_cast<BYTE>( ulOctets >> ( 24 - 8 * octet ));
+		addresses[i].usPort = 0;
+	}
+
+	cycle_t buildTime, indexTime, scanTime;
+	buildTime.Reset( );
+	indexTime.Reset( );
+	scanTime.Reset( );
+
+	// The first lookup builds the index.
+	buildTime.Clock( );
+	pList->getFirstMatchingEntryIndex( addresses[0] );
+	buildTime.Unclock( );
+
+	TArray<ULONG> results;
+	results.Resize( numLookups );
+	indexTime.Clock( );
+	for ( int i = 0; i < numLookups; i++ )
+		results[i] = pList->getFirstMatchingEntryIndex( addresses[i] );
+	indexTime.Unclock( );
+
+	int numMatches = 0;
+	int numMismatches = 0;
+	scanTime.Clock( );
+	for ( int i = 0; i < numLookups; i++ )
+	{
+		IPStringArray szAddress;
+		szAddress.SetFrom( addresses[i] );
+		const ULONG ulIdx = pList->scanForFirstMatchingEntryIndex( szAddress );
+
+		if ( ulIdx < pList->size( ))
+			numMatches++;
+		if ( ulIdx != results[i] )
+			numMismatches++;
+	}
+	scanTime.Unclock( );
+
+	Printf( "%u entries, %d lookups, %d matched.\n", pList->size( ), numLookups, numMatches );
+	Printf( "Index: %.3f ms to build, %.3f us per lookup.\n", buildTime.TimeMS( ), indexTime.TimeMS( ) * 1000 / numLookups );
+	Printf( "Scan: %.3f us per lookup.\n", scanTime.TimeMS( ) * 1000 / numLookups );
+
+	if ( numMismatches > 0 )
+		Printf( TEXTCOLOR_RED "%d lookups found a different entry than the scan!\n", numMismatches );
+}
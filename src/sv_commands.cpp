@@ -287,13 +287,10 @@ void SERVERCOMMANDS_SpawnPlayer( ULONG ulPlayer, LONG lPlayerState, ULONG ulPlay
 
 //*****************************************************************************
 //
-void SERVERCOMMANDS_MovePlayer( ULONG ulPlayer, ULONG ulPlayerExtra, ServerCommandFlags flags )
+static ULONG servercommands_GetMovePlayerFlags( ULONG ulPlayer )
 {
 	ULONG ulPlayerFlags = 0;
 
-	if ( PLAYER_IsValidPlayerWithMo( ulPlayer ) == false )
-		return;
-
 	// [BB] Check if ulPlayer is pressing any attack buttons.
 	if ( players[ulPlayer].cmd.ucmd.buttons & BT_ATTACK )
 		ulPlayerFlags |= PLAYER_ATTACK;
@@ -318,6 +315,18 @@ void SERVERCOMMANDS_MovePlayer( ULONG ulPlayer, ULONG ulPlayerExtra, ServerComma
 	if (( players[ulPlayer].mo->z <= players[ulPlayer].mo->floorz ) && ( players[ulPlayer].mo->floorsector->floordata ))
 		ulPlayerFlags |= PLAYER_ONLIFT;
 
+	return ulPlayerFlags;
+}
+
+//*****************************************************************************
+//
+void SERVERCOMMANDS_MovePlayer( ULONG ulPlayer, ULONG ulPlayerExtra, ServerCommandFlags flags )
+{
+	if ( PLAYER_IsValidPlayerWithMo( ulPlayer ) == false )
+		return;
+
+	const ULONG ulPlayerFlags = servercommands_GetMovePlayerFlags( ulPlayer );
+
 	ServerCommands::MovePlayer fullCommand;
 	fullCommand.SetPlayer ( &players[ulPlayer] );
 	fullCommand.SetFlags( ulPlayerFlags | PLAYER_VISIBLE );
@@ -341,6 +350,157 @@ void SERVERCOMMANDS_MovePlayer( ULONG ulPlayer, ULONG ulPlayerExtra, ServerComma
 	}
 }
 
+//*****************************************************************************
+//
+// Returns a value as the client receives it when sent as AproxFixed.
+static fixed_t servercommands_AproxFixed( fixed_t value )
+{
+	return static_cast<SWORD> ( value >> FRACBITS ) * FRACUNIT;
+}
+
+//*****************************************************************************
+//
+// Sends the movement of ulPlayer to ulClient relative to the newest movement
+// the client acknowledged (see server_AckMoveSnapshots), only the fields that
+// changed since then are sent.
+// The result is saved to the client's current snapshot (see SERVER_WriteCommands),
+// which must have been started with server_BeginMoveSnapshot for this update.
+//
+void SERVERCOMMANDS_MovePlayerDelta( ULONG ulPlayer, ULONG ulClient )
+{
+	if (( PLAYER_IsValidPlayerWithMo( ulPlayer ) == false ) || ( SERVER_IsValidClient( ulClient ) == false ))
+		return;
+
+	// The client isn't supposed to know anything about invisible players.
+	if ( SERVER_IsPlayerVisible( ulClient, ulPlayer ) == false )
+	{
+		SERVERCOMMANDS_MovePlayer( ulPlayer, ulClient, SVCF_ONLYTHISCLIENT );
+		return;
+	}
+
+	CLIENT_s *pClient = SERVER_GetClient( ulClient );
+	const AActor *pmo = players[ulPlayer].mo;
+	MOVESNAPSHOT_s &snapshot = pClient->aMoveSnapshots[pClient->ulMoveSnapshot][ulPlayer];
+
+	// The baseline is the newest snapshot of this player the client acknowledged having. If
+	// that's gone or too old, everything is sent and this becomes the next baseline.
+	const MOVESNAPSHOT_s *pBaseline = NULL;
+	LONG lBaselineAge = 0;
+	for ( ULONG ulSnapshot = 0; ulSnapshot < NUM_MOVE_SNAPSHOTS; ulSnapshot++ )
+	{
+		const LONG lTic = pClient->alMoveSnapshotTics[ulSnapshot];
+		const LONG lAge = gametic - lTic;
+
+		if (( ulSnapshot != pClient->ulMoveSnapshot ) && ( lTic == pClient->alMoveSnapshotAcks[ulPlayer] )
+			&& ( lAge > 0 ) && ( lAge <= 255 ) && pClient->aMoveSnapshots[ulSnapshot][ulPlayer].bValid )
+		{
+			pBaseline = &pClient->aMoveSnapshots[ulSnapshot][ulPlayer];
+			lBaselineAge = lAge;
+			break;
+		}
+	}
+
+	MOVESNAPSHOT_s baseline;
+	if ( pBaseline != NULL )
+		baseline = *pBaseline;
+	else
+		memset( &baseline, 0, sizeof( baseline ));
+
+	ServerCommands::MovePlayerDelta command;
+	ULONG ulChanges = 0;
+	command.SetPlayer( &players[ulPlayer] );
+	command.SetFlags( servercommands_GetMovePlayerFlags( ulPlayer ) | PLAYER_VISIBLE );
+	command.SetTic( gametic & 0xFF );
+	command.SetBaselineAge( lBaselineAge );
+	command.SetX( pmo->x );
+	command.SetY( pmo->y );
+	command.SetDeltaX( 0 );
+	command.SetDeltaY( 0 );
+	command.SetAngle( pmo->angle );
+	command.SetDeltaAngle( 0 );
+
+	// The position is sent as a rounded difference to the baseline, unless that would
+	// put the player into a different sector on the client (see MovePlayer).
+	snapshot.x = baseline.x;
+	snapshot.y = baseline.y;
+	if ( pBaseline == NULL )
+	{
+		ulChanges |= MOVEDELTA_POSITION_EXACT;
+		snapshot.x = pmo->x;
+		snapshot.y = pmo->y;
+	}
+	else if (( pmo->x != baseline.x ) || ( pmo->y != baseline.y ))
+	{
+		const SQWORD qwRound = 1 << ( MOVEDELTA_POSITION_SHIFT - 1 );
+		const SQWORD qwDeltaX = ( static_cast<SQWORD> ( pmo->x ) - baseline.x + qwRound ) >> MOVEDELTA_POSITION_SHIFT;
+		const SQWORD qwDeltaY = ( static_cast<SQWORD> ( pmo->y ) - baseline.y + qwRound ) >> MOVEDELTA_POSITION_SHIFT;
+
+		if (( qwDeltaX != 0 ) || ( qwDeltaY != 0 ))
+		{
+			const fixed_t x = baseline.x + static_cast<fixed_t> ( qwDeltaX << MOVEDELTA_POSITION_SHIFT );
+			const fixed_t y = baseline.y + static_cast<fixed_t> ( qwDeltaY << MOVEDELTA_POSITION_SHIFT );
+
+			if (( qwDeltaX >= -0x10000 ) && ( qwDeltaX <= 0x10000 ) && ( qwDeltaY >= -0x10000 ) && ( qwDeltaY <= 0x10000 )
+				&& ( P_PointInSector( x, y ) == pmo->Sector ))
+			{
+				ulChanges |= MOVEDELTA_POSITION;
+				command.SetDeltaX( static_cast<int> ( qwDeltaX ));
+				command.SetDeltaY( static_cast<int> ( qwDeltaY ));
+				snapshot.x = x;
+				snapshot.y = y;
+			}
+			else
+			{
+				ulChanges |= MOVEDELTA_POSITION_EXACT;
+				snapshot.x = pmo->x;
+				snapshot.y = pmo->y;
+			}
+		}
+	}
+
+	snapshot.z = servercommands_AproxFixed( pmo->z );
+	command.SetZ( pmo->z );
+	if (( pBaseline == NULL ) || ( snapshot.z != baseline.z ))
+		ulChanges |= MOVEDELTA_Z;
+
+	snapshot.angle = baseline.angle;
+	if ( pBaseline == NULL )
+	{
+		ulChanges |= MOVEDELTA_ANGLE_EXACT;
+		snapshot.angle = pmo->angle;
+	}
+	else
+	{
+		const SQWORD qwRound = 1 << ( MOVEDELTA_ANGLE_SHIFT - 1 );
+		const SQWORD qwDeltaAngle = ( static_cast<SQWORD> ( static_cast<int> ( pmo->angle - baseline.angle )) + qwRound ) >> MOVEDELTA_ANGLE_SHIFT;
+
+		if ( qwDeltaAngle != 0 )
+		{
+			ulChanges |= MOVEDELTA_ANGLE;
+			command.SetDeltaAngle( static_cast<int> ( qwDeltaAngle ));
+			snapshot.angle = baseline.angle + ( static_cast<angle_t> ( qwDeltaAngle ) << MOVEDELTA_ANGLE_SHIFT );
+		}
+	}
+
+	// Without a baseline, the client assumes zero velocity for the velocities that aren't sent.
+	snapshot.velx = servercommands_AproxFixed( pmo->velx );
+	snapshot.vely = servercommands_AproxFixed( pmo->vely );
+	snapshot.velz = servercommands_AproxFixed( pmo->velz );
+	command.SetVelx( pmo->velx );
+	command.SetVely( pmo->vely );
+	command.SetVelz( pmo->velz );
+	if ( snapshot.velx != baseline.velx )
+		ulChanges |= MOVEDELTA_VELX;
+	if ( snapshot.vely != baseline.vely )
+		ulChanges |= MOVEDELTA_VELY;
+	if ( snapshot.velz != baseline.velz )
+		ulChanges |= MOVEDELTA_VELZ;
+
+	snapshot.bValid = true;
+	command.SetChanges( ulChanges );
+	command.sendCommandToClients( ulClient, SVCF_ONLYTHISCLIENT );
+}
+
 //*****************************************************************************
 //
 void SERVERCOMMANDS_DamagePlayer( ULONG ulPlayer )
@@ -5057,6 +5217,21 @@ void SERVERCOMMANDS_RCONAccess( int client )
 	command.sendCommandToOneClient( client );
 }
 
+//*****************************************************************************
+//
+// Sends a snapshot made by SERVER_BuildLevelSnapshot in pieces that fit into a packet.
+void SERVERCOMMANDS_DemoKeyframePiece( const BYTE *pbData, ULONG ulLength, ULONG ulFlags, ULONG ulClient )
+{
+	if ( SERVER_IsValidClient( ulClient ) == false )
+		return;
+
+	NetCommand command ( SVC2_DEMOKEYFRAME );
+	command.addByte( ulFlags );
+	command.addShort( ulLength );
+	command.addBuffer( pbData, ulLength );
+	command.sendCommandToOneClient( ulClient );
+}
+
 //*****************************************************************************
 // [AK]
 void SERVERCOMMANDS_SyncMapRotation( ULONG ulPlayerExtra, ServerCommandFlags flags )
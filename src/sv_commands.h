@@ -91,6 +91,8 @@ void	SERVERCOMMANDS_EndSnapshot( ULONG ulPlayer );
 // Player commands. These involve manipulating a player in some way.
 void	SERVERCOMMANDS_SpawnPlayer( ULONG ulPlayer, LONG lPlayerState, ULONG ulPlayerExtra = MAXPLAYERS, ServerCommandFlags flags = 0, bool bMorph = false );
 void	SERVERCOMMANDS_MovePlayer( ULONG ulPlayer, ULONG ulPlayerExtra = MAXPLAYERS, ServerCommandFlags flags = 0 );
+void	SERVERCOMMANDS_MovePlayerDelta( ULONG ulPlayer, ULONG ulClient );
+void	SERVERCOMMANDS_DemoKeyframePiece( const BYTE *pbData, ULONG ulLength, ULONG ulFlags, ULONG ulClient );
 void	SERVERCOMMANDS_DamagePlayer( ULONG ulPlayer );
 void	SERVERCOMMANDS_DamagePlayerWithType( ULONG ulPlayer, ULONG ulArmorPoints, ULONG ulPlayerExtra );
 void	SERVERCOMMANDS_KillPlayer( ULONG ulPlayer, AActor *pSource, AActor *pInflictor, FName MOD );
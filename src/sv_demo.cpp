@@ -0,0 +1,592 @@
+//-----------------------------------------------------------------------------
+//
+// Zandronum Source
+// Copyright (C) 2026 Zandronum Development Team
+// All rights reserved.
+//
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the Skulltag Development Team nor the names of its
+//    contributors may be used to endorse or promote products derived from this
+//    software without specific prior written permission.
+// 4. Redistributions in any form must be accompanied by information on how to
+//    obtain complete source code for the software and any accompanying
+//    software that uses the software. The source code must either be included
+//    in the distribution or be available for no more than the cost of
+//    distribution plus a nominal fee, and must be freely redistributable
+//    under reasonable conditions. For an executable file, complete source
+//    code means the source code for all modules it contains. It does not
+//    include source code for modules or files that typically accompany the
+//    major components of the operating system on which the executable file
+//    runs.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+//
+//
+//
+// Filename: sv_demo.cpp
+//
+// Description: Records demos of the match on the server
+//
+// The recorder is a client without an address that takes one of the player
+// slots as a true spectator. It's sent everything a spectator is sent, except
+// that it's not subject to the visibility culling and sees everything, and
+// instead of being launched, its packets are written to a demo in the format
+// of cl_demo.cpp. So the demo can be played back like one recorded by a
+// client, and any player can be watched in it.
+//
+//-----------------------------------------------------------------------------
+
+#include "c_dispatch.h"
+#include "cl_demo.h"
+#include "cmdlib.h"
+#include "doomstat.h"
+#include "g_level.h"
+#include "network.h"
+#include "p_setup.h"
+#include "stats.h"
+#include "sv_demo.h"
+#include "sv_main.h"
+#include "templates.h"
+#include "network/demowriter.h"
+
+//*****************************************************************************
+//	DEFINES
+
+// Like the client, the body of the demo is handed to the writer thread once this
+// many bytes are buffered, or once this many tics have passed.
+#define	SERVERDEMO_CHUNKSIZE		0x10000
+#define	SERVERDEMO_FLUSHTICS		TICRATE
+
+//*****************************************************************************
+//	PROTOTYPES
+
+static	void				serverdemo_CheckDemoBuffer( ULONG ulSize );
+static	void				serverdemo_FlushDemoBuffer( void );
+static	void				serverdemo_WriteMapChecksum( BYTESTREAM_s *pByteStream );
+static	void				serverdemo_ParseRecorderPacket( BYTE *pbData, BYTESTREAM_s *pByteStream );
+static	void				serverdemo_ConnectRecorder( void );
+static	void				serverdemo_AuthenticateLevel( void );
+static	void				serverdemo_AddKeyframe( LONG lOffset );
+static	void				serverdemo_WriteKeyframe( void );
+
+//*****************************************************************************
+//	VARIABLES
+
+// The client slot of the demo recorder, -1 if we aren't recording a demo.
+static	LONG				g_lRecorder = -1;
+
+// Name of our demo.
+static	FString				g_DemoName;
+
+// Writes the demo we are recording to its file.
+static	DemoWriter			g_DemoWriter;
+
+// Buffer for the part of the demo that wasn't handed to the writer yet.
+static	BYTE				*g_pbDemoBuffer = NULL;
+static	LONG				g_lMaxDemoLength = 0;
+static	BYTESTREAM_s		g_ByteStream;
+
+// Number of bytes of the demo that have already been handed to the writer.
+static	LONG				g_lFlushedDemoLength = 0;
+
+// Number of tics written to the demo, and its value when we last flushed the buffer.
+static	unsigned int		g_TicsRecorded = 0;
+static	unsigned int		g_FlushedTics = 0;
+
+// The keyframes of the demo, see DEMOKEYFRAME_s.
+static	TArray<DEMOKEYFRAME_s>	g_DemoKeyframes;
+
+// Value of g_TicsRecorded at the last keyframe.
+static	unsigned int		g_LastKeyframeTic = 0;
+
+// The time the game thread spent on the demo, see the sv_demostats CCMD.
+static	cycle_t				g_TicCycles;
+static	double				g_dTotalTicMS = 0;
+static	double				g_dMaxTicMS = 0;
+static	ULONG				g_ulTimedTics = 0;
+
+// The time the snapshots of the level took to build, see serverdemo_WriteKeyframe.
+static	double				g_dTotalKeyframeMS = 0;
+static	double				g_dMaxKeyframeMS = 0;
+static	ULONG				g_ulNumTimedKeyframes = 0;
+
+// The time all of SERVER_Tick took per tic, while recording and while not.
+static	double				g_adTotalServerTicMS[2] = { 0, 0 };
+static	ULONG				g_aulServerTics[2] = { 0, 0 };
+
+EXTERN_CVAR( Bool, demo_compress )
+
+// Every this many seconds, store a snapshot of the level in the demo, so that playback
+// can jump close to any position.
+CVAR( Int, sv_demokeyframeinterval, 30, CVAR_ARCHIVE )
+
+//*****************************************************************************
+//	FUNCTIONS
+
+void SERVERDEMO_BeginRecording( const char *pszDemoName )
+{
+	if (( pszDemoName == NULL ) || SERVERDEMO_IsRecording( ))
+		return;
+
+	const LONG lClient = SERVER_FindFreeClientSlot( );
+	if ( lClient == -1 )
+	{
+		Printf( "There is no free player slot for the demo recorder.\n" );
+		return;
+	}
+
+	g_DemoName = pszDemoName;
+	FixPathSeperator( g_DemoName );
+	DefaultExtension( g_DemoName, ".cld" );
+
+	g_lMaxDemoLength = 0x20000;
+	g_pbDemoBuffer = (BYTE *)M_Malloc( g_lMaxDemoLength );
+	g_ByteStream.pbStream = g_pbDemoBuffer;
+	g_ByteStream.pbStreamEnd = g_pbDemoBuffer + g_lMaxDemoLength;
+	g_TicsRecorded = 0;
+	g_FlushedTics = 0;
+	g_DemoKeyframes.Clear( );
+	g_LastKeyframeTic = 0;
+
+	// The header is the same as the one of client demos, except that there is no
+	// userinfo. The recorder gets its own userinfo with the full update.
+	CLIENTDEMO_WriteHeader( &g_ByteStream );
+	g_ByteStream.WriteByte( CLD_DEMOCHUNKS );
+	g_ByteStream.WriteByte( CLD_BODYSTART );
+
+	g_lFlushedDemoLength = g_ByteStream.pbStream - g_pbDemoBuffer;
+	g_ByteStream.pbStream = g_pbDemoBuffer;
+	if ( g_DemoWriter.Open( g_DemoName.GetChars( ), g_pbDemoBuffer, g_lFlushedDemoLength, demo_compress ) == false )
+	{
+		Printf( "Couldn't open \"%s\" for writing. The demo won't be recorded.\n", g_DemoName.GetChars( ));
+		M_Free( g_pbDemoBuffer );
+		g_pbDemoBuffer = NULL;
+		return;
+	}
+
+	g_lRecorder = lClient;
+	serverdemo_ConnectRecorder( );
+
+	// The recorder can still be refused, e.g. if it can't authenticate the map.
+	if ( SERVERDEMO_IsRecording( ))
+		Printf( "Recording demo \"%s\".\n", g_DemoName.GetChars( ));
+}
+
+//*****************************************************************************
+//
+// Called when the recorder is disconnected, for whatever reason.
+void SERVERDEMO_FinishRecording( void )
+{
+	if ( SERVERDEMO_IsRecording( ) == false )
+		return;
+
+	// What the recorder was sent after the last tic is part of the demo too.
+	CLIENT_s *pClient = SERVER_GetClient( g_lRecorder );
+	SERVERDEMO_WritePacket( pClient->PacketBuffer );
+	SERVERDEMO_WritePacket( pClient->UnreliablePacketBuffer );
+	g_lRecorder = -1;
+
+	serverdemo_CheckDemoBuffer( 1 );
+	g_ByteStream.WriteByte( CLD_DEMOEND );
+	const LONG lDemoLength = g_lFlushedDemoLength + ( g_ByteStream.pbStream - g_pbDemoBuffer );
+
+	// Append the keyframe index, see CLIENTDEMO_FinishRecording.
+	serverdemo_CheckDemoBuffer( 5 + g_DemoKeyframes.Size( ) * 8 );
+	CLIENTDEMO_WriteIndex( &g_ByteStream, g_DemoKeyframes );
+
+	serverdemo_FlushDemoBuffer( );
+	M_Free( g_pbDemoBuffer );
+	g_pbDemoBuffer = NULL;
+
+	if ( g_DemoWriter.Close( lDemoLength ))
+		Printf( "Demo \"%s\" successfully recorded!\n", g_DemoName.GetChars( ));
+	else
+		Printf( "Couldn't write demo \"%s\"!\n", g_DemoName.GetChars( ));
+}
+
+//*****************************************************************************
+//
+// Called after the packets of the tic were sent out.
+void SERVERDEMO_Tick( void )
+{
+	if ( SERVERDEMO_IsRecording( ) == false )
+		return;
+
+	CLIENT_s *pClient = SERVER_GetClient( g_lRecorder );
+
+	// The recorder has to authenticate every new map, like everybody else.
+	if ( pClient->State == CLS_SPAWNED_BUT_NEEDS_AUTHENTICATION )
+	{
+		serverdemo_AuthenticateLevel( );
+		if ( SERVERDEMO_IsRecording( ) == false )
+			return;
+	}
+
+	g_TicCycles.Clock( );
+
+	// It's never lagging, and as it received everything it was sent,
+	// the movement can always be sent relative to the last update.
+	pClient->ulLastCommandTic = pClient->ulLastGameTic = gametic;
+	pClient->lLastServerGametic = gametic;
+
+	// Mark the end of the tic with an empty ticcmd.
+	serverdemo_CheckDemoBuffer( 14 );
+	g_ByteStream.WriteByte( CLD_TICCMD );
+	for ( ULONG ulIdx = 0; ulIdx < 13; ++ulIdx )
+		g_ByteStream.WriteByte( 0 );
+	++g_TicsRecorded;
+
+	if (( g_ByteStream.pbStream - g_pbDemoBuffer >= SERVERDEMO_CHUNKSIZE ) || ( g_TicsRecorded - g_FlushedTics >= SERVERDEMO_FLUSHTICS ))
+		serverdemo_FlushDemoBuffer( );
+
+	g_TicCycles.Unclock( );
+
+	const double dTicMS = g_TicCycles.TimeMS( );
+	g_TicCycles.Reset( );
+	g_dTotalTicMS += dTicMS;
+	g_dMaxTicMS = MAX( g_dMaxTicMS, dTicMS );
+	g_ulTimedTics++;
+
+	// The snapshot is timed on its own, it would spoil the average of the tics.
+	if (( sv_demokeyframeinterval > 0 ) && ( g_TicsRecorded - g_LastKeyframeTic >= static_cast<unsigned int>( sv_demokeyframeinterval * TICRATE ))
+		&& ( gamestate == GS_LEVEL ) && ( pClient->State == CLS_SPAWNED ))
+	{
+		serverdemo_WriteKeyframe( );
+	}
+}
+
+//*****************************************************************************
+//
+// The packets of the recorder contain the commands without any header, which is
+// how the client writes them to its demos too.
+void SERVERDEMO_WritePacket( const NETBUFFER_s &Buffer )
+{
+	const LONG lSize = Buffer.CalcSize( );
+
+	if (( SERVERDEMO_IsRecording( ) == false ) || ( lSize <= 0 ))
+		return;
+
+	g_TicCycles.Clock( );
+	serverdemo_CheckDemoBuffer( lSize );
+	memcpy( g_ByteStream.pbStream, Buffer.pbData, lSize );
+	g_ByteStream.pbStream += lSize;
+	g_TicCycles.Unclock( );
+}
+
+//*****************************************************************************
+//
+bool SERVERDEMO_IsRecording( void )
+{
+	return ( g_lRecorder != -1 );
+}
+
+//*****************************************************************************
+//
+bool SERVERDEMO_IsRecorder( ULONG ulClient )
+{
+	return ( static_cast<LONG>( ulClient ) == g_lRecorder );
+}
+
+//*****************************************************************************
+//
+// Called with the time a tic of SERVER_Tick took, to compare it with and without the recorder.
+void SERVERDEMO_AddServerTicTime( double dMS )
+{
+	const int iRecording = SERVERDEMO_IsRecording( ) ? 1 : 0;
+
+	g_adTotalServerTicMS[iRecording] += dMS;
+	g_aulServerTics[iRecording]++;
+}
+
+//*****************************************************************************
+//*****************************************************************************
+//
+static void serverdemo_CheckDemoBuffer( ULONG ulSize )
+{
+	// We may need to allocate more memory for our demo buffer.
+	if (( g_ByteStream.pbStream + ulSize ) > g_ByteStream.pbStreamEnd )
+	{
+		const LONG lPosition = g_ByteStream.pbStream - g_pbDemoBuffer;
+
+		g_lMaxDemoLength = MAX<LONG>( g_lMaxDemoLength + 0x20000, lPosition + ulSize );
+		g_pbDemoBuffer = (BYTE *)M_Realloc( g_pbDemoBuffer, g_lMaxDemoLength );
+		g_ByteStream.pbStream = g_pbDemoBuffer + lPosition;
+		g_ByteStream.pbStreamEnd = g_pbDemoBuffer + g_lMaxDemoLength;
+	}
+}
+
+//*****************************************************************************
+//
+static void serverdemo_FlushDemoBuffer( void )
+{
+	const ULONG ulSize = g_ByteStream.pbStream - g_pbDemoBuffer;
+
+	g_FlushedTics = g_TicsRecorded;
+	g_DemoWriter.Write( g_pbDemoBuffer, ulSize );
+
+	g_lFlushedDemoLength += ulSize;
+	g_ByteStream.pbStream = g_pbDemoBuffer;
+}
+
+//*****************************************************************************
+//
+// Adds a keyframe at the current tic, see DEMOKEYFRAME_s.
+static void serverdemo_AddKeyframe( LONG lOffset )
+{
+	if (( g_DemoKeyframes.Size( ) > 0 ) && ( g_DemoKeyframes[g_DemoKeyframes.Size( ) - 1].tic == g_TicsRecorded )
+		&& ( g_DemoKeyframes[g_DemoKeyframes.Size( ) - 1].lOffset >= lOffset ))
+	{
+		return;
+	}
+
+	DEMOKEYFRAME_s Keyframe;
+	Keyframe.tic = g_TicsRecorded;
+	Keyframe.lOffset = lOffset;
+	g_DemoKeyframes.Push( Keyframe );
+	g_LastKeyframeTic = g_TicsRecorded;
+}
+
+//*****************************************************************************
+//
+// Stores a snapshot of the level as a CLD_KEYFRAME, like CLIENTDEMO_AddKeyframePiece.
+// We have the snapshot right away, so playback goes on at the CLD_KEYFRAME itself.
+static void serverdemo_WriteKeyframe( void )
+{
+	TArray<BYTE>	Snapshot;
+	cycle_t			KeyframeCycles;
+
+	KeyframeCycles.Reset( );
+	KeyframeCycles.Clock( );
+	SERVER_BuildLevelSnapshot( g_lRecorder, Snapshot );
+
+	serverdemo_CheckDemoBuffer( 13 + Snapshot.Size( ));
+	const LONG lOffset = g_lFlushedDemoLength + ( g_ByteStream.pbStream - g_pbDemoBuffer );
+	CLIENTDEMO_WriteKeyframe( &g_ByteStream, Snapshot, lOffset, g_TicsRecorded );
+	serverdemo_AddKeyframe( lOffset );
+	KeyframeCycles.Unclock( );
+
+	const double dKeyframeMS = KeyframeCycles.TimeMS( );
+	g_dTotalKeyframeMS += dKeyframeMS;
+	g_dMaxKeyframeMS = MAX( g_dMaxKeyframeMS, dKeyframeMS );
+	g_ulNumTimedKeyframes++;
+}
+
+//*****************************************************************************
+//
+// Writes what CLIENT_AuthenticateLevel writes. We have the same map, of course.
+static void serverdemo_WriteMapChecksum( BYTESTREAM_s *pByteStream )
+{
+	MapData *map = P_OpenMapData( level.mapname, false );
+	BYTE checksum[16];
+
+	map->GetChecksum( checksum );
+	delete map;
+	pByteStream->WriteBuffer( checksum, sizeof checksum );
+}
+
+//*****************************************************************************
+//
+// pByteStream was written to pbData, parse that as a packet of the recorder.
+static void serverdemo_ParseRecorderPacket( BYTE *pbData, BYTESTREAM_s *pByteStream )
+{
+	pByteStream->pbStreamEnd = pByteStream->pbStream;
+	pByteStream->pbStream = pbData;
+	SERVER_ParseDemoRecorderPacket( g_lRecorder, pByteStream );
+}
+
+//*****************************************************************************
+//
+// Goes through what the client does to connect, all at once.
+static void serverdemo_ConnectRecorder( void )
+{
+	BYTE			abData[MAX_UDP_PACKET];
+	BYTESTREAM_s	ByteStream;
+
+	// The server sends SVCC_AUTHENTICATE right away, this is where client demos start too.
+	serverdemo_AddKeyframe( -1 );
+	SERVER_ConnectDemoRecorder( g_lRecorder );
+
+	// Authenticate the map.
+	ByteStream.pbStream = abData;
+	ByteStream.pbStreamEnd = abData + sizeof( abData );
+	ByteStream.WriteByte( CLCC_ATTEMPTAUTHENTICATION );
+	serverdemo_WriteMapChecksum( &ByteStream );
+	serverdemo_ParseRecorderPacket( abData, &ByteStream );
+	if ( SERVERDEMO_IsRecording( ) == false )
+		return;
+
+	// Request the snapshot, with the userinfo of a true spectator.
+	ByteStream.pbStream = abData;
+	ByteStream.pbStreamEnd = abData + sizeof( abData );
+	ByteStream.WriteByte( CLCC_REQUESTSNAPSHOT );
+	ByteStream.WriteByte( CLC_USERINFO );
+	NETWORK_WriteName( &ByteStream, NAME_Name );
+	ByteStream.WriteString( "Server demo" );
+	NETWORK_WriteName( &ByteStream, NAME_Autoaim );
+	ByteStream.WriteString( "0" );
+	NETWORK_WriteName( &ByteStream, NAME_Gender );
+	ByteStream.WriteString( "0" );
+	NETWORK_WriteName( &ByteStream, NAME_Skin );
+	ByteStream.WriteString( "base" );
+	NETWORK_WriteName( &ByteStream, NAME_RailColor );
+	ByteStream.WriteString( "0" );
+	NETWORK_WriteName( &ByteStream, NAME_CL_ConnectionType );
+	ByteStream.WriteString( "1" );
+	NETWORK_WriteName( &ByteStream, NAME_CL_ClientFlags );
+	ByteStream.WriteString( "0" );
+	NETWORK_WriteName( &ByteStream, NAME_Handicap );
+	ByteStream.WriteString( "0" );
+	// The demo should have every update.
+	NETWORK_WriteName( &ByteStream, NAME_CL_TicsPerUpdate );
+	ByteStream.WriteString( "1" );
+	NETWORK_WriteName( &ByteStream, NAME_Color );
+	ByteStream.WriteString( "40 cf 00" );
+	NETWORK_WriteName( &ByteStream, NAME_ColorSet );
+	ByteStream.WriteString( "-1" );
+	NETWORK_WriteName( &ByteStream, NAME_None );
+	serverdemo_ParseRecorderPacket( abData, &ByteStream );
+}
+
+//*****************************************************************************
+//
+// Answers SVC_MAPAUTHENTICATE, like ServerCommands::MapAuthenticate::Execute.
+static void serverdemo_AuthenticateLevel( void )
+{
+	BYTE			abData[MAX_UDP_PACKET];
+	BYTESTREAM_s	ByteStream;
+
+	// The server follows this with a full update, see ServerCommands::MapLoad::Execute.
+	serverdemo_AddKeyframe( -1 );
+
+	ByteStream.pbStream = abData;
+	ByteStream.pbStreamEnd = abData + sizeof( abData );
+	ByteStream.WriteByte( CLC_AUTHENTICATELEVEL );
+	ByteStream.WriteString( level.mapname );
+	serverdemo_WriteMapChecksum( &ByteStream );
+	serverdemo_ParseRecorderPacket( abData, &ByteStream );
+
+	// Write the full update before the end of this tic, where the keyframe is.
+	if ( SERVERDEMO_IsRecording( ))
+	{
+		SERVER_SendClientPacket( g_lRecorder, true );
+		SERVER_SendClientPacket( g_lRecorder, false );
+	}
+}
+
+//*****************************************************************************
+//	CONSOLE COMMANDS
+
+CCMD( sv_recorddemo )
+{
+	if ( NETWORK_GetState( ) != NETSTATE_SERVER )
+		return;
+
+	if ( argv.argc( ) < 2 )
+	{
+		Printf( "Usage: sv_recorddemo <name>\n" );
+		return;
+	}
+
+	if ( SERVERDEMO_IsRecording( ))
+	{
+		Printf( "Already recording demo \"%s\".\n", g_DemoName.GetChars( ));
+		return;
+	}
+
+	if ( gamestate != GS_LEVEL )
+	{
+		Printf( "Demos can only be started during a level.\n" );
+		return;
+	}
+
+	SERVERDEMO_BeginRecording( argv[1] );
+}
+
+//*****************************************************************************
+//
+CCMD( sv_stopdemo )
+{
+	if (( NETWORK_GetState( ) != NETSTATE_SERVER ) || ( SERVERDEMO_IsRecording( ) == false ))
+		return;
+
+	// Disconnecting the recorder finishes the demo.
+	SERVER_DisconnectClient( g_lRecorder, true, false );
+}
+
+//*****************************************************************************
+//
+CCMD( sv_demostats )
+{
+	if ( NETWORK_GetState( ) != NETSTATE_SERVER )
+		return;
+
+	if (( argv.argc( ) >= 2 ) && ( stricmp( argv[1], "reset" ) == 0 ))
+	{
+		g_dTotalTicMS = 0;
+		g_dMaxTicMS = 0;
+		g_ulTimedTics = 0;
+		g_dTotalKeyframeMS = 0;
+		g_dMaxKeyframeMS = 0;
+		g_ulNumTimedKeyframes = 0;
+		for ( int i = 0; i < 2; ++i )
+		{
+			g_adTotalServerTicMS[i] = 0;
+			g_aulServerTics[i] = 0;
+		}
+		Printf( "Demo statistics reset.\n" );
+		return;
+	}
+
+	if ( SERVERDEMO_IsRecording( ))
+	{
+		Printf( "Recording demo \"%s\": %u tics, %ld bytes\n", g_DemoName.GetChars( ), g_TicsRecorded,
+			static_cast<long> ( g_lFlushedDemoLength + ( g_ByteStream.pbStream - g_pbDemoBuffer )));
+	}
+
+	// Building the commands for the recorder costs as much as for any other spectator,
+	// this is the time spent on top of that.
+	if ( g_ulTimedTics > 0 )
+	{
+		const double dAverageMS = g_dTotalTicMS / g_ulTimedTics;
+		Printf( "Demo recording time per tic: %.4f ms average, %.4f ms max over %lu tics (%.3f%% of a tic)\n",
+			dAverageMS, g_dMaxTicMS, g_ulTimedTics, dAverageMS * TICRATE / 10.0 );
+	}
+	else
+		Printf( "No tics recorded yet.\n" );
+
+	if ( g_ulNumTimedKeyframes > 0 )
+	{
+		Printf( "Keyframes: %.4f ms average, %.4f ms max over %lu keyframes\n",
+			g_dTotalKeyframeMS / g_ulNumTimedKeyframes, g_dMaxKeyframeMS, g_ulNumTimedKeyframes );
+	}
+
+	// The whole tic, including the commands built for the recorder.
+	static const char *const apszServerTicNames[2] = { "without", "with" };
+	for ( int i = 0; i < 2; ++i )
+	{
+		if ( g_aulServerTics[i] > 0 )
+		{
+			Printf( "SERVER_Tick %s the recorder: %.4f ms average over %lu tics\n", apszServerTicNames[i],
+				g_adTotalServerTicMS[i] / g_aulServerTics[i], g_aulServerTics[i] );
+		}
+	}
+}
@@ -78,6 +78,8 @@
 #include "d_net.h"
 #include "g_game.h"
 #include "p_local.h"
+#include "r_state.h"
+#include "g_shared/a_sharedglobal.h"
 #include "sv_main.h"
 #include "sv_ban.h"
 #include "i_system.h"
@@ -107,6 +109,8 @@
 #include "sv_commands.h"
 #include "sv_save.h"
 #include "sv_rcon.h"
+#include "sv_demo.h"
+#include "sv_profiler.h"
 #include "gamemode.h"
 #include "domination.h"
 #include "a_movingcamera.h"
@@ -120,6 +124,8 @@
 #include "d_protocol.h"
 #include "p_enemy.h"
 #include "network/packetarchive.h"
+#include "network/netcommand.h"
+#include "network/nettraffic.h"
 #include "p_lnspec.h"
 #include "unlagged.h"
 #include "scoreboard.h"
@@ -155,6 +161,7 @@ static	bool	server_RCONCommand( BYTESTREAM_s *pByteStream );
 static	bool	server_Suicide( BYTESTREAM_s *pByteStream );
 static	bool	server_ChangeTeam( BYTESTREAM_s *pByteStream );
 static	bool	server_SpectateInfo( BYTESTREAM_s *pByteStream );
+static	bool	server_AckMoveSnapshots( BYTESTREAM_s *pByteStream );
 static	bool	server_GenericCheat( BYTESTREAM_s *pByteStream );
 static	bool	server_GiveCheat( BYTESTREAM_s *pByteStream, bool take );
 static	bool	server_SummonCheat( BYTESTREAM_s *pByteStream, LONG lType );
@@ -176,6 +183,21 @@ static	void	server_PrintWithIP( FString message, const NETADDRESS_s &address );
 static	void	server_PerformBacktrace( ULONG ulClient, ULONG ulNumLateMoveCMDs );
 static	bool	server_ShouldPerformBacktrace( ULONG ulClient );
 static	void	server_FixZFromBacktrace( APlayerPawn *pmo, fixed_t oldFloorZ );
+static	void	server_RecordTicTiming( LONG lOversleepMS, ULONG ulWakeups );
+static	void	server_BeginMoveSnapshot( ULONG ulClient );
+static	void	server_SetupVisibilityCulling( void );
+static	void	server_ResetVisibilityStats( ULONG ulClient );
+static	AActor	*server_GetViewActor( ULONG ulClient );
+static	bool	server_IsPlayerCulled( ULONG ulClient, ULONG ulPlayer );
+static	bool	server_ShouldThrottleMovement( ULONG ulClient, ULONG ulPlayer );
+static	void	server_ResetNewClient( ULONG ulClient );
+static	void	server_SendCarriedItems( ULONG ulClient );
+static	void	server_SendGameModeState( ULONG ulClient );
+static	void	server_SendPlayerFullUpdate( ULONG ulPlayer, ULONG ulClient );
+static	void	server_SendLevelSnapshot( ULONG ulClient );
+static	void	server_CaptureSnapshotPacket( NETBUFFER_s &Buffer );
+static	bool	server_RequestDemoKeyframe( BYTESTREAM_s *pByteStream );
+static	void	server_SendDemoKeyframePieces( ULONG ulClient );
 
 // [RC]
 #ifdef CREATE_PACKET_LOG
@@ -226,6 +248,22 @@ static	LONG		g_lMaxInboundDataTransfer = 0;
 static	LONG		g_lCurrentInboundDataTransfer = 0;
 static	LONG		g_lInboundDataTransferLastSecond = 0;
 
+// Tic timing statistics, see the sv_ticstats CCMD. The histogram counts how many
+// milliseconds after the scheduled time the tics were actually started.
+static	const LONG	g_alTicOversleepBuckets[] = { 1, 2, 3, 5, 10, 20, 35 };
+static	const ULONG	NUM_TICOVERSLEEP_BUCKETS = countof( g_alTicOversleepBuckets ) + 1;
+static	ULONG		g_aulTicOversleepHistogram[NUM_TICOVERSLEEP_BUCKETS];
+static	QWORD		g_qwTicOversleepTotalMS = 0;
+static	LONG		g_lTicOversleepMaxMS = 0;
+static	ULONG		g_ulTicTimingSamples = 0;
+static	QWORD		g_qwTicWakeups = 0;
+
+// Can the REJECT lump of the current map be used for sv_visibilityculling?
+static	bool		g_bRejectCulling = false;
+
+// The most update intervals sv_updatedistance puts between two movement updates of a player.
+static	const ULONG	MAX_MOVEMENT_UPDATE_SCALE = 4;
+
 // This is the current font the "screen" is using when it displays messages.
 static	char		g_szCurrentFont[16];
 
@@ -245,6 +283,10 @@ static	TArray<SECTORLINK_s>		g_SectorLinkList;
 // [AK] List of all actor sound channels containing looping sounds.
 static	TArray<FSoundChan>		g_LoopingChannelList;
 
+// While SERVER_BuildLevelSnapshot runs, what is sent to this client is collected here instead.
+static	LONG			g_lSnapshotClient = -1;
+static	TArray<BYTE>	*g_pSnapshot = NULL;
+
 // [RC] File to log packets to.
 #ifdef CREATE_PACKET_LOG
 static	FILE		*PacketLogFile = NULL;
@@ -286,6 +328,24 @@ CVAR( Bool, sv_useticbuffer, true, CVAR_ARCHIVE|CVAR_NOSETBYACS|CVAR_DEBUGONLY )
 CVAR( Int, sv_showcommands, 0, CVAR_ARCHIVE|CVAR_DEBUGONLY )
 CVAR( Int, sv_smoothplayers_debuginfo, 0, CVAR_ARCHIVE|CVAR_DEBUGONLY ) // [AK]
 
+// If enabled, the server blocks on the game socket until either a packet arrives or the next
+// tic is due instead of polling the socket once per millisecond.
+CVAR( Bool, sv_eventdriventick, false, CVAR_ARCHIVE|CVAR_NOSETBYACS )
+
+// If enabled, player movement is sent relative to the last movement each client acknowledged.
+CVAR( Bool, sv_deltamovement, true, CVAR_ARCHIVE|CVAR_NOSETBYACS )
+
+// If enabled, clients don't get the position of players in sectors the REJECT lump says they can't see.
+CVAR( Bool, sv_visibilityculling, false, CVAR_ARCHIVE|CVAR_NOSETBYACS )
+
+// Players more than this many map units away from what a client is looking at are sent to it less often,
+// every additional multiple of this distance adds one update interval up to MAX_MOVEMENT_UPDATE_SCALE.
+CVAR( Int, sv_updatedistance, 0, CVAR_ARCHIVE|CVAR_NOSETBYACS )
+
+// If enabled, clients that record a demo may ask for snapshots of the level to store in it,
+// see CLC_REQUESTDEMOKEYFRAME. Each costs as much bandwidth as a full update.
+CVAR( Bool, sv_allowdemokeyframes, false, CVAR_ARCHIVE|CVAR_NOSETBYACS|CVAR_SERVERINFO )
+
 //*****************************************************************************
 // [AK] Smooths the movement of lagging players using extrapolation and correction.
 CUSTOM_CVAR( Int, sv_smoothplayers, 0, CVAR_ARCHIVE|CVAR_NOSETBYACS|CVAR_SERVERINFO|CVAR_DEBUGONLY )
@@ -615,8 +675,12 @@ void SERVER_Destruct( void )
 		// [TP] If we still do have clients, tell them the server is going down
 		if ( SERVER_IsValidClient( ulIdx ))
 		{
+			// The demo recorder has no address, kicking it finishes the demo.
+			const bool bRecorder = SERVERDEMO_IsRecorder( ulIdx );
+
 			SERVER_KickPlayer( ulIdx, "Server is shutting down" );
-			NETWORK_LaunchPacket( &SERVER_GetClient( ulIdx )->PacketBuffer, SERVER_GetClient( ulIdx )->Address );
+			if ( bRecorder == false )
+				NETWORK_LaunchPacket( &SERVER_GetClient( ulIdx )->PacketBuffer, SERVER_GetClient( ulIdx )->Address );
 		}
 
 		g_aClients[ulIdx].PacketBuffer.Free();
@@ -645,12 +709,19 @@ void SERVER_Tick( void )
 	LONG			lCurTics;
 	ULONG			ulIdx;
 
-	I_DoSelect();
+	// In event driven mode, the loop below already waits on the game socket.
+	if ( sv_eventdriventick == false )
+		I_DoSelect();
+
 	lPreviousTics = static_cast<LONG> ( g_lGameTime / (( 1.0 / TICRATE ) * 1000.0 ) );
 
 	lNowTime = I_MSTime( );
 	lNewTics = static_cast<LONG> ( lNowTime / (( 1.0 / TICRATE ) * 1000.0 ) );
 
+	// The time at which the next tic is due.
+	const LONG lNextTicTime = static_cast<LONG> (( static_cast<SQWORD> ( lPreviousTics + 1 ) * 1000 + TICRATE - 1 ) / TICRATE );
+	ULONG ulWakeups = 0;
+
 	lCurTics = lNewTics - lPreviousTics;
 	while ( lCurTics <= 0 )
 	{
@@ -658,12 +729,24 @@ void SERVER_Tick( void )
 		// for an accurate ping measurement.
 		SERVER_GetPackets( );
 
-		I_Sleep( 1 );
+		// Sleep until a packet arrives or the next tic is due, whichever happens first.
+		if ( sv_eventdriventick )
+			NETWORK_WaitForPackets( MAX<LONG> ( lNextTicTime - static_cast<LONG> ( I_MSTime( )), 1 ), false );
+		else
+			I_Sleep( 1 );
+
+		ulWakeups++;
 		lNowTime = I_MSTime( );
 		lNewTics = static_cast<LONG> ( lNowTime / (( 1.0 / TICRATE ) * 1000.0 ) );
 		lCurTics = lNewTics - lPreviousTics;
 	}
 
+	// Check for console input without blocking, I_DoSelect was skipped.
+	if ( sv_eventdriventick )
+		NETWORK_WaitForPackets( 0, true );
+
+	server_RecordTicTiming( lNowTime - lNextTicTime, ulWakeups );
+
 #ifdef NO_SERVER_GUI
 	// console input
 	char *cmd = I_ConsoleInput();
@@ -681,15 +764,27 @@ void SERVER_Tick( void )
 	{
 		//DObject::BeginFrame ();
 
+		SERVERPROFILER_BeginTic( );
+
+		// Compared with and without the demo recorder, see sv_demostats.
+		cycle_t TicCycles;
+		TicCycles.Reset( );
+		TicCycles.Clock( );
+
 		// Recieve packets.
+		SERVERPROFILER_BeginPhase( PROFILERPHASE_GETPACKETS );
 		SERVER_GetPackets( );
 
 		// We have to record player positions before their mobj moves.
 		// [BB] Tick the unlagged module.
+		SERVERPROFILER_BeginPhase( PROFILERPHASE_UNLAGGED );
 		UNLAGGED_Tick( );
 
+		SERVERPROFILER_BeginPhase( PROFILERPHASE_TICKER );
 		G_Ticker ();
 
+		SERVERPROFILER_BeginPhase( PROFILERPHASE_OTHER );
+
 		// However we need to spawn the unlagged debug actors here i.e. after having processed their
 		// movement commands which updated their last server gametic.
 		// [BB] Spawn debug actors if the server runner wants them.
@@ -730,15 +825,27 @@ void SERVER_Tick( void )
 		}
 
 		// Drop anyone who's been disconnected.
+		SERVERPROFILER_BeginPhase( PROFILERPHASE_TIMEOUTS );
 		SERVER_CheckTimeouts( );
 
 		// Send out player's true position, etc.
+		SERVERPROFILER_BeginPhase( PROFILERPHASE_WRITECOMMANDS );
 		SERVER_WriteCommands( );
 
+		// Collect all outgoing packets of this tic, so that they can be sent with as few
+		// system calls as possible.
+		NETWORK_BeginPacketBatch( );
+
 		// Check everyone's PacketBuffer for anything that needs to be sent.
+		SERVERPROFILER_BeginPhase( PROFILERPHASE_SENDPACKETS );
 		SERVER_SendOutPackets( );
 
+		// Everything the demo recorder was sent this tic is in the demo now.
+		SERVERPROFILER_BeginPhase( PROFILERPHASE_DEMO );
+		SERVERDEMO_Tick( );
+
 		// [BB] Send out sheduled packets, respecting sv_maxpacketspertick.
+		SERVERPROFILER_BeginPhase( PROFILERPHASE_SAVEDPACKETS );
 		for ( ulIdx = 0; ulIdx < MAXPLAYERS; ulIdx++ )
 		{
 			if ( g_aClients[ulIdx].State == CLS_FREE )
@@ -747,18 +854,31 @@ void SERVER_Tick( void )
 			SERVER_GetClient ( ulIdx )->SavedPackets.Tick ( );
 		}
 
+		// Answer the launchers that queried us this tic.
+		SERVERPROFILER_BeginPhase( PROFILERPHASE_MASTER );
+		SERVER_MASTER_SendPendingServerInfo( );
+
+		SERVERPROFILER_BeginPhase( PROFILERPHASE_FLUSHPACKETS );
+		NETWORK_FlushPacketBatch( );
+
 		// Potentially send an update to the master server.
+		SERVERPROFILER_BeginPhase( PROFILERPHASE_MASTER );
 		SERVER_MASTER_Tick( );
 
 		// Time out any old RCON sessions.
+		SERVERPROFILER_BeginPhase( PROFILERPHASE_RCON );
 		SERVER_RCON_Tick( );
 
 		// Broadcast the server signal so it can be detected on a LAN.
+		SERVERPROFILER_BeginPhase( PROFILERPHASE_MASTER );
 		SERVER_MASTER_Broadcast( );
 
 		// Potentially re-parse the banfile.
+		SERVERPROFILER_BeginPhase( PROFILERPHASE_BANS );
 		SERVERBAN_Tick( );
 
+		SERVERPROFILER_BeginPhase( PROFILERPHASE_OTHER );
+
 		// Print stats and get out.
 		FStat::PrintStat( );
 
@@ -812,8 +932,16 @@ void SERVER_Tick( void )
 
 			// Update the form.
 			SERVERCONSOLE_UpdateStatistics( );
+
+			// Potentially log the bandwidth of the server commands.
+			NETTRAFFIC_Tick( );
 		}
 
+		TicCycles.Unclock( );
+		SERVERDEMO_AddServerTicTime( TicCycles.TimeMS( ));
+
+		SERVERPROFILER_EndTic( );
+
 		//DObject::EndFrame ();
 	}
 /*
@@ -853,6 +981,26 @@ void SERVER_Tick( void )
 	}
 }
 
+//*****************************************************************************
+//
+static void server_RecordTicTiming( LONG lOversleepMS, ULONG ulWakeups )
+{
+	ULONG	ulBucket;
+
+	lOversleepMS = MAX<LONG>( lOversleepMS, 0 );
+	for ( ulBucket = 0; ulBucket < NUM_TICOVERSLEEP_BUCKETS - 1; ulBucket++ )
+	{
+		if ( lOversleepMS < g_alTicOversleepBuckets[ulBucket] )
+			break;
+	}
+
+	g_aulTicOversleepHistogram[ulBucket]++;
+	g_qwTicOversleepTotalMS += lOversleepMS;
+	g_lTicOversleepMaxMS = MAX( g_lTicOversleepMaxMS, lOversleepMS );
+	g_qwTicWakeups += ulWakeups;
+	g_ulTicTimingSamples++;
+}
+
 //*****************************************************************************
 //*****************************************************************************
 //
@@ -885,10 +1033,28 @@ void SERVER_SendClientPacket( ULONG ulClient, bool bReliable )
 	if ( pClient == NULL )
 		return;
 
+	if ( static_cast<LONG>( ulClient ) == g_lSnapshotClient )
+	{
+		server_CaptureSnapshotPacket( bReliable ? pClient->PacketBuffer : pClient->UnreliablePacketBuffer );
+		( bReliable ? pClient->PacketSegments : pClient->UnreliablePacketSegments ).Clear();
+		return;
+	}
+
+	// The demo recorder has no address, what it's sent goes to the demo.
+	if ( SERVERDEMO_IsRecorder( ulClient ))
+	{
+		NETBUFFER_s &Buffer = bReliable ? pClient->PacketBuffer : pClient->UnreliablePacketBuffer;
+		SERVERDEMO_WritePacket( Buffer );
+		Buffer.Clear();
+		( bReliable ? pClient->PacketSegments : pClient->UnreliablePacketSegments ).Clear();
+		return;
+	}
+
 	if ( bReliable )
 	{
-		pClient->SavedPackets.ScheduleUnsentPacket( pClient->PacketBuffer );
+		pClient->SavedPackets.ScheduleUnsentPacket( pClient->PacketBuffer, &pClient->PacketSegments );
 		pClient->PacketBuffer.Clear();
+		pClient->PacketSegments.Clear();
 		return;
 	}
 
@@ -905,9 +1071,10 @@ void SERVER_SendClientPacket( ULONG ulClient, bool bReliable )
 	// Write the body of the message to our temporary buffer.
 	pClient->UnreliablePacketBuffer.WriteTo ( TempBuffer.ByteStream );
 
-	// Finally, send the packet, and clear the buffer.
-	NETWORK_LaunchPacket( &TempBuffer, pClient->Address );
+	// Finally, send the packet, and clear the buffer. The payload starts after the header.
+	NETWORK_LaunchPacket( &TempBuffer, pClient->Address, &pClient->UnreliablePacketSegments, 1 );
 	pClient->UnreliablePacketBuffer.Clear();
+	pClient->UnreliablePacketSegments.Clear();
 }
 
 //*****************************************************************************
@@ -1355,9 +1522,6 @@ void SERVER_ConnectNewPlayer( BYTESTREAM_s *pByteStream )
 	LONG								lCommand;
 	ULONG								ulIdx;
 	PLAYERSAVEDINFO_t					*pSavedInfo;
-	ULONG								ulState;
-	ULONG								ulCountdownTicks;
-	AInventory							*pInventory;
 
 	// If the client hasn't authenticated his level, don't accept this connection.
 	if ( g_aClients[g_lCurrentClient].State < CLS_AUTHENTICATED )
@@ -1472,43 +1636,7 @@ void SERVER_ConnectNewPlayer( BYTESTREAM_s *pByteStream )
 		SERVERCOMMANDS_PrintMOTD( "Emergency!\n\nYou are joining from localhost even though the server is full.\nDo whatever is necessary to clean the situation and disconnect afterwards.\n", g_lCurrentClient, SVCF_ONLYTHISCLIENT );
 
 	// If we're in a duel or LMS mode, tell him the state of the game mode.
-	if ( duel || lastmanstanding || teamlms || possession || teampossession || survival || invasion )
-	{
-		if ( duel )
-		{
-			ulState = DUEL_GetState( );
-			ulCountdownTicks = DUEL_GetCountdownTicks( );
-		}
-		else if ( survival )
-		{
-			ulState = SURVIVAL_GetState( );
-			ulCountdownTicks = SURVIVAL_GetCountdownTicks( );
-		}
-		else if ( invasion )
-		{
-			ulState = INVASION_GetState( );
-			ulCountdownTicks = INVASION_GetCountdownTicks( );
-		}
-		else if ( possession || teampossession )
-		{
-			ulState = POSSESSION_GetState( );
-			if ( ulState == (PSNSTATE_e)PSNS_ARTIFACTHELD )
-				ulCountdownTicks = POSSESSION_GetArtifactHoldTicks( );
-			else
-				ulCountdownTicks = POSSESSION_GetCountdownTicks( );
-		}
-		else
-		{
-			ulState = LASTMANSTANDING_GetState( );
-			ulCountdownTicks = LASTMANSTANDING_GetCountdownTicks( );
-		}
-
-		SERVERCOMMANDS_SetGameModeState( ulState, ulCountdownTicks, g_lCurrentClient, SVCF_ONLYTHISCLIENT );
-
-		// Also, if we're in invasion mode, tell the client what wave we're on.
-		if ( invasion )
-			SERVERCOMMANDS_SetInvasionWave( g_lCurrentClient, SVCF_ONLYTHISCLIENT );
-	}
+	server_SendGameModeState( g_lCurrentClient );
 
 	// In a game mode that involves teams, potentially decide a team for him.
 	if ( GAMEMODE_GetCurrentFlags() & GMF_PLAYERSONTEAMS )
@@ -1578,65 +1706,8 @@ void SERVER_ConnectNewPlayer( BYTESTREAM_s *pByteStream )
 		g_aClients[g_lCurrentClient].bRunEnterScripts = false;
 	}
 
-	if ( GAMEMODE_GetCurrentFlags() & GMF_USETEAMITEM )
-	{
-		// In ST/CTF games, let the incoming player know who has flags/skulls.
-		for ( ulIdx = 0; ulIdx < MAXPLAYERS; ulIdx++ )
-		{
-			if ( SERVER_IsValidClient( ulIdx ) == false )
-				continue;
-
-			// Player shouldn't have a flag/skull if he's not on a team...
-			if (( players[ulIdx].bOnTeam == false ) || ( players[ulIdx].mo == NULL ))
-				continue;
-
-			// See if this player is carrying the opponents flag/skull.
-			pInventory = TEAM_FindOpposingTeamsItemInPlayersInventory ( &players[ulIdx] );
-			if ( pInventory )
-				SERVERCOMMANDS_GiveInventory( ulIdx, pInventory, g_lCurrentClient, SVCF_ONLYTHISCLIENT );
-
-			// See if the player is carrying the white flag in OFCTF.
-			pInventory = players[ulIdx].mo->FindInventory( PClass::FindClass( "WhiteFlag" ), true );
-			if (( oneflagctf ) && ( pInventory ))
-				SERVERCOMMANDS_GiveInventory( ulIdx, pInventory, g_lCurrentClient, SVCF_ONLYTHISCLIENT );
-		}
-
-		// Also let the client know if flags/skulls are on the ground.
-		for ( ulIdx = 0; ulIdx < teams.Size( ); ulIdx++ )
-			SERVERCOMMANDS_SetTeamReturnTicks( ulIdx, TEAM_GetReturnTicks( ulIdx ), g_lCurrentClient, SVCF_ONLYTHISCLIENT );
-
-		SERVERCOMMANDS_SetTeamReturnTicks( teams.Size( ), TEAM_GetReturnTicks( teams.Size( ) ), g_lCurrentClient, SVCF_ONLYTHISCLIENT );
-	}
-
-	// If we're playing terminator, potentially tell the client who's holding the terminator
-	// artifact.
-	if ( terminator )
-	{
-		for ( ulIdx = 0; ulIdx < MAXPLAYERS; ulIdx++ )
-		{
-			if (( playeringame[ulIdx] == false ) || ( players[ulIdx].mo == NULL ))
-				continue;
-
-			pInventory = players[ulIdx].mo->FindInventory( PClass::FindClass( "PowerTerminatorArtifact" ));
-			if ( pInventory )
-				SERVERCOMMANDS_GiveInventory( ulIdx, pInventory, g_lCurrentClient, SVCF_ONLYTHISCLIENT );
-		}
-	}
-
-	// If we're playing possession/team possession, potentially tell the client who's holding
-	// the possession artifact.
-	if ( possession || teampossession )
-	{
-		for ( ulIdx = 0; ulIdx < MAXPLAYERS; ulIdx++ )
-		{
-			if (( playeringame[ulIdx] == false ) || ( players[ulIdx].mo == NULL ))
-				continue;
-
-			pInventory = players[ulIdx].mo->FindInventory( PClass::FindClass( "PowerPossessionArtifact" ));
-			if ( pInventory )
-				SERVERCOMMANDS_GiveInventory( ulIdx, pInventory, g_lCurrentClient, SVCF_ONLYTHISCLIENT );
-		}
-	}
+	// Let the client know who carries the items of the game mode.
+	server_SendCarriedItems( g_lCurrentClient );
 
 	// Check and see if this is a disconnected player. If so, restore his fragcount.
 	pSavedInfo = SERVER_SAVE_GetSavedInfo( players[g_lCurrentClient].userinfo.GetName(), g_aClients[g_lCurrentClient].Address );
@@ -1960,6 +2031,8 @@ void SERVER_SetupNewConnection( BYTESTREAM_s *pByteStream, bool bNewPlayer )
 	g_aClients[lClient].SavedPackets.Clear();
 	g_aClients[lClient].PacketBuffer.Clear();
 	g_aClients[lClient].UnreliablePacketBuffer.Clear();
+	g_aClients[lClient].PacketSegments.Clear();
+	g_aClients[lClient].UnreliablePacketSegments.Clear();
 
 	// Who is connecting?
 	Printf( "Connect (v%s): %s\n", clientVersion.GetChars(), NETWORK_GetFromAddress().ToString() );
@@ -2032,63 +2105,116 @@ void SERVER_SetupNewConnection( BYTESTREAM_s *pByteStream, bool bNewPlayer )
 	g_aClients[lClient].State = CLS_CONNECTED;
 
 	// Reset stats, and a couple other things.
-	players[lClient].fragcount = 0;
-	players[lClient].killcount = 0;
-	players[lClient].lPointCount = 0;
-	players[lClient].ulWins = 0;
-	PLAYER_ResetSpecialCounters ( &players[lClient] );
-	players[lClient].ulDeathCount = 0;
-	players[lClient].ulTime = 0;
-	players[lClient].bSpectating = false;
-	players[lClient].bDeadSpectator = false;
-	players[lClient].Team = teams.Size( );
-	players[lClient].bOnTeam = false;
-
-	g_aClients[lClient].bRCONAccess = false;
-	g_aClients[lClient].ulDisplayPlayer = lClient;
-	g_aClients[lClient].bFullUpdateIncomplete = false;
-	g_aClients[lClient].commandInstances.clear();
-	g_aClients[lClient].minorCommandInstances.clear();
+	server_ResetNewClient( lClient );
+
+	// [BB] Inform the client that he is connected and needs to authenticate the map.
+	SERVER_RequestClientToAuthenticate( lClient );
+}
+
+//*****************************************************************************
+//
+// Sets up a client slot for the demo recorder of sv_demo.cpp. It connects like a client
+// that wants to start as a spectator, but has no address: everything it's sent is
+// written to the demo.
+void SERVER_ConnectDemoRecorder( ULONG ulClient )
+{
+	g_aClients[ulClient].bWantStartAsSpectator = true;
+	g_aClients[ulClient].bWantNoRestoreFrags = true;
+	g_aClients[ulClient].bWantHideCountry = true;
+	g_aClients[ulClient].WantHideAccount = true;
+
+	g_aClients[ulClient].SavedPackets.Clear();
+	g_aClients[ulClient].PacketBuffer.Clear();
+	g_aClients[ulClient].UnreliablePacketBuffer.Clear();
+	g_aClients[ulClient].PacketSegments.Clear();
+	g_aClients[ulClient].UnreliablePacketSegments.Clear();
+
+	g_aClients[ulClient].Address.Clear();
+	g_aClients[ulClient].ulLastCommandTic = g_aClients[ulClient].ulLastGameTic = gametic;
+	g_aClients[ulClient].State = CLS_CONNECTED;
+	server_ResetNewClient( ulClient );
+
+	SERVER_RequestClientToAuthenticate( ulClient );
+}
+
+//*****************************************************************************
+//
+// Parses a packet the demo recorder "sent", as if it came from the network.
+void SERVER_ParseDemoRecorderPacket( ULONG ulClient, BYTESTREAM_s *pByteStream )
+{
+	const LONG lOldClient = g_lCurrentClient;
+
+	g_lCurrentClient = ulClient;
+	SERVER_ParsePacket( pByteStream );
+	g_lCurrentClient = lOldClient;
+}
+
+//*****************************************************************************
+//
+static void server_ResetNewClient( ULONG ulClient )
+{
+	ULONG	ulIdx;
+
+	players[ulClient].fragcount = 0;
+	players[ulClient].killcount = 0;
+	players[ulClient].lPointCount = 0;
+	players[ulClient].ulWins = 0;
+	PLAYER_ResetSpecialCounters ( &players[ulClient] );
+	players[ulClient].ulDeathCount = 0;
+	players[ulClient].ulTime = 0;
+	players[ulClient].bSpectating = false;
+	players[ulClient].bDeadSpectator = false;
+	players[ulClient].Team = teams.Size( );
+	players[ulClient].bOnTeam = false;
+
+	g_aClients[ulClient].bRCONAccess = false;
+	g_aClients[ulClient].ulDisplayPlayer = ulClient;
+	g_aClients[ulClient].bFullUpdateIncomplete = false;
+	g_aClients[ulClient].lLastDemoKeyframeTic = 0;
+	g_aClients[ulClient].DemoKeyframe.Clear( );
+	g_aClients[ulClient].ulDemoKeyframeSent = 0;
+	g_aClients[ulClient].commandInstances.clear();
+	g_aClients[ulClient].minorCommandInstances.clear();
 	for ( ulIdx = 0; ulIdx < MAX_CHATINSTANCE_STORAGE; ulIdx++ )
-		g_aClients[lClient].lChatInstances[ulIdx] = 0;
-	g_aClients[lClient].ulLastChatInstance = 0;
+		g_aClients[ulClient].lChatInstances[ulIdx] = 0;
+	g_aClients[ulClient].ulLastChatInstance = 0;
 	for ( ulIdx = 0; ulIdx < MAX_USERINFOINSTANCE_STORAGE; ulIdx++ )
-		g_aClients[lClient].lUserInfoInstances[ulIdx] = 0;
-	g_aClients[lClient].ulLastUserInfoInstance = 0;
-	g_aClients[lClient].ulLastChangeTeamTime = 0;
-	g_aClients[lClient].ulLastSuicideTime = 0;
-	g_aClients[lClient].lLastPacketLossTick = 0;
-	g_aClients[lClient].lLastMoveTick = 0;
-	g_aClients[lClient].lLastMoveTickProcess = 0;
-	g_aClients[lClient].usLastWeaponNetworkIndex = 0;
-	g_aClients[lClient].lOverMovementLevel = 0;
-	g_aClients[lClient].bRunEnterScripts = false;
-	g_aClients[lClient].bSuspicious = false;
-	g_aClients[lClient].ulNumConsistencyWarnings = 0;
-	g_aClients[lClient].szSkin[0] = 0;
-	g_aClients[lClient].IgnoredAddresses.clear();
-	g_aClients[lClient].ScreenWidth = 0;
-	g_aClients[lClient].ScreenHeight = 0;
-	g_aClients[lClient].ulClientGameTic = 0;
+		g_aClients[ulClient].lUserInfoInstances[ulIdx] = 0;
+	g_aClients[ulClient].ulLastUserInfoInstance = 0;
+	g_aClients[ulClient].ulLastChangeTeamTime = 0;
+	g_aClients[ulClient].ulLastSuicideTime = 0;
+	g_aClients[ulClient].lLastPacketLossTick = 0;
+	NETTRAFFIC_ResetClient( ulClient );
+	g_aClients[ulClient].lLastMoveTick = 0;
+	g_aClients[ulClient].lLastMoveTickProcess = 0;
+	g_aClients[ulClient].usLastWeaponNetworkIndex = 0;
+	g_aClients[ulClient].lOverMovementLevel = 0;
+	g_aClients[ulClient].bRunEnterScripts = false;
+	g_aClients[ulClient].bSuspicious = false;
+	g_aClients[ulClient].ulNumConsistencyWarnings = 0;
+	g_aClients[ulClient].szSkin[0] = 0;
+	g_aClients[ulClient].IgnoredAddresses.clear();
+	g_aClients[ulClient].ScreenWidth = 0;
+	g_aClients[ulClient].ScreenHeight = 0;
+	g_aClients[ulClient].ulClientGameTic = 0;
 	// [CK] Since the client is not up to date at all, the farthest the client
 	// should be able to go back is the gametic they connected with.
-	g_aClients[lClient].lLastServerGametic = gametic;
+	g_aClients[ulClient].lLastServerGametic = gametic;
+	SERVER_ResetMoveSnapshots( ulClient );
+	server_ResetVisibilityStats( ulClient );
 
 	// [AK] Clear any recent command gametics from the client.
-	g_aClients[lClient].recentMoveCMDs.clear();
-	g_aClients[lClient].recentSelectCMDs.clear();
+	g_aClients[ulClient].recentMoveCMDs.clear();
+	g_aClients[ulClient].recentSelectCMDs.clear();
 
 	// [AK] Clear whatever reason the previous client had for being muted.
-	if ( g_aClients[lClient].MutedReason.Len( ) > 0 )
-		g_aClients[lClient].MutedReason = "";
+	if ( g_aClients[ulClient].MutedReason.Len( ) > 0 )
+		g_aClients[ulClient].MutedReason = "";
 
 	// [AK] Reset the client's tic buffer.
-	SERVER_ResetClientTicBuffer( lClient );
-
-	SERVER_InitClientSRPData ( lClient );
+	SERVER_ResetClientTicBuffer( ulClient );
 
-	// [BB] Inform the client that he is connected and needs to authenticate the map.
-	SERVER_RequestClientToAuthenticate( lClient );
+	SERVER_InitClientSRPData ( ulClient );
 }
 
 //*****************************************************************************
@@ -2445,140 +2571,264 @@ void SERVER_ClientError( ULONG ulClient, ULONG ulErrorCode )
 
 //*****************************************************************************
 //
-void SERVER_SendFullUpdate( ULONG ulClient )
+// Tells the client who carries the flags, skulls and artifacts of the game mode.
+static void server_SendCarriedItems( ULONG ulClient )
 {
-	AActor						*pActor;
-	ULONG						ulIdx;
-	player_t*					pPlayer;
-	AInventory					*pInventory;
-	TThinkerIterator<AActor>	Iterator;
+	ULONG		ulIdx;
+	AInventory	*pInventory;
 
-	// Send active players to the client.
-	for ( ulIdx = 0; ulIdx < MAXPLAYERS; ulIdx++ )
+	if ( GAMEMODE_GetCurrentFlags() & GMF_USETEAMITEM )
 	{
-		if (( ulClient == ulIdx ) || ( playeringame[ulIdx] == false ))
-			continue;
+		// In ST/CTF games, let the incoming player know who has flags/skulls.
+		for ( ulIdx = 0; ulIdx < MAXPLAYERS; ulIdx++ )
+		{
+			if ( SERVER_IsValidClient( ulIdx ) == false )
+				continue;
 
-		pPlayer = &players[ulIdx];
-		if ( pPlayer->mo == NULL )
-			continue;
+			// Player shouldn't have a flag/skull if he's not on a team...
+			if (( players[ulIdx].bOnTeam == false ) || ( players[ulIdx].mo == NULL ))
+				continue;
 
-		// [BB] To properly spawn the players the client already needs to know the userinfo, e.g. the handicap value.
-		SERVERCOMMANDS_SetAllPlayerUserInfo( ulIdx, ulClient, SVCF_ONLYTHISCLIENT );
-		// [BB] Make sure that morphed players are spawned as morphed.
-		SERVERCOMMANDS_SpawnPlayer( ulIdx, PST_REBORNNOINVENTORY, ulClient, SVCF_ONLYTHISCLIENT, !!( pPlayer->morphTics ) );
-		// [BB] Since the player possibly lost something from his default inventory, destory everything
-		// he is spawned with on the client. Everything the client has to know about the inventory is
-		// handled below.
-		SERVERCOMMANDS_DestroyAllInventory( ulIdx, ulClient, SVCF_ONLYTHISCLIENT );
-
-		// Also send this player's team.
-		if ( GAMEMODE_GetCurrentFlags() & GMF_PLAYERSONTEAMS )
-			SERVERCOMMANDS_SetPlayerTeam( ulIdx, ulClient, SVCF_ONLYTHISCLIENT );
-
-		// Check if we need to tell the incoming player about any powerups this player may have.
-		// [BB] Also tell about all the ammo, weapons, backpacks and keys this player has.
-		// [BB] Keys need to be handled carefully. In order to display them properly in ST's fullscrenn HUD
-		// in coop spy, they need to be given in reverse order.
-		TArray<AInventory *> keys;
-		for ( pInventory = pPlayer->mo->Inventory; pInventory != NULL; pInventory = pInventory->Inventory )
-		{
-			if ( pInventory->IsKindOf( RUNTIME_CLASS( APowerup )))
-			{
-				SERVERCOMMANDS_GivePowerup( ulIdx, static_cast<APowerup *>( pInventory ), ulClient, SVCF_ONLYTHISCLIENT );
-				if (( pInventory->IsKindOf( RUNTIME_CLASS( APowerInvulnerable ))) &&
-					(( pPlayer->mo->effects & FX_VISIBILITYFLICKER ) || ( pPlayer->mo->effects & FX_RESPAWNINVUL )))
-				{
-					SERVERCOMMANDS_PlayerRespawnInvulnerability( ulIdx );
-				}
+			// See if this player is carrying the opponents flag/skull.
+			pInventory = TEAM_FindOpposingTeamsItemInPlayersInventory ( &players[ulIdx] );
+			if ( pInventory )
+				SERVERCOMMANDS_GiveInventory( ulIdx, pInventory, ulClient, SVCF_ONLYTHISCLIENT );
 
-				// [BB] If it's a rune, we need to explicitly set its icon since it was set by the RuneGiver.
-				if ( pInventory == pInventory->Owner->Rune )
-				{
-					SERVERCOMMANDS_SetInventoryIcon( ulIdx, pInventory, ulClient, SVCF_ONLYTHISCLIENT );
-				}
-			}
-			// [WS] Inform clients of their PowerupGiver items.
-			else if ( pInventory->IsKindOf( RUNTIME_CLASS( AAmmo )) || pInventory->IsKindOf( RUNTIME_CLASS( AWeapon ))
-				|| pInventory->IsKindOf( RUNTIME_CLASS( ABackpackItem ))
-				|| pInventory->IsKindOf( RUNTIME_CLASS( APowerupGiver )) )
-			{
+			// See if the player is carrying the white flag in OFCTF.
+			pInventory = players[ulIdx].mo->FindInventory( PClass::FindClass( "WhiteFlag" ), true );
+			if (( oneflagctf ) && ( pInventory ))
+				SERVERCOMMANDS_GiveInventory( ulIdx, pInventory, ulClient, SVCF_ONLYTHISCLIENT );
+		}
+
+		// Also let the client know if flags/skulls are on the ground.
+		for ( ulIdx = 0; ulIdx < teams.Size( ); ulIdx++ )
+			SERVERCOMMANDS_SetTeamReturnTicks( ulIdx, TEAM_GetReturnTicks( ulIdx ), ulClient, SVCF_ONLYTHISCLIENT );
+
+		SERVERCOMMANDS_SetTeamReturnTicks( teams.Size( ), TEAM_GetReturnTicks( teams.Size( ) ), ulClient, SVCF_ONLYTHISCLIENT );
+	}
+
+	// If we're playing terminator, potentially tell the client who's holding the terminator
+	// artifact.
+	if ( terminator )
+	{
+		for ( ulIdx = 0; ulIdx < MAXPLAYERS; ulIdx++ )
+		{
+			if (( playeringame[ulIdx] == false ) || ( players[ulIdx].mo == NULL ))
+				continue;
+
+			pInventory = players[ulIdx].mo->FindInventory( PClass::FindClass( "PowerTerminatorArtifact" ));
+			if ( pInventory )
 				SERVERCOMMANDS_GiveInventory( ulIdx, pInventory, ulClient, SVCF_ONLYTHISCLIENT );
-				// [BB] Ammo max amount needs to be handled explicitly.
-				if ( pInventory->IsKindOf( RUNTIME_CLASS( AAmmo ) ) )
-					SERVERCOMMANDS_SetPlayerAmmoCapacity( ulIdx, pInventory, ulClient, SVCF_ONLYTHISCLIENT );
-			}
-			else if ( pInventory->IsKindOf( RUNTIME_CLASS( AKey )) )
-				keys.Push ( pInventory );
-			else if ( pInventory->IsA( RUNTIME_CLASS( AWeaponHolder )) )
-			{
-				// [Dusk] Inform the client of weapon holders
-				SERVERCOMMANDS_GiveWeaponHolder( ulIdx, static_cast<AWeaponHolder *>( pInventory ), ulClient, SVCF_ONLYTHISCLIENT );
-			}
 		}
-		// [BB] Now give the keys we just collected from the inventory in reverse order.
-		while ( keys.Size() )
+	}
+
+	// If we're playing possession/team possession, potentially tell the client who's holding
+	// the possession artifact.
+	if ( possession || teampossession )
+	{
+		for ( ulIdx = 0; ulIdx < MAXPLAYERS; ulIdx++ )
 		{
-			keys.Pop( pInventory );
-			SERVERCOMMANDS_GiveInventory( ulIdx, pInventory, ulClient, SVCF_ONLYTHISCLIENT );
+			if (( playeringame[ulIdx] == false ) || ( players[ulIdx].mo == NULL ))
+				continue;
+
+			pInventory = players[ulIdx].mo->FindInventory( PClass::FindClass( "PowerPossessionArtifact" ));
+			if ( pInventory )
+				SERVERCOMMANDS_GiveInventory( ulIdx, pInventory, ulClient, SVCF_ONLYTHISCLIENT );
 		}
+	}
+}
+
+//*****************************************************************************
+//
+// Tells the client the state of the game mode, if it has one.
+static void server_SendGameModeState( ULONG ulClient )
+{
+	ULONG	ulState;
+	ULONG	ulCountdownTicks;
 
-		// Also if this player is currently dead, let the incoming player know that.
-		if ( pPlayer->mo->health <= 0 )
-			SERVERCOMMANDS_ThingIsCorpse( pPlayer->mo, ulClient, SVCF_ONLYTHISCLIENT );
-		// [BB] SERVERCOMMANDS_SpawnPlayer instructs the client to spawn a player
-		// with default health. So we still need to send the correct current health value
-		// (if the player is not dead). Also set the armor and the corresponding max bonuses.
+	if ( duel || lastmanstanding || teamlms || possession || teampossession || survival || invasion )
+	{
+		if ( duel )
+		{
+			ulState = DUEL_GetState( );
+			ulCountdownTicks = DUEL_GetCountdownTicks( );
+		}
+		else if ( survival )
+		{
+			ulState = SURVIVAL_GetState( );
+			ulCountdownTicks = SURVIVAL_GetCountdownTicks( );
+		}
+		else if ( invasion )
+		{
+			ulState = INVASION_GetState( );
+			ulCountdownTicks = INVASION_GetCountdownTicks( );
+		}
+		else if ( possession || teampossession )
+		{
+			ulState = POSSESSION_GetState( );
+			if ( ulState == (PSNSTATE_e)PSNS_ARTIFACTHELD )
+				ulCountdownTicks = POSSESSION_GetArtifactHoldTicks( );
+			else
+				ulCountdownTicks = POSSESSION_GetCountdownTicks( );
+		}
 		else
 		{
-			SERVERCOMMANDS_SetPlayerHealthAndMaxHealthBonus( ulIdx, ulClient, SVCF_ONLYTHISCLIENT );
-			SERVERCOMMANDS_SetPlayerArmorAndMaxArmorBonus( ulIdx, ulClient, SVCF_ONLYTHISCLIENT );
-			// [BB] Also send all non-default flag values.
-			SERVERCOMMANDS_UpdateThingFlagsNotAtDefaults( pPlayer->mo, ulClient, SVCF_ONLYTHISCLIENT );
+			ulState = LASTMANSTANDING_GetState( );
+			ulCountdownTicks = LASTMANSTANDING_GetCountdownTicks( );
+		}
+
+		SERVERCOMMANDS_SetGameModeState( ulState, ulCountdownTicks, ulClient, SVCF_ONLYTHISCLIENT );
+
+		// Also, if we're in invasion mode, tell the client what wave we're on.
+		if ( invasion )
+			SERVERCOMMANDS_SetInvasionWave( ulClient, SVCF_ONLYTHISCLIENT );
+	}
+}
+
+//*****************************************************************************
+//
+// Tells the client everything about this player that isn't known from spawning it.
+static void server_SendPlayerFullUpdate( ULONG ulPlayer, ULONG ulClient )
+{
+	player_t	*pPlayer = &players[ulPlayer];
+	AInventory	*pInventory;
+
+	if ( pPlayer->mo == NULL )
+		return;
+
+	// [BB] To properly spawn the players the client already needs to know the userinfo, e.g. the handicap value.
+	SERVERCOMMANDS_SetAllPlayerUserInfo( ulPlayer, ulClient, SVCF_ONLYTHISCLIENT );
+	// [BB] Make sure that morphed players are spawned as morphed.
+	SERVERCOMMANDS_SpawnPlayer( ulPlayer, PST_REBORNNOINVENTORY, ulClient, SVCF_ONLYTHISCLIENT, !!( pPlayer->morphTics ) );
+	// [BB] Since the player possibly lost something from his default inventory, destory everything
+	// he is spawned with on the client. Everything the client has to know about the inventory is
+	// handled below.
+	SERVERCOMMANDS_DestroyAllInventory( ulPlayer, ulClient, SVCF_ONLYTHISCLIENT );
+
+	// Also send this player's team.
+	if ( GAMEMODE_GetCurrentFlags() & GMF_PLAYERSONTEAMS )
+		SERVERCOMMANDS_SetPlayerTeam( ulPlayer, ulClient, SVCF_ONLYTHISCLIENT );
 
-			// [BB] If the player is in its SeeState, let the client know.
-			if ( ( pPlayer->mo->SeeState != NULL ) && ( pPlayer->mo->InStateSequence(pPlayer->mo->state, pPlayer->mo->SeeState) ) )
-				SERVERCOMMANDS_SetPlayerState( ulIdx, STATE_PLAYER_SEE, ulClient, SVCF_ONLYTHISCLIENT);
+	// Check if we need to tell the incoming player about any powerups this player may have.
+	// [BB] Also tell about all the ammo, weapons, backpacks and keys this player has.
+	// [BB] Keys need to be handled carefully. In order to display them properly in ST's fullscrenn HUD
+	// in coop spy, they need to be given in reverse order.
+	TArray<AInventory *> keys;
+	for ( pInventory = pPlayer->mo->Inventory; pInventory != NULL; pInventory = pInventory->Inventory )
+	{
+		if ( pInventory->IsKindOf( RUNTIME_CLASS( APowerup )))
+		{
+			SERVERCOMMANDS_GivePowerup( ulPlayer, static_cast<APowerup *>( pInventory ), ulClient, SVCF_ONLYTHISCLIENT );
+			if (( pInventory->IsKindOf( RUNTIME_CLASS( APowerInvulnerable ))) &&
+				(( pPlayer->mo->effects & FX_VISIBILITYFLICKER ) || ( pPlayer->mo->effects & FX_RESPAWNINVUL )))
+			{
+				SERVERCOMMANDS_PlayerRespawnInvulnerability( ulPlayer, ulClient, SVCF_ONLYTHISCLIENT );
+			}
+
+			// [BB] If it's a rune, we need to explicitly set its icon since it was set by the RuneGiver.
+			if ( pInventory == pInventory->Owner->Rune )
+			{
+				SERVERCOMMANDS_SetInventoryIcon( ulPlayer, pInventory, ulClient, SVCF_ONLYTHISCLIENT );
+			}
 		}
+		// [WS] Inform clients of their PowerupGiver items.
+		else if ( pInventory->IsKindOf( RUNTIME_CLASS( AAmmo )) || pInventory->IsKindOf( RUNTIME_CLASS( AWeapon ))
+			|| pInventory->IsKindOf( RUNTIME_CLASS( ABackpackItem ))
+			|| pInventory->IsKindOf( RUNTIME_CLASS( APowerupGiver )) )
+		{
+			SERVERCOMMANDS_GiveInventory( ulPlayer, pInventory, ulClient, SVCF_ONLYTHISCLIENT );
+			// [BB] Ammo max amount needs to be handled explicitly.
+			if ( pInventory->IsKindOf( RUNTIME_CLASS( AAmmo ) ) )
+				SERVERCOMMANDS_SetPlayerAmmoCapacity( ulPlayer, pInventory, ulClient, SVCF_ONLYTHISCLIENT );
+		}
+		else if ( pInventory->IsKindOf( RUNTIME_CLASS( AKey )) )
+			keys.Push ( pInventory );
+		else if ( pInventory->IsA( RUNTIME_CLASS( AWeaponHolder )) )
+		{
+			// [Dusk] Inform the client of weapon holders
+			SERVERCOMMANDS_GiveWeaponHolder( ulPlayer, static_cast<AWeaponHolder *>( pInventory ), ulClient, SVCF_ONLYTHISCLIENT );
+		}
+	}
+	// [BB] Now give the keys we just collected from the inventory in reverse order.
+	while ( keys.Size() )
+	{
+		keys.Pop( pInventory );
+		SERVERCOMMANDS_GiveInventory( ulPlayer, pInventory, ulClient, SVCF_ONLYTHISCLIENT );
+	}
+
+	// Also if this player is currently dead, let the incoming player know that.
+	if ( pPlayer->mo->health <= 0 )
+		SERVERCOMMANDS_ThingIsCorpse( pPlayer->mo, ulClient, SVCF_ONLYTHISCLIENT );
+	// [BB] SERVERCOMMANDS_SpawnPlayer instructs the client to spawn a player
+	// with default health. So we still need to send the correct current health value
+	// (if the player is not dead). Also set the armor and the corresponding max bonuses.
+	else
+	{
+		SERVERCOMMANDS_SetPlayerHealthAndMaxHealthBonus( ulPlayer, ulClient, SVCF_ONLYTHISCLIENT );
+		SERVERCOMMANDS_SetPlayerArmorAndMaxArmorBonus( ulPlayer, ulClient, SVCF_ONLYTHISCLIENT );
+		// [BB] Also send all non-default flag values.
+		SERVERCOMMANDS_UpdateThingFlagsNotAtDefaults( pPlayer->mo, ulClient, SVCF_ONLYTHISCLIENT );
 
-		// [BB] Clients need to know the active weapons of other players, so send it.
-		SERVERCOMMANDS_WeaponChange( ulIdx, ulClient, SVCF_ONLYTHISCLIENT );
+		// [BB] If the player is in its SeeState, let the client know.
+		if ( ( pPlayer->mo->SeeState != NULL ) && ( pPlayer->mo->InStateSequence(pPlayer->mo->state, pPlayer->mo->SeeState) ) )
+			SERVERCOMMANDS_SetPlayerState( ulPlayer, STATE_PLAYER_SEE, ulClient, SVCF_ONLYTHISCLIENT);
+	}
 
-		// [BB] It's possible that the MaxHealth property was changed dynamically with ACS, so send it.
-		SERVERCOMMANDS_SetPlayerMaxHealth( ulIdx, ulClient, SVCF_ONLYTHISCLIENT );
+	// [BB] Clients need to know the active weapons of other players, so send it.
+	SERVERCOMMANDS_WeaponChange( ulPlayer, ulClient, SVCF_ONLYTHISCLIENT );
 
-		// [BB] Send the number of lives left.
-		SERVERCOMMANDS_SetPlayerLivesLeft( ulIdx, ulClient, SVCF_ONLYTHISCLIENT );
+	// [BB] It's possible that the MaxHealth property was changed dynamically with ACS, so send it.
+	SERVERCOMMANDS_SetPlayerMaxHealth( ulPlayer, ulClient, SVCF_ONLYTHISCLIENT );
 
-		// [BB] Also tell this player's chat / console status to the new client.
-		// [AK] Tell the client whether this player is lagging or not. This prevents the client from
-		// seeing players with the lag icon over their head indefinitely after a level change.
-		SERVERCOMMANDS_SetPlayerStatus( ulIdx, PLAYERSTATUS_CHATTING, ulClient, SVCF_ONLYTHISCLIENT );
-		SERVERCOMMANDS_SetPlayerStatus( ulIdx, PLAYERSTATUS_INCONSOLE, ulClient, SVCF_ONLYTHISCLIENT );
-		SERVERCOMMANDS_SetPlayerStatus( ulIdx, PLAYERSTATUS_INMENU, ulClient, SVCF_ONLYTHISCLIENT );
-		SERVERCOMMANDS_SetPlayerStatus( ulIdx, PLAYERSTATUS_LAGGING, ulClient, SVCF_ONLYTHISCLIENT );
+	// [BB] Send the number of lives left.
+	SERVERCOMMANDS_SetPlayerLivesLeft( ulPlayer, ulClient, SVCF_ONLYTHISCLIENT );
 
-		// [BB] If this player has any cheats, also inform the new client.
-		if( players[ulIdx].cheats )
-			SERVERCOMMANDS_SetPlayerCheats(  ulIdx, ulClient, SVCF_ONLYTHISCLIENT );
+	// [BB] Also tell this player's chat / console status to the new client.
+	// [AK] Tell the client whether this player is lagging or not. This prevents the client from
+	// seeing players with the lag icon over their head indefinitely after a level change.
+	SERVERCOMMANDS_SetPlayerStatus( ulPlayer, PLAYERSTATUS_CHATTING, ulClient, SVCF_ONLYTHISCLIENT );
+	SERVERCOMMANDS_SetPlayerStatus( ulPlayer, PLAYERSTATUS_INCONSOLE, ulClient, SVCF_ONLYTHISCLIENT );
+	SERVERCOMMANDS_SetPlayerStatus( ulPlayer, PLAYERSTATUS_INMENU, ulClient, SVCF_ONLYTHISCLIENT );
+	SERVERCOMMANDS_SetPlayerStatus( ulPlayer, PLAYERSTATUS_LAGGING, ulClient, SVCF_ONLYTHISCLIENT );
 
-		// [Dusk] Hexen armor values
-		SERVERCOMMANDS_SyncHexenArmorSlots( ulIdx, ulClient, SVCF_ONLYTHISCLIENT );
+	// [BB] If this player has any cheats, also inform the new client.
+	if( players[ulPlayer].cheats )
+		SERVERCOMMANDS_SetPlayerCheats(  ulPlayer, ulClient, SVCF_ONLYTHISCLIENT );
 
-		// [WS] Update the player's properties if they changed.
-		SERVER_UpdateActorProperties( players[ulIdx].mo, ulClient );
+	// [Dusk] Hexen armor values
+	SERVERCOMMANDS_SyncHexenArmorSlots( ulPlayer, ulClient, SVCF_ONLYTHISCLIENT );
 
-		// [TP] Update the player's TID, if there is one.
-		if ( players[ulIdx].mo->tid )
-			SERVERCOMMANDS_SetThingTID( players[ulIdx].mo, ulClient, SVCF_ONLYTHISCLIENT );
+	// [WS] Update the player's properties if they changed.
+	SERVER_UpdateActorProperties( players[ulPlayer].mo, ulClient );
+
+	// [TP] Update the player's TID, if there is one.
+	if ( players[ulPlayer].mo->tid )
+		SERVERCOMMANDS_SetThingTID( players[ulPlayer].mo, ulClient, SVCF_ONLYTHISCLIENT );
+
+	// [AK] Update the player's country index if they're not a bot, they aren't hiding it, and it isn't "N/A".
+	if (( players[ulPlayer].bIsBot == false ) && ( g_aClients[ulPlayer].bWantHideCountry == false ) && ( players[ulPlayer].ulCountryIndex > 0 ))
+		SERVERCOMMANDS_SetPlayerCountry( ulPlayer, ulClient, SVCF_ONLYTHISCLIENT );
+
+	// [TP] Account name.
+	if ( g_aClients[ulPlayer].WantHideAccount == false )
+		SERVERCOMMANDS_SetPlayerAccountName( ulPlayer, ulClient, SVCF_ONLYTHISCLIENT );
+}
+
+//*****************************************************************************
+//
+void SERVER_SendFullUpdate( ULONG ulClient )
+{
+	AActor						*pActor;
+	ULONG						ulIdx;
+	TThinkerIterator<AActor>	Iterator;
 
-		// [AK] Update the player's country index if they're not a bot, they aren't hiding it, and it isn't "N/A".
-		if (( players[ulIdx].bIsBot == false ) && ( g_aClients[ulIdx].bWantHideCountry == false ) && ( players[ulIdx].ulCountryIndex > 0 ))
-			SERVERCOMMANDS_SetPlayerCountry( ulIdx, ulClient, SVCF_ONLYTHISCLIENT );
+	// Send active players to the client.
+	for ( ulIdx = 0; ulIdx < MAXPLAYERS; ulIdx++ )
+	{
+		if (( ulClient == ulIdx ) || ( playeringame[ulIdx] == false ))
+			continue;
 
-		// [TP] Account name.
-		if ( g_aClients[ulIdx].WantHideAccount == false )
-			SERVERCOMMANDS_SetPlayerAccountName( ulIdx, ulClient, SVCF_ONLYTHISCLIENT );
+		server_SendPlayerFullUpdate( ulIdx, ulClient );
 	}
 
 	// Server may have already picked a team for the incoming player. If so, tell him!
@@ -2857,9 +3107,9 @@ void SERVER_SendFullUpdate( ULONG ulClient )
 
 	// [EP] If the sky scroll speed is changed, let the client know about it.
 	if ( level.info && level.skyspeed1 != level.info->skyspeed1 )
-		SERVERCOMMANDS_SetMapSkyScrollSpeed( /*isSky1 =*/ true );
+		SERVERCOMMANDS_SetMapSkyScrollSpeed( /*isSky1 =*/ true, ulClient, SVCF_ONLYTHISCLIENT );
 	if ( level.info && level.skyspeed2 != level.info->skyspeed2 )
-		SERVERCOMMANDS_SetMapSkyScrollSpeed( /*isSky1 =*/ false );
+		SERVERCOMMANDS_SetMapSkyScrollSpeed( /*isSky1 =*/ false, ulClient, SVCF_ONLYTHISCLIENT );
 
 	// [BB]
 	SERVERCOMMANDS_SetDefaultSkybox( ulClient, SVCF_ONLYTHISCLIENT ); 
@@ -2886,23 +3136,145 @@ void SERVER_SendFullUpdate( ULONG ulClient )
 		{
 			const PlayerValue DefaultVal = pair->Value.GetDefaultValue( );
 
-			// [AK] First, tell them to reset everyone's values to default.
-			SERVERCOMMANDS_ResetCustomPlayerValue( pair->Value, MAXPLAYERS, g_lCurrentClient, SVCF_ONLYTHISCLIENT );
+			// [AK] First, tell them to reset everyone's values to default.
+			SERVERCOMMANDS_ResetCustomPlayerValue( pair->Value, MAXPLAYERS, ulClient, SVCF_ONLYTHISCLIENT );
+
+			for ( ULONG ulIdx = 0; ulIdx < MAXPLAYERS; ulIdx++ )
+			{
+				// [AK] Ignore the client themselves, or invalid players.
+				if (( ulIdx == ulClient ) || ( PLAYER_IsValidPlayer( ulIdx ) == false ))
+					continue;
+
+				// [AK] Don't bother sending out values that are already equal to the default value.
+				if ( pair->Value.GetValue( ulIdx ) == DefaultVal )
+					continue;
+
+				SERVERCOMMANDS_SetCustomPlayerValue( pair->Value, ulIdx, ulClient, SVCF_ONLYTHISCLIENT );
+			}
+		}
+	}
+}
+
+//*****************************************************************************
+//
+// Sends the client what it would get if it loaded the level right now. Unlike the
+// full update alone, this starts over with a freshly loaded level.
+static void server_SendLevelSnapshot( ULONG ulClient )
+{
+	SERVERCOMMANDS_SetConsolePlayer( ulClient );
+	SERVERCOMMANDS_SetGameDMFlags( ulClient, SVCF_ONLYTHISCLIENT );
+	SERVERCOMMANDS_SetGameSkill( ulClient, SVCF_ONLYTHISCLIENT );
+	SERVERCOMMANDS_SetGameMode( ulClient, SVCF_ONLYTHISCLIENT );
+	SERVERCOMMANDS_SetGameModeLimits( ulClient, SVCF_ONLYTHISCLIENT );
+
+	if ( lastmanstanding || teamlms )
+		SERVERCOMMANDS_SetLMSAllowedWeapons( ulClient, SVCF_ONLYTHISCLIENT );
+
+	SERVERCOMMANDS_SetLMSSpectatorSettings( ulClient, SVCF_ONLYTHISCLIENT );
+
+	if ( GAMEMODE_GetCurrentFlags() & GMF_USETEAMITEM )
+		SERVERCOMMANDS_SetSimpleCTFSTMode( ulClient, SVCF_ONLYTHISCLIENT );
+
+	SERVERCOMMANDS_MapLoad( ulClient, SVCF_ONLYTHISCLIENT );
+	SERVERCOMMANDS_SetMapMusic( SERVER_GetMapMusic( ), SERVER_GetMapMusicOrder( ), ulClient, SVCF_ONLYTHISCLIENT );
+	server_SendGameModeState( ulClient );
+
+	SERVER_UpdateLines( ulClient );
+	SERVER_UpdateSides( ulClient );
+	SERVER_UpdateSectors( ulClient );
+	SERVER_UpdateMovers( ulClient );
+
+	// The full update leaves out the client's own player, who is spawned the same way here.
+	if ( playeringame[ulClient] )
+		server_SendPlayerFullUpdate( ulClient, ulClient );
+
+	SERVER_SendFullUpdate( ulClient );
+	server_SendCarriedItems( ulClient );
+}
+
+//*****************************************************************************
+//
+static void server_CaptureSnapshotPacket( NETBUFFER_s &Buffer )
+{
+	const LONG lSize = Buffer.CalcSize( );
+
+	if ( lSize > 0 )
+	{
+		const unsigned int uPosition = g_pSnapshot->Size( );
+		g_pSnapshot->Resize( uPosition + lSize );
+		memcpy( &(*g_pSnapshot)[uPosition], Buffer.pbData, lSize );
+	}
+
+	Buffer.Clear( );
+}
+
+//*****************************************************************************
+//
+// Puts together what server_SendLevelSnapshot would send to the client, without
+// sending it. Demos store this as a keyframe playback can jump to.
+void SERVER_BuildLevelSnapshot( ULONG ulClient, TArray<BYTE> &Snapshot )
+{
+	CLIENT_s *pClient = SERVER_GetClient( ulClient );
+
+	Snapshot.Clear( );
+	if ( pClient == NULL )
+		return;
+
+	// What was sent to the client before isn't part of the snapshot.
+	if ( pClient->PacketBuffer.CalcSize( ) > 0 )
+		SERVER_SendClientPacket( ulClient, true );
+	if ( pClient->UnreliablePacketBuffer.CalcSize( ) > 0 )
+		SERVER_SendClientPacket( ulClient, false );
+
+	const bool bFullUpdateIncomplete = pClient->bFullUpdateIncomplete;
+
+	g_lSnapshotClient = ulClient;
+	g_pSnapshot = &Snapshot;
+	server_SendLevelSnapshot( ulClient );
+	SERVER_SendClientPacket( ulClient, true );
+	SERVER_SendClientPacket( ulClient, false );
+	g_lSnapshotClient = -1;
+	g_pSnapshot = NULL;
+
+	// The client only stores the snapshot, so it won't acknowledge the full update in it.
+	pClient->bFullUpdateIncomplete = bFullUpdateIncomplete;
+
+	// Whoever starts over from the snapshot doesn't know the movement the following
+	// updates would be relative to, so send them in full.
+	SERVER_ResetMoveSnapshots( ulClient );
+}
+
+//*****************************************************************************
+//
+void SERVER_ResetMoveSnapshots( ULONG ulClient )
+{
+	if ( ulClient >= MAXPLAYERS )
+		return;
+
+	for ( ULONG ulSnapshot = 0; ulSnapshot < NUM_MOVE_SNAPSHOTS; ulSnapshot++ )
+	{
+		g_aClients[ulClient].alMoveSnapshotTics[ulSnapshot] = 0;
+		for ( ULONG ulPlayer = 0; ulPlayer < MAXPLAYERS; ulPlayer++ )
+			g_aClients[ulClient].aMoveSnapshots[ulSnapshot][ulPlayer].bValid = false;
+	}
+
+	for ( ULONG ulPlayer = 0; ulPlayer < MAXPLAYERS; ulPlayer++ )
+		g_aClients[ulClient].alMoveSnapshotAcks[ulPlayer] = -1;
 
-			for ( ULONG ulIdx = 0; ulIdx < MAXPLAYERS; ulIdx++ )
-			{
-				// [AK] Ignore the client themselves, or invalid players.
-				if (( ulIdx == static_cast<ULONG>( g_lCurrentClient )) || ( PLAYER_IsValidPlayer( ulIdx ) == false ))
-					continue;
+	g_aClients[ulClient].ulMoveSnapshot = 0;
+}
 
-				// [AK] Don't bother sending out values that are already equal to the default value.
-				if ( pair->Value.GetValue( ulIdx ) == DefaultVal )
-					continue;
+//*****************************************************************************
+//
+// Starts the snapshot the movement of the following update to this client is saved to.
+static void server_BeginMoveSnapshot( ULONG ulClient )
+{
+	CLIENT_s *pClient = &g_aClients[ulClient];
 
-				SERVERCOMMANDS_SetCustomPlayerValue( pair->Value, ulIdx, g_lCurrentClient, SVCF_ONLYTHISCLIENT );
-			}
-		}
-	}
+	pClient->ulMoveSnapshot = ( pClient->ulMoveSnapshot + 1 ) % NUM_MOVE_SNAPSHOTS;
+	pClient->alMoveSnapshotTics[pClient->ulMoveSnapshot] = gametic;
+	for ( ULONG ulPlayer = 0; ulPlayer < MAXPLAYERS; ulPlayer++ )
+		pClient->aMoveSnapshots[pClient->ulMoveSnapshot][ulPlayer].bValid = false;
 }
 
 //*****************************************************************************
@@ -2947,6 +3319,11 @@ void SERVER_WriteCommands( void )
 		// [BB] Only necessary if we are in a level.
 		if ( gamestate == GS_LEVEL )
 		{
+			// Everything sent with this update is remembered as one snapshot,
+			// later updates only send how the players moved since then.
+			if ( sv_deltamovement )
+				server_BeginMoveSnapshot( ulIdx );
+
 			for ( ULONG ulPlayer = 0; ulPlayer < MAXPLAYERS; ulPlayer++ )
 			{
 				if ( ( playeringame[ulPlayer] == false ) || players[ulPlayer].bSpectating )
@@ -2956,7 +3333,37 @@ void SERVER_WriteCommands( void )
 				if ( ulPlayer == ulIdx )
 					continue;
 
-				SERVERCOMMANDS_MovePlayer( ulPlayer, ulIdx, SVCF_ONLYTHISCLIENT );
+				// Players far away from what this client is looking at are updated less often.
+				if ( server_ShouldThrottleMovement( ulIdx, ulPlayer ))
+				{
+					g_aClients[ulIdx].ulThrottledMovements++;
+					continue;
+				}
+
+				const bool bCulled = server_IsPlayerCulled( ulIdx, ulPlayer );
+				const LONG lSizeBefore = g_aClients[ulIdx].UnreliablePacketBuffer.CalcSize( );
+
+				if ( sv_deltamovement )
+					SERVERCOMMANDS_MovePlayerDelta( ulPlayer, ulIdx );
+				else
+					SERVERCOMMANDS_MovePlayer( ulPlayer, ulIdx, SVCF_ONLYTHISCLIENT );
+
+				// Remember what the updates cost to estimate how much the culling saved. If the command
+				// didn't fit and the buffer was sent, the size can't be measured.
+				const LONG lSize = g_aClients[ulIdx].UnreliablePacketBuffer.CalcSize( ) - lSizeBefore;
+				if ( lSize > 0 )
+				{
+					if ( bCulled )
+					{
+						g_aClients[ulIdx].ulHiddenMovements++;
+						g_aClients[ulIdx].qwHiddenMovementBytes += lSize;
+					}
+					else if ( SERVER_IsPlayerVisible( ulIdx, ulPlayer ))
+					{
+						g_aClients[ulIdx].ulFullMovements++;
+						g_aClients[ulIdx].qwFullMovementBytes += lSize;
+					}
+				}
 			}
 		}
 
@@ -3028,6 +3435,14 @@ void SERVER_WriteCommands( void )
 	// Once every minute, update the level time.
 	if (( gametic % ( 60 * TICRATE )) == 0 )
 		SERVERCOMMANDS_SetMapTime( );
+
+	// Go on sending the demo keyframes clients asked for. The first pieces were sent with
+	// the request.
+	for ( ULONG ulIdx = 0; ulIdx < MAXPLAYERS; ++ulIdx )
+	{
+		if (( g_aClients[ulIdx].DemoKeyframe.Size( ) > 0 ) && ( g_aClients[ulIdx].lLastDemoKeyframeTic != gametic ))
+			server_SendDemoKeyframePieces( ulIdx );
+	}
 }
 
 //*****************************************************************************
@@ -3161,9 +3576,15 @@ void SERVER_DisconnectClient( ULONG ulClient, bool bBroadcast, bool bSaveInfo )
 	// [RC] Update clients using the RCON utility.
 	SERVER_RCON_UpdateInfo( SVRCU_PLAYERDATA );
 
+	// If this was the demo recorder, finish the demo with what it was sent last.
+	if ( SERVERDEMO_IsRecorder( ulClient ))
+		SERVERDEMO_FinishRecording( );
+
 	// Clear the client's buffers.
 	g_aClients[ulClient].PacketBuffer.Clear();
 	g_aClients[ulClient].UnreliablePacketBuffer.Clear();
+	g_aClients[ulClient].PacketSegments.Clear();
+	g_aClients[ulClient].UnreliablePacketSegments.Clear();
 	g_aClients[ulClient].SavedPackets.Clear();
 
 	// Tell the join queue module that a player has left the game.
@@ -3699,6 +4120,15 @@ void SERVER_LoadNewLevel( const char *pszMapName )
 	// Tell the client to authenticate his level.
 	SERVERCOMMANDS_MapAuthenticate( pszMapName );
 
+	// The player movement of the previous level is no baseline for the new one.
+	for ( ulIdx = 0; ulIdx < MAXPLAYERS; ulIdx++ )
+		SERVER_ResetMoveSnapshots( ulIdx );
+
+	// Launchers shouldn't be told about the previous level either.
+	SERVER_MASTER_InvalidateServerInfo( );
+
+	server_SetupVisibilityCulling( );
+
 	for ( ulIdx = 0; ulIdx < MAXPLAYERS; ulIdx++ )
 	{
 		if ( SERVER_IsValidClient( ulIdx ) == false )
@@ -3886,6 +4316,10 @@ bool SERVER_IsEveryoneReadyToGoOn( void )
 //
 bool SERVER_IsPlayerVisible( ULONG ulPlayer, ULONG ulPlayer2 )
 {
+	// The demo recorder sees everything, so the demo can be watched from everyone's view.
+	if ( SERVERDEMO_IsRecorder( ulPlayer ))
+		return ( true );
+
 	// Can ulPlayer see ulPlayer2?
 	if (( teamlms || lastmanstanding ) &&
 		(( lmsspectatorsettings & LMS_SPF_VIEW ) == false ) &&
@@ -3896,10 +4330,108 @@ bool SERVER_IsPlayerVisible( ULONG ulPlayer, ULONG ulPlayer2 )
 		return ( false );
 	}
 
+	if ( server_IsPlayerCulled( ulPlayer, ulPlayer2 ))
+		return ( false );
+
 	// Passed all checks!
 	return ( true );
 }
 
+//*****************************************************************************
+//
+// The REJECT lump is the sector visibility the node builder precomputed for the map.
+// It doesn't know about stacked sector portals though, so it's not used if there are any.
+static void server_SetupVisibilityCulling( void )
+{
+	g_bRejectCulling = ( rejectmatrix != NULL );
+
+	for ( int i = 0; ( i < numsectors ) && g_bRejectCulling; i++ )
+	{
+		sector_t &sector = sectors[i];
+
+		if (( sector.portals[sector_t::floor] != NULL ) || ( sector.portals[sector_t::ceiling] != NULL )
+			|| (( sector.FloorSkyBox != NULL ) && sector.FloorSkyBox->IsKindOf( RUNTIME_CLASS( AStackPoint )))
+			|| (( sector.CeilingSkyBox != NULL ) && sector.CeilingSkyBox->IsKindOf( RUNTIME_CLASS( AStackPoint ))))
+		{
+			g_bRejectCulling = false;
+		}
+	}
+}
+
+//*****************************************************************************
+//
+static void server_ResetVisibilityStats( ULONG ulClient )
+{
+	g_aClients[ulClient].ulHiddenMovements = 0;
+	g_aClients[ulClient].ulThrottledMovements = 0;
+	g_aClients[ulClient].ulFullMovements = 0;
+	g_aClients[ulClient].qwFullMovementBytes = 0;
+	g_aClients[ulClient].qwHiddenMovementBytes = 0;
+}
+
+//*****************************************************************************
+//
+// Returns the actor the client is looking through.
+static AActor *server_GetViewActor( ULONG ulClient )
+{
+	const ULONG ulDisplayPlayer = g_aClients[ulClient].ulDisplayPlayer;
+
+	if (( ulDisplayPlayer != ulClient ) && ( ulDisplayPlayer < MAXPLAYERS ) && ( players[ulDisplayPlayer].mo != NULL ))
+		return ( players[ulDisplayPlayer].mo );
+
+	if ( players[ulClient].camera != NULL )
+		return ( players[ulClient].camera );
+
+	return ( players[ulClient].mo );
+}
+
+//*****************************************************************************
+//
+// Is ulPlayer in a sector ulClient can't see according to the REJECT lump?
+static bool server_IsPlayerCulled( ULONG ulClient, ULONG ulPlayer )
+{
+	if (( sv_visibilityculling == false ) || ( g_bRejectCulling == false ) || ( ulClient == ulPlayer ) || SERVERDEMO_IsRecorder( ulClient ))
+		return ( false );
+
+	AActor *pViewer = server_GetViewActor( ulClient );
+	AActor *pmo = players[ulPlayer].mo;
+
+	if (( pViewer == NULL ) || ( pmo == NULL ) || ( pViewer == pmo ) || ( pViewer->Sector == NULL ) || ( pmo->Sector == NULL ))
+		return ( false );
+
+	// Teammates are always known, e.g. for the automap.
+	if (( players[ulClient].mo != NULL ) && players[ulClient].mo->IsTeammate( pmo ))
+		return ( false );
+
+	const int rejectnum = static_cast<int> ( pViewer->Sector - sectors ) * numsectors + static_cast<int> ( pmo->Sector - sectors );
+	return (( rejectmatrix[rejectnum >> 3] & ( 1 << ( rejectnum & 7 ))) != 0 );
+}
+
+//*****************************************************************************
+//
+// Should the movement of ulPlayer not be sent with this update to ulClient because of sv_updatedistance?
+static bool server_ShouldThrottleMovement( ULONG ulClient, ULONG ulPlayer )
+{
+	if (( sv_updatedistance <= 0 ) || SERVERDEMO_IsRecorder( ulClient ))
+		return ( false );
+
+	const AActor *pViewer = server_GetViewActor( ulClient );
+	const AActor *pmo = players[ulPlayer].mo;
+
+	if (( pViewer == NULL ) || ( pmo == NULL ) || ( pViewer == pmo ))
+		return ( false );
+
+	const double dX = FIXED2DBL( pmo->x ) - FIXED2DBL( pViewer->x );
+	const double dY = FIXED2DBL( pmo->y ) - FIXED2DBL( pViewer->y );
+	const double dZ = FIXED2DBL( pmo->z ) - FIXED2DBL( pViewer->z );
+	const double dDistance = sqrt( dX * dX + dY * dY + dZ * dZ );
+	const ULONG ulScale = MIN( 1 + static_cast<ULONG> ( dDistance / sv_updatedistance ), MAX_MOVEMENT_UPDATE_SCALE );
+
+	// Spread the updates of the players with the same scale over the intervals in between.
+	const ULONG ulUpdate = gametic / players[ulClient].userinfo.GetTicsPerUpdate( );
+	return ((( ulUpdate + ulPlayer ) % ulScale ) != 0 );
+}
+
 //*****************************************************************************
 //
 bool SERVER_IsPlayerAllowedToKnowHealth( ULONG ulPlayer, ULONG ulPlayer2 )
@@ -3908,6 +4440,10 @@ bool SERVER_IsPlayerAllowedToKnowHealth( ULONG ulPlayer, ULONG ulPlayer2 )
 	if ( ( ulPlayer >= MAXPLAYERS ) || ( ulPlayer2 >= MAXPLAYERS ) )
 		return ( false );
 
+	// The demo recorder knows everything, so the demo can be watched from everyone's view.
+	if ( SERVERDEMO_IsRecorder( ulPlayer ))
+		return ( true );
+
 	// No bodies? Definitely not!
 	if (( players[ulPlayer].mo == NULL ) || ( players[ulPlayer2].mo == NULL ))
 		return ( false );
@@ -4818,6 +5354,8 @@ bool SERVER_ProcessCommand( LONG lCommand, BYTESTREAM_s *pByteStream )
 	case CLC_SPECTATEINFO:
 	case CLC_CHANGEDISPLAYPLAYER:
 	case CLC_AUTHENTICATELEVEL:
+	case CLC_ACKMOVESNAPSHOTS:
+	case CLC_REQUESTDEMOKEYFRAME:
 		break;
 	default:
 		g_aClients[g_lCurrentClient].lLastActionTic = gametic;
@@ -5144,6 +5682,14 @@ bool SERVER_ProcessCommand( LONG lCommand, BYTESTREAM_s *pByteStream )
 			}
 		}
 		break;
+	case CLC_ACKMOVESNAPSHOTS:
+
+		// Client acknowledges the player movements it received.
+		return ( server_AckMoveSnapshots( pByteStream ));
+	case CLC_REQUESTDEMOKEYFRAME:
+
+		// Client wants a keyframe for the demo it's recording.
+		return ( server_RequestDemoKeyframe( pByteStream ));
 	default:
 
 		Printf( PRINT_HIGH, "SERVER_ParseCommands: Unknown client message: %d\n", static_cast<int> (lCommand) );
@@ -6754,6 +7300,117 @@ static bool server_SpectateInfo( BYTESTREAM_s *pByteStream )
 	return ( false );
 }
 
+//*****************************************************************************
+//
+// The client tells us the newest MovePlayerDelta it applied for some players. Only these are
+// used as baselines, see SERVERCOMMANDS_MovePlayerDelta.
+static bool server_AckMoveSnapshots( BYTESTREAM_s *pByteStream )
+{
+	CLIENT_s *pClient = &g_aClients[g_lCurrentClient];
+	const ULONG ulNumAcks = pByteStream->ReadByte();
+
+	for ( ULONG ulIdx = 0; ulIdx < ulNumAcks; ulIdx++ )
+	{
+		const ULONG ulPlayerByte = pByteStream->ReadByte();
+		const ULONG ulPlayer = ulPlayerByte & ~MOVEACK_NOBASELINE;
+
+		// The client lost the baseline of this player, send everything next time.
+		if ( ulPlayerByte & MOVEACK_NOBASELINE )
+		{
+			if ( ulPlayer < MAXPLAYERS )
+				pClient->alMoveSnapshotAcks[ulPlayer] = -1;
+			continue;
+		}
+
+		const ULONG ulTic = pByteStream->ReadByte();
+		if ( ulPlayer >= MAXPLAYERS )
+			continue;
+
+		// Only the low byte of the tic is sent, the snapshots span less than 256 tics. Acks
+		// may arrive in the wrong order, so only newer ones count.
+		for ( ULONG ulSnapshot = 0; ulSnapshot < NUM_MOVE_SNAPSHOTS; ulSnapshot++ )
+		{
+			const LONG lTic = pClient->alMoveSnapshotTics[ulSnapshot];
+
+			if ((( lTic & 0xFF ) == static_cast<LONG>( ulTic ))
+				&& pClient->aMoveSnapshots[ulSnapshot][ulPlayer].bValid
+				&& ( lTic > pClient->alMoveSnapshotAcks[ulPlayer] ))
+			{
+				pClient->alMoveSnapshotAcks[ulPlayer] = lTic;
+			}
+		}
+	}
+
+	return ( false );
+}
+
+//*****************************************************************************
+//
+// The client recording a demo wants a snapshot of the level it can store as a keyframe.
+static bool server_RequestDemoKeyframe( BYTESTREAM_s *pByteStream )
+{
+	CLIENT_s *pClient = &g_aClients[g_lCurrentClient];
+
+	// The snapshot is as large as a full update, so don't build one too often, and not
+	// while the last one is still being sent. Before the client has the level, there is
+	// nothing to build it from either.
+	if (( sv_allowdemokeyframes == false ) || ( gamestate != GS_LEVEL ) || ( pClient->State != CLS_SPAWNED )
+		|| pClient->bFullUpdateIncomplete || ( pClient->DemoKeyframe.Size( ) > 0 )
+		|| (( pClient->lLastDemoKeyframeTic != 0 ) && ( gametic - pClient->lLastDemoKeyframeTic < DEMOKEYFRAME_MINTICS )))
+	{
+		return ( false );
+	}
+
+	SERVER_BuildLevelSnapshot( g_lCurrentClient, pClient->DemoKeyframe );
+	pClient->ulDemoKeyframeSent = 0;
+	pClient->lLastDemoKeyframeTic = gametic;
+
+	// The first piece marks where the snapshot was taken, so it has to follow it right away.
+	server_SendDemoKeyframePieces( g_lCurrentClient );
+
+	return ( false );
+}
+
+//*****************************************************************************
+//
+// Sends the next pieces of a demo keyframe, no more than DEMOKEYFRAME_BYTESPERTIC per tic.
+static void server_SendDemoKeyframePieces( ULONG ulClient )
+{
+	CLIENT_s *pClient = &g_aClients[ulClient];
+	const ULONG ulSize = pClient->DemoKeyframe.Size( );
+
+	// The snapshot is of no use on another level. The client drops what it got with the map load.
+	if (( gamestate != GS_LEVEL ) || ( pClient->State != CLS_SPAWNED ) || ( ulSize == 0 ))
+	{
+		pClient->DemoKeyframe.Clear( );
+		return;
+	}
+
+	const ULONG ulPieceSize = MAX<ULONG>( SERVER_GetMaxPacketSize( ) / 2, 64 );
+	const ULONG ulEnd = MIN<ULONG>( pClient->ulDemoKeyframeSent + DEMOKEYFRAME_BYTESPERTIC, ulSize );
+
+	while ( pClient->ulDemoKeyframeSent < ulEnd )
+	{
+		const ULONG ulStart = pClient->ulDemoKeyframeSent;
+		const ULONG ulLength = MIN<ULONG>( ulPieceSize, ulSize - ulStart );
+		ULONG ulFlags = 0;
+
+		if ( ulStart == 0 )
+			ulFlags |= DEMOKEYFRAME_FIRSTPIECE;
+		if ( ulStart + ulLength == ulSize )
+			ulFlags |= DEMOKEYFRAME_LASTPIECE;
+
+		SERVERCOMMANDS_DemoKeyframePiece( &pClient->DemoKeyframe[ulStart], ulLength, ulFlags, ulClient );
+		pClient->ulDemoKeyframeSent += ulLength;
+	}
+
+	if ( pClient->ulDemoKeyframeSent >= ulSize )
+	{
+		pClient->DemoKeyframe.Clear( );
+		pClient->DemoKeyframe.ShrinkToFit( );
+	}
+}
+
 //*****************************************************************************
 //
 static bool server_GenericCheat( BYTESTREAM_s *pByteStream )
@@ -6951,9 +7608,6 @@ static bool server_ChangeDisplayPlayer( BYTESTREAM_s *pByteStream )
 //
 static bool server_AuthenticateLevel( BYTESTREAM_s *pByteStream )
 {
-	ULONG								ulState;
-	ULONG								ulCountdownTicks;
-
 	// [BB] Read the name of the map, the client is trying to authenticate.
 	const FString mapnameString = pByteStream->ReadString();
 
@@ -7020,43 +7674,7 @@ static bool server_AuthenticateLevel( BYTESTREAM_s *pByteStream )
 	SERVERCOMMANDS_SetMapMusic( SERVER_GetMapMusic( ), SERVER_GetMapMusicOrder( ), g_lCurrentClient, SVCF_ONLYTHISCLIENT );
 
 	// If we're in a duel or LMS mode, tell him the state of the game mode.
-	if ( duel || lastmanstanding || teamlms || possession || teampossession || survival || invasion )
-	{
-		if ( duel )
-		{
-			ulState = DUEL_GetState( );
-			ulCountdownTicks = DUEL_GetCountdownTicks( );
-		}
-		else if ( survival )
-		{
-			ulState = SURVIVAL_GetState( );
-			ulCountdownTicks = SURVIVAL_GetCountdownTicks( );
-		}
-		else if ( invasion )
-		{
-			ulState = INVASION_GetState( );
-			ulCountdownTicks = INVASION_GetCountdownTicks( );
-		}
-		else if ( possession || teampossession )
-		{
-			ulState = POSSESSION_GetState( );
-			if ( ulState == (PSNSTATE_e)PSNS_ARTIFACTHELD )
-				ulCountdownTicks = POSSESSION_GetArtifactHoldTicks( );
-			else
-				ulCountdownTicks = POSSESSION_GetCountdownTicks( );
-		}
-		else
-		{
-			ulState = LASTMANSTANDING_GetState( );
-			ulCountdownTicks = LASTMANSTANDING_GetCountdownTicks( );
-		}
-
-		SERVERCOMMANDS_SetGameModeState( ulState, ulCountdownTicks, g_lCurrentClient, SVCF_ONLYTHISCLIENT );
-
-		// Also, if we're in invasion mode, tell the client what wave we're on.
-		if ( invasion )
-			SERVERCOMMANDS_SetInvasionWave( g_lCurrentClient, SVCF_ONLYTHISCLIENT );
-	}
+	server_SendGameModeState( g_lCurrentClient );
 
 	// Tell the client of any lines that have been altered since the level start.
 	SERVER_UpdateLines( g_lCurrentClient );
@@ -7993,6 +8611,140 @@ CCMD( kickfromgame_idx )
 	Cmd_forcespec_idx( argv, who, key );
 }
 
+//*****************************************************************************
+//
+CCMD( sv_ticstats )
+{
+	if ( NETWORK_GetState( ) != NETSTATE_SERVER )
+		return;
+
+	if (( argv.argc( ) >= 2 ) && ( stricmp( argv[1], "reset" ) == 0 ))
+	{
+		memset( g_aulTicOversleepHistogram, 0, sizeof( g_aulTicOversleepHistogram ));
+		g_qwTicOversleepTotalMS = 0;
+		g_lTicOversleepMaxMS = 0;
+		g_ulTicTimingSamples = 0;
+		g_qwTicWakeups = 0;
+		NetCommand::resetAllocationStats( );
+		SharedPacketSegment::ResetAllocationStats( );
+		Printf( "Tic timing statistics reset.\n" );
+		return;
+	}
+
+	unsigned int uiCommands, uiCommandAllocations, uiSegments, uiSegmentAllocations;
+	NetCommand::getAllocationStats( uiCommands, uiCommandAllocations );
+	SharedPacketSegment::GetAllocationStats( uiSegments, uiSegmentAllocations );
+	Printf( "Server commands: %u created, %u buffer allocations\n", uiCommands, uiCommandAllocations );
+	Printf( "Shared commands: %u created, %u allocations\n", uiSegments, uiSegmentAllocations );
+
+	Printf( "Tick mode: %s\n", sv_eventdriventick ? "event driven" : "polling" );
+	if ( g_ulTicTimingSamples == 0 )
+	{
+		Printf( "No tics measured yet.\n" );
+		return;
+	}
+
+	Printf( "Oversleep over %u ticks (average %.2f ms, maximum %d ms, %.2f wakeups per tick):\n",
+		static_cast<unsigned int> ( g_ulTicTimingSamples ),
+		static_cast<double> ( g_qwTicOversleepTotalMS ) / g_ulTicTimingSamples,
+		static_cast<int> ( g_lTicOversleepMaxMS ),
+		static_cast<double> ( g_qwTicWakeups ) / g_ulTicTimingSamples );
+
+	for ( ULONG ulBucket = 0; ulBucket < NUM_TICOVERSLEEP_BUCKETS; ulBucket++ )
+	{
+		FString range;
+
+		if ( ulBucket == NUM_TICOVERSLEEP_BUCKETS - 1 )
+			range.Format( ">= %d ms", static_cast<int> ( g_alTicOversleepBuckets[ulBucket - 1] ));
+		else
+		{
+			const LONG lLow = ( ulBucket == 0 ) ? 0 : g_alTicOversleepBuckets[ulBucket - 1];
+			const LONG lHigh = g_alTicOversleepBuckets[ulBucket] - 1;
+
+			if ( lLow == lHigh )
+				range.Format( "%d ms", static_cast<int> ( lLow ));
+			else
+				range.Format( "%d-%d ms", static_cast<int> ( lLow ), static_cast<int> ( lHigh ));
+		}
+
+		Printf( "%10s: %8u (%5.1f%%)\n", range.GetChars( ), static_cast<unsigned int> ( g_aulTicOversleepHistogram[ulBucket] ),
+			100.0 * g_aulTicOversleepHistogram[ulBucket] / g_ulTicTimingSamples );
+	}
+}
+
+//*****************************************************************************
+//
+CCMD( sv_visibilitystats )
+{
+	if ( NETWORK_GetState( ) != NETSTATE_SERVER )
+		return;
+
+	if (( argv.argc( ) >= 2 ) && ( stricmp( argv[1], "reset" ) == 0 ))
+	{
+		for ( ULONG ulIdx = 0; ulIdx < MAXPLAYERS; ulIdx++ )
+			server_ResetVisibilityStats( ulIdx );
+
+		Printf( "Visibility statistics reset.\n" );
+		return;
+	}
+
+	Printf( "Visibility culling: %s", sv_visibilityculling ? "enabled" : "disabled" );
+	if ( sv_visibilityculling && ( g_bRejectCulling == false ))
+		Printf( " (not supported by this map)" );
+	Printf( ", update distance: %d\n", static_cast<int> ( sv_updatedistance ));
+
+	for ( ULONG ulIdx = 0; ulIdx < MAXPLAYERS; ulIdx++ )
+	{
+		if ( SERVER_IsValidClient( ulIdx ) == false )
+			continue;
+
+		const CLIENT_s &client = g_aClients[ulIdx];
+
+		// The updates that weren't sent would have cost as much as the full ones on average.
+		const double dAverage = ( client.ulFullMovements > 0 ) ? static_cast<double> ( client.qwFullMovementBytes ) / client.ulFullMovements : 0.0;
+		const double dSaved = MAX( 0.0, dAverage * ( client.ulHiddenMovements + client.ulThrottledMovements ) - client.qwHiddenMovementBytes );
+
+		Printf( "%s" TEXTCOLOR_NORMAL ": %u full, %u hidden, %u throttled player updates, about %.0f bytes saved\n",
+			players[ulIdx].userinfo.GetName( ),
+			static_cast<unsigned int> ( client.ulFullMovements ),
+			static_cast<unsigned int> ( client.ulHiddenMovements ),
+			static_cast<unsigned int> ( client.ulThrottledMovements ),
+			dSaved );
+	}
+}
+
+//*****************************************************************************
+//
+CCMD( sv_retransmitstats )
+{
+	if ( NETWORK_GetState( ) != NETSTATE_SERVER )
+		return;
+
+	const bool bReset = (( argv.argc( ) >= 2 ) && ( stricmp( argv[1], "reset" ) == 0 ));
+
+	for ( ULONG ulIdx = 0; ulIdx < MAXPLAYERS; ulIdx++ )
+	{
+		if ( SERVER_IsValidClient( ulIdx ) == false )
+			continue;
+
+		OutgoingPacketBuffer &packets = g_aClients[ulIdx].SavedPackets;
+
+		if ( bReset )
+		{
+			packets.ResetRetransmitStats( );
+			continue;
+		}
+
+		Printf( "%s" TEXTCOLOR_NORMAL ": %u packets retransmitted, %llu bytes\n",
+			players[ulIdx].userinfo.GetName( ),
+			packets.GetRetransmittedPackets( ),
+			static_cast<unsigned long long> ( packets.GetRetransmittedBytes( )));
+	}
+
+	if ( bReset )
+		Printf( "Retransmit statistics reset.\n" );
+}
+
 //*****************************************************************************
 #ifdef	_DEBUG
 CCMD( testchecksum )
@@ -58,6 +58,7 @@
 #include "s_sndseq.h"
 #include "r_data/sprites.h"
 #include "network/packetarchive.h"
+#include "network/packetsegments.h"
 #include <list>
 #include <queue>
 
@@ -85,6 +86,15 @@
 // [AK] Maximum amount of gametics of recent commands from a client that we can store.
 #define MAX_RECENT_COMMANDS			15
 
+// Number of player movement updates the server remembers for each client, see SERVERCOMMANDS_MovePlayerDelta.
+#define	NUM_MOVE_SNAPSHOTS			16
+
+// The least time between two demo keyframes the server sends to a client, see CLC_REQUESTDEMOKEYFRAME.
+#define	DEMOKEYFRAME_MINTICS		( 30 * TICRATE )
+
+// How many bytes of a demo keyframe are sent to a client per tic.
+#define	DEMOKEYFRAME_BYTESPERTIC	1024
+
 // [AK] Maximum amount of characters that can be put in sv_hostname.
 #define MAX_HOSTNAME_LENGTH			160
 
@@ -155,8 +165,6 @@
 // [SB] Set to indicate when the last segment in a response is reached.
 #define LAUNCHER_LAST_SEGMENT		0x80
 
-#define	MAX_STORED_QUERY_IPS		512
-
 //*****************************************************************************
 enum CLIENTSTATE_e
 {
@@ -240,6 +248,21 @@ struct CLIENT_MOVE_COMMAND_s
 	}
 };
 
+//*****************************************************************************
+// The movement of a player as it is known to a client after receiving a
+// MovePlayerDelta command. This is the baseline for the following deltas.
+struct MOVESNAPSHOT_s
+{
+	fixed_t			x;
+	fixed_t			y;
+	fixed_t			z;
+	angle_t			angle;
+	fixed_t			velx;
+	fixed_t			vely;
+	fixed_t			velz;
+	bool			bValid;
+};
+
 //*****************************************************************************
 struct CLIENT_SAVED_SPECIAL_s
 {
@@ -374,6 +397,11 @@ struct CLIENT_s
 	// A seperate buffer for non-critical commands that do not require sequencing.
 	NETBUFFER_s		UnreliablePacketBuffer;
 
+	// Commands shared with other clients that were written to PacketBuffer and
+	// UnreliablePacketBuffer, their Huffman codes are reused when the packets are sent.
+	PacketSegmentList	PacketSegments;
+	PacketSegmentList	UnreliablePacketSegments;
+
 	// We back up the last PACKET_BUFFER_SIZE packets we've sent to the client so that we can
 	// retransmit them if necessary.
 	OutgoingPacketBuffer	SavedPackets;
@@ -409,6 +437,13 @@ struct CLIENT_s
 	// [BB] Did the client not yet acknowledge receiving the last full update?
 	bool			bFullUpdateIncomplete;
 
+	// The gametic we last sent the client a keyframe for its demo.
+	LONG			lLastDemoKeyframeTic;
+
+	// The keyframe we are sending the client, and how much of it was sent already.
+	TArray<BYTE>	DemoKeyframe;
+	ULONG			ulDemoKeyframeSent;
+
 	// [AK] Are we in the middle of backtracing this player's movement via skip correction?
 	bool			bIsBacktracing;
 
@@ -516,6 +551,21 @@ struct CLIENT_s
 	// [CK] The client communicates back to us with the last gametic from the server it saw
 	LONG			lLastServerGametic;
 
+	// The movement of all players sent to this client with its last NUM_MOVE_SNAPSHOTS updates,
+	// and for each player the tic of the newest of them the client acknowledged (or -1).
+	MOVESNAPSHOT_s	aMoveSnapshots[NUM_MOVE_SNAPSHOTS][MAXPLAYERS];
+	LONG			alMoveSnapshotTics[NUM_MOVE_SNAPSHOTS];
+	ULONG			ulMoveSnapshot;
+	LONG			alMoveSnapshotAcks[MAXPLAYERS];
+
+	// How many player movement updates this client didn't get in full because of
+	// sv_visibilityculling or sv_updatedistance, and what the full ones cost.
+	ULONG			ulHiddenMovements;
+	ULONG			ulThrottledMovements;
+	ULONG			ulFullMovements;
+	QWORD			qwFullMovementBytes;
+	QWORD			qwHiddenMovementBytes;
+
 	// [TP] The size of this client's screen, for ACS.
 	WORD			ScreenWidth;
 	WORD			ScreenHeight;
@@ -595,6 +645,8 @@ void		SERVER_SendChatMessage( ULONG ulPlayer, ULONG ulMode, const char *pszStrin
 void		SERVER_DetermineConnectionType( BYTESTREAM_s *pByteStream );
 void		SERVER_SetupNewConnection( BYTESTREAM_s *pByteStream, bool bNewPlayer );
 void		SERVER_RequestClientToAuthenticate( ULONG ulClient );
+void		SERVER_ConnectDemoRecorder( ULONG ulClient );
+void		SERVER_ParseDemoRecorderPacket( ULONG ulClient, BYTESTREAM_s *pByteStream );
 void		SERVER_AuthenticateClientLevel( BYTESTREAM_s *pByteStream );
 bool		SERVER_PerformAuthenticationChecksum( BYTESTREAM_s *pByteStream );
 void		SERVER_ConnectNewPlayer( BYTESTREAM_s *pByteStream );
@@ -602,7 +654,9 @@ bool		SERVER_GetUserInfo( BYTESTREAM_s *pByteStream, bool bAllowKick, bool bEnfo
 void		SERVER_ConnectionError( NETADDRESS_s Address, const char *pszMessage, ULONG ulErrorCode );
 void		SERVER_ClientError( ULONG ulClient, ULONG ulErrorCode );
 void		SERVER_SendFullUpdate( ULONG ulClient );
+void		SERVER_BuildLevelSnapshot( ULONG ulClient, TArray<BYTE> &Snapshot );
 void		SERVER_WriteCommands( void );
+void		SERVER_ResetMoveSnapshots( ULONG ulClient );
 bool		SERVER_IsValidClient( ULONG ulClient );
 void		SERVER_AdjustPlayersReactiontime( const ULONG ulPlayer );
 void		SERVER_DisconnectClient( ULONG ulClient, bool bBroadcast, bool bSaveInfo );
@@ -679,6 +733,8 @@ void		SERVER_MASTER_Destruct( void );
 void		SERVER_MASTER_Tick( void );
 void		SERVER_MASTER_Broadcast( void );
 void		SERVER_MASTER_SendServerInfo( NETADDRESS_s Address, ULONG ulTime, ULONG ulFlags, ULONG ulFlags2, bool bSendSegmentedResponse, bool bBroadcasting );
+void		SERVER_MASTER_SendPendingServerInfo( void );
+void		SERVER_MASTER_InvalidateServerInfo( void );
 const char	*SERVER_MASTER_GetGameName( void );
 NETADDRESS_s SERVER_MASTER_GetMasterAddress( void );
 void		SERVER_MASTER_HandleVerificationRequest( BYTESTREAM_s *pByteStream );
@@ -87,6 +87,43 @@ struct LauncherResponseContext
 
 using LauncherFieldFunction = void(*)(const LauncherResponseContext &);
 
+// A packet of a launcher response, kept so that it can be sent to other launchers. The time
+// the launcher sent to us is the only thing that differs between queries, it's written
+// between the prefix and the body.
+struct CACHEDPACKET_s
+{
+	BYTE					abPrefix[16];
+	ULONG					ulPrefixSize;
+	bool					bHasTime;
+
+	// The rest of the packet. Its Huffman codes are computed once when it's stored.
+	SharedPacketSegment		*pBody;
+};
+
+//*****************************************************************************
+struct CACHEDRESPONSE_s
+{
+	// Corrected flags of this response.
+	ULONG					ulFlags;
+	ULONG					ulFlags2;
+	bool					bSegmented;
+
+	// Gametic this response was built on.
+	LONG					lBuildTic;
+
+	TArray<CACHEDPACKET_s>	Packets;
+};
+
+//*****************************************************************************
+struct PENDINGQUERY_s
+{
+	NETADDRESS_s			Address;
+	ULONG					ulTime;
+	ULONG					ulFlags;
+	ULONG					ulFlags2;
+	bool					bSegmented;
+};
+
 //--------------------------------------------------------------------------------------------------------------------------------------------------
 //-- VARIABLES -------------------------------------------------------------------------------------------------------------------------------------
 //--------------------------------------------------------------------------------------------------------------------------------------------------
@@ -103,13 +140,22 @@ static	NETBUFFER_s			g_FieldWorkBuffer;
 // Port the master server is located on.
 static	USHORT				g_usMasterPort;
 
-// List of IP address that this server has been queried by recently.
-static	STORED_QUERY_IP_s	g_StoredQueryIPs[MAX_STORED_QUERY_IPS];
+// List of IP address that this server has been queried by recently (in gametics).
+static	QueryIPQueue		g_StoredQueryIPs( TICRATE * 10 );
 
-static	LONG				g_lStoredQueryIPHead;
-static	LONG				g_lStoredQueryIPTail;
 static	TArray<int>			g_OptionalWadIndices;
 
+// Responses built for recent queries, launchers usually ask for the same few flag sets.
+static	CACHEDRESPONSE_s	g_CachedResponses[8];
+static	ULONG				g_ulNextCachedResponse;
+
+// Players in the game when the cached responses were built, see server_master_GetPlayerSignature.
+static	ULONG				g_ulCachedPlayerSignature;
+
+// Queries that passed the flood and ban checks, answered when the packets of the tic are sent.
+static	TArray<PENDINGQUERY_s>	g_PendingQueries;
+static	const unsigned int	MAX_PENDING_QUERIES = 512;
+
 extern	NETADDRESS_s		g_LocalAddress;
 
 FString g_VersionWithOS;
@@ -117,6 +163,15 @@ FString g_VersionWithOS;
 //*****************************************************************************
 //	CONSOLE VARIABLES
 
+// How many tics a launcher response may be reused for. Scores and pings are at most this old.
+CUSTOM_CVAR( Int, sv_queryresponsecachetics, TICRATE, CVAR_ARCHIVE|CVAR_NOSETBYACS )
+{
+	if ( self < 0 )
+		self = 0;
+	else
+		SERVER_MASTER_InvalidateServerInfo( );
+}
+
 //--------------------------------------------------------------------------------------------------------------------------------------------------
 //-- FUNCTIONS -------------------------------------------------------------------------------------------------------------------------------------
 //--------------------------------------------------------------------------------------------------------------------------------------------------
@@ -564,9 +619,6 @@ void SERVER_MASTER_Construct( void )
 	else 
 	   g_usMasterPort = DEFAULT_MASTER_PORT;
 
-	g_lStoredQueryIPHead = 0;
-	g_lStoredQueryIPTail = 0;
-
 #ifndef _WIN32
 	struct utsname u_name;
 	if ( uname(&u_name) < 0 )
@@ -594,6 +646,8 @@ void SERVER_MASTER_Construct( void )
 //
 void SERVER_MASTER_Destruct( void )
 {
+	SERVER_MASTER_InvalidateServerInfo( );
+
 	// [SB] Free the field work buffer.
 	g_FieldWorkBuffer.Free();
 
@@ -605,11 +659,7 @@ void SERVER_MASTER_Destruct( void )
 //
 void SERVER_MASTER_Tick( void )
 {
-	while (( g_lStoredQueryIPHead != g_lStoredQueryIPTail ) && ( gametic >= g_StoredQueryIPs[g_lStoredQueryIPHead].lNextAllowedGametic ))
-	{
-		g_lStoredQueryIPHead++;
-		g_lStoredQueryIPHead = g_lStoredQueryIPHead % MAX_STORED_QUERY_IPS;
-	}
+	g_StoredQueryIPs.adjustHead( gametic );
 
 	// Send an update to the master server every 30 seconds.
 	if ( gametic % ( TICRATE * 30 ))
@@ -710,11 +760,13 @@ void SERVER_MASTER_Broadcast( void )
 struct FillInData
 {
 	BYTE *pHeader;
+	// Where the launcher's time is written, or -1 if this segment doesn't contain it.
+	LONG lTimeOffset;
 	// (pointer, bits)
 	std::vector<std::pair<BYTE *, ULONG>> BitInfo;
 };
 
-static void server_master_PrepareSegment( const ULONG ulSegmentNumber, const ULONG ulTime, FillInData &fillIn )
+static void server_master_PrepareSegment( const ULONG ulSegmentNumber, FillInData &fillIn )
 {
 	g_MasterServerBuffer.Clear();
 	g_MasterServerBuffer.ByteStream.WriteLong( SERVER_LAUNCHER_SEGMENTED_CHALLENGE );
@@ -722,18 +774,22 @@ static void server_master_PrepareSegment( const ULONG ulSegmentNumber, const ULO
 	// [SB] These will be filled in later:
 	fillIn = {};
 	fillIn.pHeader = g_MasterServerBuffer.ByteStream.pbStream;
+	fillIn.lTimeOffset = -1;
 	g_MasterServerBuffer.ByteStream.WriteByte( 0 ); // Segment number. We know this now, but set the MSB if this is the last segment during flush.
 	g_MasterServerBuffer.ByteStream.WriteShort( 0 ); // Total uncompressed size of this packet.
 
 	// [SB] Additional info sent in the first segment.
 	if ( ulSegmentNumber == 0 )
 	{
-		g_MasterServerBuffer.ByteStream.WriteLong( ulTime );
+		fillIn.lTimeOffset = g_MasterServerBuffer.CalcSize();
+		g_MasterServerBuffer.ByteStream.WriteLong( 0 ); // The launcher's time, written when the response is sent.
 		g_MasterServerBuffer.ByteStream.WriteString( g_VersionWithOS.GetChars() );
 	}
 }
 
-static void server_master_FlushSegment( NETADDRESS_s Address, const FillInData &fillIn, ULONG &ulSegmentNumber, const bool bIsEnd )
+static void server_master_StorePacket( CACHEDRESPONSE_s &Response, const LONG lTimeOffset );
+
+static void server_master_FlushSegment( CACHEDRESPONSE_s &Response, const FillInData &fillIn, ULONG &ulSegmentNumber, const bool bIsEnd )
 {
 	BYTE *ptr = g_MasterServerBuffer.ByteStream.pbStream;
 	const ULONG size = g_MasterServerBuffer.CalcSize();
@@ -757,90 +813,21 @@ static void server_master_FlushSegment( NETADDRESS_s Address, const FillInData &
 
 	g_MasterServerBuffer.ByteStream.pbStream = ptr;
 
-	NETWORK_LaunchPacket( &g_MasterServerBuffer, Address );
+	server_master_StorePacket( Response, fillIn.lTimeOffset );
 
 	ulSegmentNumber++;
 }
 
 //*****************************************************************************
 //
-void SERVER_MASTER_SendServerInfo( NETADDRESS_s Address, ULONG ulTime, ULONG ulFlags, ULONG ulFlags2, bool bSendSegmentedResponse, bool bBroadcasting )
+// Removes the launcher's unknown and inapplicable flags.
+//
+static ULONG server_master_CorrectFlags( const ULONG ulFlags, const ULONG ulFlags2, const bool bSendSegmentedResponse, ULONG &ulBits2 )
 {
-	IPStringArray szAddress;
-	ULONG		ulIdx;
-	ULONG		ulBits;
-	ULONG 		ulBits2 = 0;
-
-	// Let's just use the master server buffer! It gets cleared again when we need it anyway!
-	g_MasterServerBuffer.Clear();
-
-	if ( bBroadcasting == false )
-	{
-		// First, check to see if we've been queried by this address recently.
-		if ( g_lStoredQueryIPHead != g_lStoredQueryIPTail )
-		{
-			ulIdx = g_lStoredQueryIPHead;
-			while ( ulIdx != (ULONG)g_lStoredQueryIPTail )
-			{
-				// Check to see if this IP exists in our stored query IP list. If it does, then
-				// ignore it, since it queried us less than 10 seconds ago.
-				if ( Address.CompareNoPort( g_StoredQueryIPs[ulIdx].Address ))
-				{
-					// Write our header.
-					g_MasterServerBuffer.ByteStream.WriteLong( SERVER_LAUNCHER_IGNORING );
-
-					// Send the time the launcher sent to us.
-					g_MasterServerBuffer.ByteStream.WriteLong( ulTime );
-
-					// Send the packet.
-	//				NETWORK_LaunchPacket( &g_MasterServerBuffer, Address, true );
-					NETWORK_LaunchPacket( &g_MasterServerBuffer, Address );
-
-					if ( sv_showlauncherqueries )
-						Printf( "Ignored IP launcher challenge.\n" );
-
-					// Nothing more to do here.
-					return;
-				}
-
-				ulIdx++;
-				ulIdx = ulIdx % MAX_STORED_QUERY_IPS;
-			}
-		}
-	
-		// Now, check to see if this IP has been banend from this server.
-		szAddress.SetFrom ( Address );
-		if ( SERVERBAN_IsIPBanned( szAddress ))
-		{
-			// Write our header.
-			g_MasterServerBuffer.ByteStream.WriteLong( SERVER_LAUNCHER_BANNED );
-
-			// Send the time the launcher sent to us.
-			g_MasterServerBuffer.ByteStream.WriteLong( ulTime );
-
-			// Send the packet.
-			NETWORK_LaunchPacket( &g_MasterServerBuffer, Address );
-
-			if ( sv_showlauncherqueries )
-				Printf( "Denied BANNED IP launcher challenge.\n" );
-
-			// Nothing more to do here.
-			return;
-		}
-
-		// This IP didn't exist in the list. and it wasn't banned. 
-		// So, add it, and keep it there for 10 seconds.
-		g_StoredQueryIPs[g_lStoredQueryIPTail].Address = Address;
-		g_StoredQueryIPs[g_lStoredQueryIPTail].lNextAllowedGametic = gametic + ( TICRATE * ( sv_queryignoretime ));
-
-		g_lStoredQueryIPTail++;
-		g_lStoredQueryIPTail = g_lStoredQueryIPTail % MAX_STORED_QUERY_IPS;
-		if ( g_lStoredQueryIPTail == g_lStoredQueryIPHead )
-			Printf( "SERVER_MASTER_SendServerInfo: WARNING! g_lStoredQueryIPTail == g_lStoredQueryIPHead\n" );
-	}
+	ulBits2 = 0;
 
 	// Send the information about the data that will be sent.
-	ulBits = ulFlags;
+	ULONG ulBits = ulFlags;
 
 	// [BB] Remove all unknown flags from our answer.
 	ulBits &= SQF_ALL;
@@ -882,6 +869,46 @@ void SERVER_MASTER_SendServerInfo( NETADDRESS_s Address, ULONG ulTime, ULONG ulF
 			ulBits &= ~SQF_EXTENDED_INFO;
 	}
 
+	return ulBits;
+}
+
+//*****************************************************************************
+//
+// Stores the contents of g_MasterServerBuffer as the next packet of the response.
+//
+static void server_master_StorePacket( CACHEDRESPONSE_s &Response, const LONG lTimeOffset )
+{
+	CACHEDPACKET_s	Packet;
+	const ULONG		ulSize = g_MasterServerBuffer.CalcSize();
+
+	Packet.bHasTime = ( lTimeOffset >= 0 );
+	Packet.ulPrefixSize = Packet.bHasTime ? lTimeOffset : 0;
+	memcpy( Packet.abPrefix, g_MasterServerBuffer.pbData, Packet.ulPrefixSize );
+
+	const ULONG ulBodyStart = Packet.bHasTime ? ( Packet.ulPrefixSize + 4 ) : 0;
+	Packet.pBody = SharedPacketSegment::Create( g_MasterServerBuffer.pbData + ulBodyStart, ulSize - ulBodyStart );
+	Response.Packets.Push( Packet );
+}
+
+//*****************************************************************************
+//
+static void server_master_ReleaseResponse( CACHEDRESPONSE_s &Response )
+{
+	for ( unsigned int i = 0; i < Response.Packets.Size( ); ++i )
+		Response.Packets[i].pBody->RemoveReference( );
+
+	Response.Packets.Clear( );
+}
+
+//*****************************************************************************
+//
+// Builds the response described by the flags of Response.
+//
+static void server_master_BuildResponse( CACHEDRESPONSE_s &Response )
+{
+	const ULONG ulBits = Response.ulFlags;
+	const ULONG ulBits2 = Response.ulFlags2;
+	const bool bSendSegmentedResponse = Response.bSegmented;
 	const ULONG flags[] = { ulBits, ulBits2 }; // [SB] The bits for each field set we'll be sending.
 	ULONG ulCurrentSetNum = 0; // [SB] Current field set. 0 -> SQF_, 1 -> SQF2_
 
@@ -889,6 +916,7 @@ void SERVER_MASTER_SendServerInfo( NETADDRESS_s Address, ULONG ulTime, ULONG ulF
 	bool bEmptySegment = true;
 	FillInData fillIn;
 	ULONG ulLastFieldSet = -1;
+	LONG lTimeOffset = -1;
 
 	const LauncherResponseContext ctx
 	{ 
@@ -897,10 +925,12 @@ void SERVER_MASTER_SendServerInfo( NETADDRESS_s Address, ULONG ulTime, ULONG ulF
 		bSendSegmentedResponse
 	};
 
+	g_MasterServerBuffer.Clear();
+
 	// [SB] Prepare the initial segmented packet.
 	if ( bSendSegmentedResponse )
 	{
-		server_master_PrepareSegment( ulSegmentNumber, ulTime, fillIn );
+		server_master_PrepareSegment( ulSegmentNumber, fillIn );
 	}
 	// [SB] Send the single packet response.
 	else
@@ -908,8 +938,9 @@ void SERVER_MASTER_SendServerInfo( NETADDRESS_s Address, ULONG ulTime, ULONG ulF
 		// Write our header.
 		g_MasterServerBuffer.ByteStream.WriteLong( SERVER_LAUNCHER_CHALLENGE );
 
-		// Send the time the launcher sent to us.
-		g_MasterServerBuffer.ByteStream.WriteLong( ulTime );
+		// The time the launcher sent to us, written when the response is sent.
+		lTimeOffset = g_MasterServerBuffer.CalcSize();
+		g_MasterServerBuffer.ByteStream.WriteLong( 0 );
 
 		// Send our version. [K6] ...with OS
 		g_MasterServerBuffer.ByteStream.WriteString( g_VersionWithOS.GetChars() );
@@ -945,8 +976,8 @@ void SERVER_MASTER_SendServerInfo( NETADDRESS_s Address, ULONG ulTime, ULONG ulF
 					// [SB] If it's too big, flush this segment and start a new one.
 					if ( ulSegmentSize + ulFieldSize > static_cast<ULONG>( sv_maxpacketsize ) )
 					{
-						server_master_FlushSegment( Address, fillIn, ulSegmentNumber, false );
-						server_master_PrepareSegment( ulSegmentNumber, ulTime, fillIn );
+						server_master_FlushSegment( Response, fillIn, ulSegmentNumber, false );
+						server_master_PrepareSegment( ulSegmentNumber, fillIn );
 						ulLastFieldSet = -1;
 					}
 				}
@@ -1000,14 +1031,224 @@ void SERVER_MASTER_SendServerInfo( NETADDRESS_s Address, ULONG ulTime, ULONG ulF
 
 	if ( bSendSegmentedResponse )
 	{
-		server_master_FlushSegment( Address, fillIn, ulSegmentNumber, true );
+		server_master_FlushSegment( Response, fillIn, ulSegmentNumber, true );
 	} 
 	else
 	{
-		NETWORK_LaunchPacket( &g_MasterServerBuffer, Address );
+		server_master_StorePacket( Response, lTimeOffset );
 	}
 }
 
+
+//*****************************************************************************
+//
+// A cheap summary of who is playing. Joining, leaving and switching teams changes the
+// player count and list of the responses, so they must not be reused across that.
+//
+static ULONG server_master_GetPlayerSignature( void )
+{
+	ULONG ulSignature = 0;
+
+	for ( ULONG ulIdx = 0; ulIdx < MAXPLAYERS; ulIdx++ )
+	{
+		ULONG ulState = 0;
+
+		if ( playeringame[ulIdx] )
+			ulState = 1 + ( players[ulIdx].bSpectating ? 1 : 0 ) + ( players[ulIdx].bOnTeam ? ( 2 + players[ulIdx].Team ) : 0 );
+
+		ulSignature = ( ulSignature * 31 ) + ulState;
+	}
+
+	return ulSignature;
+}
+
+//*****************************************************************************
+//
+// Returns the response to the given (corrected) flags, reusing a recent one if possible.
+//
+static const CACHEDRESPONSE_s &server_master_GetResponse( const ULONG ulBits, const ULONG ulBits2, const bool bSegmented )
+{
+	const ULONG ulPlayerSignature = server_master_GetPlayerSignature( );
+
+	if ( ulPlayerSignature != g_ulCachedPlayerSignature )
+	{
+		SERVER_MASTER_InvalidateServerInfo( );
+		g_ulCachedPlayerSignature = ulPlayerSignature;
+	}
+
+	CACHEDRESPONSE_s *pResponse = NULL;
+
+	for ( unsigned int i = 0; i < countof( g_CachedResponses ); ++i )
+	{
+		CACHEDRESPONSE_s &Cached = g_CachedResponses[i];
+
+		if (( Cached.Packets.Size( ) == 0 ) || ( Cached.ulFlags != ulBits ) || ( Cached.ulFlags2 != ulBits2 ) || ( Cached.bSegmented != bSegmented ))
+			continue;
+
+		if (( gametic >= Cached.lBuildTic ) && ( gametic < Cached.lBuildTic + sv_queryresponsecachetics ))
+			return Cached;
+
+		// Too old, rebuild it in place.
+		pResponse = &Cached;
+		break;
+	}
+
+	if ( pResponse == NULL )
+	{
+		pResponse = &g_CachedResponses[g_ulNextCachedResponse];
+		g_ulNextCachedResponse = ( g_ulNextCachedResponse + 1 ) % countof( g_CachedResponses );
+	}
+
+	server_master_ReleaseResponse( *pResponse );
+	pResponse->ulFlags = ulBits;
+	pResponse->ulFlags2 = ulBits2;
+	pResponse->bSegmented = bSegmented;
+	pResponse->lBuildTic = gametic;
+	server_master_BuildResponse( *pResponse );
+
+	return *pResponse;
+}
+
+//*****************************************************************************
+//
+static void server_master_AnswerQuery( NETADDRESS_s Address, ULONG ulTime, ULONG ulFlags, ULONG ulFlags2, bool bSendSegmentedResponse )
+{
+	static PacketSegmentList	Body;
+	ULONG						ulBits2;
+
+	const ULONG ulBits = server_master_CorrectFlags( ulFlags, ulFlags2, bSendSegmentedResponse, ulBits2 );
+	const CACHEDRESPONSE_s &Response = server_master_GetResponse( ulBits, ulBits2, bSendSegmentedResponse );
+
+	for ( unsigned int i = 0; i < Response.Packets.Size( ); ++i )
+	{
+		const CACHEDPACKET_s &Packet = Response.Packets[i];
+
+		g_MasterServerBuffer.Clear();
+		g_MasterServerBuffer.ByteStream.WriteBuffer( Packet.abPrefix, Packet.ulPrefixSize );
+
+		// Send the time the launcher sent to us.
+		if ( Packet.bHasTime )
+			g_MasterServerBuffer.ByteStream.WriteLong( ulTime );
+
+		const ULONG ulBodyOffset = g_MasterServerBuffer.CalcSize();
+		g_MasterServerBuffer.ByteStream.WriteBuffer( Packet.pBody->GetData( ), Packet.pBody->GetSize( ));
+
+		// The body's Huffman codes are reused instead of encoding it again.
+		Body.Clear( );
+		Body.Add( 0, Packet.pBody );
+		NETWORK_LaunchPacket( &g_MasterServerBuffer, Address, &Body, ulBodyOffset );
+	}
+
+	Body.Clear( );
+
+	// Without caching, the response is only valid for this query.
+	if ( sv_queryresponsecachetics == 0 )
+		SERVER_MASTER_InvalidateServerInfo( );
+}
+
+//*****************************************************************************
+//
+void SERVER_MASTER_SendServerInfo( NETADDRESS_s Address, ULONG ulTime, ULONG ulFlags, ULONG ulFlags2, bool bSendSegmentedResponse, bool bBroadcasting )
+{
+	IPStringArray szAddress;
+
+	// Let's just use the master server buffer! It gets cleared again when we need it anyway!
+	g_MasterServerBuffer.Clear();
+
+	if ( bBroadcasting == false )
+	{
+		// First, check to see if we've been queried by this address recently. If so, then
+		// ignore it, since it queried us less than sv_queryignoretime seconds ago.
+		if ( g_StoredQueryIPs.addressInQueue( Address ))
+		{
+			// Write our header.
+			g_MasterServerBuffer.ByteStream.WriteLong( SERVER_LAUNCHER_IGNORING );
+
+			// Send the time the launcher sent to us.
+			g_MasterServerBuffer.ByteStream.WriteLong( ulTime );
+
+			// Send the packet.
+			NETWORK_LaunchPacket( &g_MasterServerBuffer, Address );
+
+			if ( sv_showlauncherqueries )
+				Printf( "Ignored IP launcher challenge.\n" );
+
+			// Nothing more to do here.
+			return;
+		}
+
+		// Now, check to see if this IP has been banend from this server.
+		szAddress.SetFrom ( Address );
+		if ( SERVERBAN_IsIPBanned( szAddress ))
+		{
+			// Write our header.
+			g_MasterServerBuffer.ByteStream.WriteLong( SERVER_LAUNCHER_BANNED );
+
+			// Send the time the launcher sent to us.
+			g_MasterServerBuffer.ByteStream.WriteLong( ulTime );
+
+			// Send the packet.
+			NETWORK_LaunchPacket( &g_MasterServerBuffer, Address );
+
+			if ( sv_showlauncherqueries )
+				Printf( "Denied BANNED IP launcher challenge.\n" );
+
+			// Nothing more to do here.
+			return;
+		}
+
+		// This IP didn't exist in the list. and it wasn't banned. 
+		// So, add it, and keep it there for sv_queryignoretime seconds.
+		if ( g_StoredQueryIPs.isFull( ))
+			Printf( "SERVER_MASTER_SendServerInfo: WARNING! The query IP queue is full.\n" );
+
+		g_StoredQueryIPs.setEntryLength( TICRATE * sv_queryignoretime );
+		g_StoredQueryIPs.addAddress( Address, gametic );
+
+		// Building and sending the response is left for when the packets of this tic are sent.
+		if ( g_PendingQueries.Size( ) >= MAX_PENDING_QUERIES )
+			return;
+
+		PENDINGQUERY_s Query;
+		Query.Address = Address;
+		Query.ulTime = ulTime;
+		Query.ulFlags = ulFlags;
+		Query.ulFlags2 = ulFlags2;
+		Query.bSegmented = bSendSegmentedResponse;
+		g_PendingQueries.Push( Query );
+		return;
+	}
+
+	server_master_AnswerQuery( Address, ulTime, ulFlags, ulFlags2, bSendSegmentedResponse );
+}
+
+
+//*****************************************************************************
+//
+// Answers the queries received this tic. This is called while the packets of the tic
+// are collected, so that the responses are encoded and sent along with them.
+//
+void SERVER_MASTER_SendPendingServerInfo( void )
+{
+	for ( unsigned int i = 0; i < g_PendingQueries.Size( ); ++i )
+	{
+		const PENDINGQUERY_s &Query = g_PendingQueries[i];
+		server_master_AnswerQuery( Query.Address, Query.ulTime, Query.ulFlags, Query.ulFlags2, Query.bSegmented );
+	}
+
+	g_PendingQueries.Clear( );
+}
+
+//*****************************************************************************
+//
+// Makes sure the next query builds a new response, e.g. after the map or a setting changed.
+//
+void SERVER_MASTER_InvalidateServerInfo( void )
+{
+	for ( unsigned int i = 0; i < countof( g_CachedResponses ); ++i )
+		server_master_ReleaseResponse( g_CachedResponses[i] );
+}
+
 //*****************************************************************************
 //
 const char *SERVER_MASTER_GetGameName( void )
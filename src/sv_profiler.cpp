@@ -0,0 +1,544 @@
+//-----------------------------------------------------------------------------
+//
+// Zandronum Source
+// Copyright (C) 2026 Zandronum Development Team
+// All rights reserved.
+//
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the Skulltag Development Team nor the names of its
+//    contributors may be used to endorse or promote products derived from this
+//    software without specific prior written permission.
+// 4. Redistributions in any form must be accompanied by information on how to
+//    obtain complete source code for the software and any accompanying
+//    software that uses the software. The source code must either be included
+//    in the distribution or be available for no more than the cost of
+//    distribution plus a nominal fee, and must be freely redistributable
+//    under reasonable conditions. For an executable file, complete source
+//    code means the source code for all modules it contains. It does not
+//    include source code for modules or files that typically accompany the
+//    major components of the operating system on which the executable file
+//    runs.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+//
+//
+//
+// Filename: sv_profiler.cpp
+//
+// Description: Measures where the time of the server's tics goes
+//
+// While sv_profiler is on, the wall time of every phase of SERVER_Tick, and
+// the time every thinker class and ACS script took during the tic, are kept
+// for the last minute of tics. sv_profilestats summarizes them, also over
+// RCON, and sv_profiledump writes them as a trace that can be opened with
+// Chrome's about:tracing or Perfetto.
+//
+//-----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <chrono>
+#include "c_cvars.h"
+#include "c_dispatch.h"
+#include "cmdlib.h"
+#include "doomstat.h"
+#include "dobject.h"
+#include "network.h"
+#include "p_acs.h"
+#include "sv_profiler.h"
+#include "templates.h"
+
+//*****************************************************************************
+//	DEFINES
+
+// How many tics are kept, one minute.
+#define	PROFILER_NUMTICS		( 60 * TICRATE )
+
+// How many thinker classes and scripts are kept for all of these tics together.
+#define	PROFILER_NUMSAMPLES		0x20000
+
+// How often the phases may be entered in one tic.
+#define	PROFILER_MAXSEGMENTS	32
+
+// How many of the most expensive thinker classes and scripts sv_profilestats lists.
+#define	PROFILER_NUMTOPSAMPLES	10
+
+//*****************************************************************************
+//	STRUCTURES
+
+// A phase that was run during a tic. Times are in microseconds since the start of the tic.
+struct PROFILERSEGMENT_s
+{
+	PROFILERPHASE_e	Phase;
+	double			dStart;
+	double			dDuration;
+};
+
+// The time a thinker class or script took during a tic, in microseconds.
+struct PROFILERSAMPLE_s
+{
+	// The thinker class, or NULL for a script.
+	const PClass	*pType;
+	int				Script;
+	ULONG			ulCount;
+	double			dTime;
+
+	PROFILERSAMPLE_s( ) : pType( NULL ), Script( 0 ), ulCount( 0 ), dTime( 0 ) { }
+};
+
+struct PROFILERTIC_s
+{
+	int					Gametic;
+
+	// Nanoseconds since the profiler started.
+	SQWORD				qwStart;
+
+	// Microseconds from the start to the end of the tic.
+	double				dDuration;
+
+	PROFILERSEGMENT_s	aSegments[PROFILER_MAXSEGMENTS];
+	ULONG				ulNumSegments;
+
+	// The samples of this tic are the ones counted from here on.
+	QWORD				qwFirstSample;
+	ULONG				ulNumSamples;
+};
+
+//*****************************************************************************
+//	PROTOTYPES
+
+static	void				serverprofiler_EndSegment( SQWORD qwNow );
+static	void				serverprofiler_AddSample( const PROFILERSAMPLE_s &Sample );
+static	bool				serverprofiler_SamplesAreKept( const PROFILERTIC_s &Tic );
+static	const PROFILERTIC_s	&serverprofiler_GetTic( ULONG ulIdx );
+static	FString				serverprofiler_GetSampleName( const PROFILERSAMPLE_s &Sample );
+static	void				serverprofiler_PrintTopSamples( const char *pszTitle, TMap<int, PROFILERSAMPLE_s> &Totals, ULONG ulNumTics );
+static	void				serverprofiler_WriteJSONString( FILE *pFile, const char *pszString );
+
+//*****************************************************************************
+//	VARIABLES
+
+static	const char			*g_apszPhaseNames[NUM_PROFILERPHASES] =
+{
+	"SERVER_GetPackets",
+	"UNLAGGED_Tick",
+	"G_Ticker",
+	"SERVER_CheckTimeouts",
+	"SERVER_WriteCommands",
+	"SERVER_SendOutPackets",
+	"SERVERDEMO_Tick",
+	"SavedPackets.Tick",
+	"NETWORK_FlushPacketBatch",
+	"Master server",
+	"SERVER_RCON_Tick",
+	"SERVERBAN_Tick",
+	"Other",
+};
+
+// The tics that were profiled, g_ulNumTics counts all of them.
+static	PROFILERTIC_s		g_aTics[PROFILER_NUMTICS];
+static	ULONG				g_ulNumTics = 0;
+
+// The samples of these tics, g_qwNumSamples counts all of them.
+static	PROFILERSAMPLE_s	g_aSamples[PROFILER_NUMSAMPLES];
+static	QWORD				g_qwNumSamples = 0;
+
+// The tic that is being profiled.
+static	bool				g_bTicActive = false;
+static	bool				g_bInSegment = false;
+static	PROFILERTIC_s		g_CurrentTic;
+
+// The thinker classes and scripts of the current tic, keyed by the name index of the class
+// and the script number.
+static	TMap<int, PROFILERSAMPLE_s>	g_ThinkerTimes;
+static	TMap<int, PROFILERSAMPLE_s>	g_ScriptTimes;
+
+static	const std::chrono::steady_clock::time_point	g_StartTime = std::chrono::steady_clock::now( );
+
+CVAR( Bool, sv_profiler, false, 0 )
+
+//*****************************************************************************
+//	FUNCTIONS
+
+void SERVERPROFILER_BeginTic( void )
+{
+	g_bTicActive = sv_profiler && ( NETWORK_GetState( ) == NETSTATE_SERVER );
+	if ( g_bTicActive == false )
+		return;
+
+	g_CurrentTic.Gametic = gametic;
+	g_CurrentTic.qwStart = SERVERPROFILER_Now( );
+	g_CurrentTic.ulNumSegments = 0;
+	g_bInSegment = false;
+}
+
+//*****************************************************************************
+//
+// Ends the phase that was running, if any.
+void SERVERPROFILER_BeginPhase( PROFILERPHASE_e Phase )
+{
+	if ( g_bTicActive == false )
+		return;
+
+	const SQWORD qwNow = SERVERPROFILER_Now( );
+	serverprofiler_EndSegment( qwNow );
+
+	if ( g_CurrentTic.ulNumSegments < PROFILER_MAXSEGMENTS )
+	{
+		PROFILERSEGMENT_s &Segment = g_CurrentTic.aSegments[g_CurrentTic.ulNumSegments];
+		Segment.Phase = Phase;
+		Segment.dStart = ( qwNow - g_CurrentTic.qwStart ) / 1000.0;
+		g_bInSegment = true;
+	}
+}
+
+//*****************************************************************************
+//
+void SERVERPROFILER_EndTic( void )
+{
+	if ( g_bTicActive == false )
+		return;
+
+	const SQWORD qwNow = SERVERPROFILER_Now( );
+	serverprofiler_EndSegment( qwNow );
+	g_CurrentTic.dDuration = ( qwNow - g_CurrentTic.qwStart ) / 1000.0;
+
+	// Move the thinker classes and scripts of this tic to the samples.
+	g_CurrentTic.qwFirstSample = g_qwNumSamples;
+	{
+		TMap<int, PROFILERSAMPLE_s>::Iterator it ( g_ThinkerTimes );
+		TMap<int, PROFILERSAMPLE_s>::Pair *pair;
+		while ( it.NextPair( pair ))
+			serverprofiler_AddSample( pair->Value );
+	}
+	{
+		TMap<int, PROFILERSAMPLE_s>::Iterator it ( g_ScriptTimes );
+		TMap<int, PROFILERSAMPLE_s>::Pair *pair;
+		while ( it.NextPair( pair ))
+			serverprofiler_AddSample( pair->Value );
+	}
+	g_CurrentTic.ulNumSamples = static_cast<ULONG>( g_qwNumSamples - g_CurrentTic.qwFirstSample );
+	g_ThinkerTimes.Clear( );
+	g_ScriptTimes.Clear( );
+
+	g_aTics[g_ulNumTics % PROFILER_NUMTICS] = g_CurrentTic;
+	g_ulNumTics++;
+	g_bTicActive = false;
+}
+
+//*****************************************************************************
+//
+bool SERVERPROFILER_IsActive( void )
+{
+	return ( g_bTicActive );
+}
+
+//*****************************************************************************
+//
+// Nanoseconds since the profiler started.
+SQWORD SERVERPROFILER_Now( void )
+{
+	return ( std::chrono::duration_cast<std::chrono::nanoseconds>( std::chrono::steady_clock::now( ) - g_StartTime ).count( ));
+}
+
+//*****************************************************************************
+//
+// qwStart is the value of SERVERPROFILER_Now before the thinker ticked.
+void SERVERPROFILER_AddThinkerTime( const PClass *pType, SQWORD qwStart )
+{
+	if ( g_bTicActive == false )
+		return;
+
+	PROFILERSAMPLE_s &Sample = g_ThinkerTimes[pType->TypeName.GetIndex( )];
+	Sample.pType = pType;
+	Sample.Script = 0;
+	Sample.ulCount++;
+	Sample.dTime += ( SERVERPROFILER_Now( ) - qwStart ) / 1000.0;
+}
+
+//*****************************************************************************
+//
+// qwStart is the value of SERVERPROFILER_Now before the script ran.
+void SERVERPROFILER_AddACSScriptTime( int Script, SQWORD qwStart )
+{
+	if ( g_bTicActive == false )
+		return;
+
+	PROFILERSAMPLE_s &Sample = g_ScriptTimes[Script];
+	Sample.pType = NULL;
+	Sample.Script = Script;
+	Sample.ulCount++;
+	Sample.dTime += ( SERVERPROFILER_Now( ) - qwStart ) / 1000.0;
+}
+
+//*****************************************************************************
+//*****************************************************************************
+//
+static void serverprofiler_EndSegment( SQWORD qwNow )
+{
+	if ( g_bInSegment == false )
+		return;
+
+	PROFILERSEGMENT_s &Segment = g_CurrentTic.aSegments[g_CurrentTic.ulNumSegments++];
+	Segment.dDuration = ( qwNow - g_CurrentTic.qwStart ) / 1000.0 - Segment.dStart;
+	g_bInSegment = false;
+}
+
+//*****************************************************************************
+//
+static void serverprofiler_AddSample( const PROFILERSAMPLE_s &Sample )
+{
+	g_aSamples[g_qwNumSamples % PROFILER_NUMSAMPLES] = Sample;
+	g_qwNumSamples++;
+}
+
+//*****************************************************************************
+//
+// Very busy tics may have more samples than all tics can keep together.
+static bool serverprofiler_SamplesAreKept( const PROFILERTIC_s &Tic )
+{
+	return ( g_qwNumSamples - Tic.qwFirstSample <= PROFILER_NUMSAMPLES );
+}
+
+//*****************************************************************************
+//
+// Returns the ulIdx-th oldest of the kept tics.
+static const PROFILERTIC_s &serverprofiler_GetTic( ULONG ulIdx )
+{
+	const ULONG ulNumKept = MIN<ULONG>( g_ulNumTics, PROFILER_NUMTICS );
+	return ( g_aTics[( g_ulNumTics - ulNumKept + ulIdx ) % PROFILER_NUMTICS] );
+}
+
+//*****************************************************************************
+//
+static FString serverprofiler_GetSampleName( const PROFILERSAMPLE_s &Sample )
+{
+	if ( Sample.pType != NULL )
+		return ( Sample.pType->TypeName.GetChars( ));
+
+	return ( FBehavior::RepresentScript( Sample.Script ));
+}
+
+//*****************************************************************************
+//
+static void serverprofiler_PrintTopSamples( const char *pszTitle, TMap<int, PROFILERSAMPLE_s> &Totals, ULONG ulNumTics )
+{
+	TArray<PROFILERSAMPLE_s> samples;
+	TMap<int, PROFILERSAMPLE_s>::Iterator it ( Totals );
+	TMap<int, PROFILERSAMPLE_s>::Pair *pair;
+
+	while ( it.NextPair( pair ))
+		samples.Push( pair->Value );
+
+	if ( samples.Size( ) == 0 )
+		return;
+
+	std::sort( &samples[0], &samples[0] + samples.Size( ), []( const PROFILERSAMPLE_s &a, const PROFILERSAMPLE_s &b ) { return a.dTime > b.dTime; } );
+
+	Printf( "%s:\n", pszTitle );
+	for ( unsigned int i = 0; ( i < samples.Size( )) && ( i < PROFILER_NUMTOPSAMPLES ); ++i )
+	{
+		Printf( "  %-32s %8.3f ms per tic, %lu runs\n", serverprofiler_GetSampleName( samples[i] ).GetChars( ),
+			samples[i].dTime / 1000.0 / ulNumTics, samples[i].ulCount );
+	}
+}
+
+//*****************************************************************************
+//
+static void serverprofiler_WriteJSONString( FILE *pFile, const char *pszString )
+{
+	fputc( '"', pFile );
+	for ( ; *pszString; ++pszString )
+	{
+		if (( *pszString == '"' ) || ( *pszString == '\\' ))
+			fprintf( pFile, "\\%c", *pszString );
+		else if ( static_cast<unsigned char>( *pszString ) < 0x20 )
+			fprintf( pFile, "\\u%04x", static_cast<unsigned char>( *pszString ));
+		else
+			fputc( *pszString, pFile );
+	}
+	fputc( '"', pFile );
+}
+
+//*****************************************************************************
+//	CONSOLE COMMANDS
+
+// Prints the percentiles of the tic times and what took the most time.
+CCMD( sv_profilestats )
+{
+	if ( NETWORK_GetState( ) != NETSTATE_SERVER )
+		return;
+
+	if (( argv.argc( ) >= 2 ) && ( stricmp( argv[1], "reset" ) == 0 ))
+	{
+		g_ulNumTics = 0;
+		g_qwNumSamples = 0;
+		Printf( "Profiler statistics reset.\n" );
+		return;
+	}
+
+	const ULONG ulNumTics = MIN<ULONG>( g_ulNumTics, PROFILER_NUMTICS );
+	if ( ulNumTics == 0 )
+	{
+		Printf( "No tics were profiled%s.\n", sv_profiler ? "" : ", set sv_profiler to true to profile them" );
+		return;
+	}
+
+	TArray<double> durations;
+	double adPhaseTotal[NUM_PROFILERPHASES] = { 0 };
+	double adPhaseMax[NUM_PROFILERPHASES] = { 0 };
+	TMap<int, PROFILERSAMPLE_s> thinkerTotals;
+	TMap<int, PROFILERSAMPLE_s> scriptTotals;
+	ULONG ulSampledTics = 0;
+	ULONG ulNumOverBudget = 0;
+	const double dBudget = 1000000.0 / TICRATE;
+
+	durations.Reserve( ulNumTics );
+	for ( ULONG ulIdx = 0; ulIdx < ulNumTics; ++ulIdx )
+	{
+		const PROFILERTIC_s &Tic = serverprofiler_GetTic( ulIdx );
+		double adPhaseTime[NUM_PROFILERPHASES] = { 0 };
+
+		durations[ulIdx] = Tic.dDuration;
+		if ( Tic.dDuration > dBudget )
+			ulNumOverBudget++;
+
+		for ( ULONG ulSegment = 0; ulSegment < Tic.ulNumSegments; ++ulSegment )
+			adPhaseTime[Tic.aSegments[ulSegment].Phase] += Tic.aSegments[ulSegment].dDuration;
+
+		for ( ULONG ulPhase = 0; ulPhase < NUM_PROFILERPHASES; ++ulPhase )
+		{
+			adPhaseTotal[ulPhase] += adPhaseTime[ulPhase];
+			adPhaseMax[ulPhase] = MAX( adPhaseMax[ulPhase], adPhaseTime[ulPhase] );
+		}
+
+		if ( serverprofiler_SamplesAreKept( Tic ) == false )
+			continue;
+
+		ulSampledTics++;
+		for ( ULONG ulSample = 0; ulSample < Tic.ulNumSamples; ++ulSample )
+		{
+			const PROFILERSAMPLE_s &Sample = g_aSamples[( Tic.qwFirstSample + ulSample ) % PROFILER_NUMSAMPLES];
+			PROFILERSAMPLE_s &Total = ( Sample.pType != NULL ) ? thinkerTotals[Sample.pType->TypeName.GetIndex( )] : scriptTotals[Sample.Script];
+
+			Total.pType = Sample.pType;
+			Total.Script = Sample.Script;
+			Total.ulCount += Sample.ulCount;
+			Total.dTime += Sample.dTime;
+		}
+	}
+
+	std::sort( &durations[0], &durations[0] + durations.Size( ));
+	const auto percentile = [&]( double dFraction ) { return durations[MIN<ULONG>( static_cast<ULONG>( dFraction * ulNumTics ), ulNumTics - 1 )] / 1000.0; };
+
+	Printf( "Tic times of the last %lu tics: 50%% %.3f ms, 90%% %.3f ms, 99%% %.3f ms, 99.9%% %.3f ms, max %.3f ms\n",
+		ulNumTics, percentile( 0.5 ), percentile( 0.9 ), percentile( 0.99 ), percentile( 0.999 ), durations[ulNumTics - 1] / 1000.0 );
+	Printf( "%lu tics took longer than %.1f ms.\n", ulNumOverBudget, dBudget / 1000.0 );
+
+	Printf( "%-26s %10s %10s\n", "Phase", "avg (ms)", "max (ms)" );
+	for ( ULONG ulPhase = 0; ulPhase < NUM_PROFILERPHASES; ++ulPhase )
+		Printf( "%-26s %10.3f %10.3f\n", g_apszPhaseNames[ulPhase], adPhaseTotal[ulPhase] / 1000.0 / ulNumTics, adPhaseMax[ulPhase] / 1000.0 );
+
+	if ( ulSampledTics > 0 )
+	{
+		serverprofiler_PrintTopSamples( "Thinker classes (including what they run)", thinkerTotals, ulSampledTics );
+		serverprofiler_PrintTopSamples( "ACS scripts", scriptTotals, ulSampledTics );
+	}
+}
+
+//*****************************************************************************
+//
+// Writes the profiled tics in the Trace Event Format. The phases are shown as slices
+// of their tics. The thinker classes and scripts are aggregated per tic, so they are
+// shown one after the other from the start of G_Ticker, on tracks of their own.
+CCMD( sv_profiledump )
+{
+	if ( NETWORK_GetState( ) != NETSTATE_SERVER )
+		return;
+
+	if ( argv.argc( ) < 2 )
+	{
+		Printf( "Usage: sv_profiledump <filename>\n" );
+		return;
+	}
+
+	FString fileName = argv[1];
+	FixPathSeperator( fileName );
+	DefaultExtension( fileName, ".json" );
+
+	FILE *pFile = fopen( fileName.GetChars( ), "w" );
+	if ( pFile == NULL )
+	{
+		Printf( "Couldn't open \"%s\" for writing.\n", fileName.GetChars( ));
+		return;
+	}
+
+	const ULONG ulNumTics = MIN<ULONG>( g_ulNumTics, PROFILER_NUMTICS );
+
+	fprintf( pFile, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n" );
+	fprintf( pFile, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"Tics\"}},\n" );
+	fprintf( pFile, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":2,\"args\":{\"name\":\"Thinker classes\"}},\n" );
+	fprintf( pFile, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":3,\"args\":{\"name\":\"ACS scripts\"}}" );
+
+	for ( ULONG ulIdx = 0; ulIdx < ulNumTics; ++ulIdx )
+	{
+		const PROFILERTIC_s &Tic = serverprofiler_GetTic( ulIdx );
+		const double dTicStart = Tic.qwStart / 1000.0;
+		double dTickerStart = dTicStart;
+
+		fprintf( pFile, ",\n{\"name\":\"Tic %d\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":%.3f,\"dur\":%.3f}", Tic.Gametic, dTicStart, Tic.dDuration );
+
+		for ( ULONG ulSegment = 0; ulSegment < Tic.ulNumSegments; ++ulSegment )
+		{
+			const PROFILERSEGMENT_s &Segment = Tic.aSegments[ulSegment];
+
+			if ( Segment.Phase == PROFILERPHASE_TICKER )
+				dTickerStart = dTicStart + Segment.dStart;
+
+			fprintf( pFile, ",\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":%.3f,\"dur\":%.3f}",
+				g_apszPhaseNames[Segment.Phase], dTicStart + Segment.dStart, Segment.dDuration );
+		}
+
+		if ( serverprofiler_SamplesAreKept( Tic ) == false )
+			continue;
+
+		double dThinkerTime = dTickerStart;
+		double dScriptTime = dTickerStart;
+		for ( ULONG ulSample = 0; ulSample < Tic.ulNumSamples; ++ulSample )
+		{
+			const PROFILERSAMPLE_s &Sample = g_aSamples[( Tic.qwFirstSample + ulSample ) % PROFILER_NUMSAMPLES];
+			double &dTime = ( Sample.pType != NULL ) ? dThinkerTime : dScriptTime;
+
+			fprintf( pFile, ",\n{\"name\":" );
+			serverprofiler_WriteJSONString( pFile, serverprofiler_GetSampleName( Sample ).GetChars( ));
+			fprintf( pFile, ",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"count\":%lu}}",
+				( Sample.pType != NULL ) ? 2 : 3, dTime, Sample.dTime, Sample.ulCount );
+			dTime += Sample.dTime;
+		}
+	}
+
+	fprintf( pFile, "\n]}\n" );
+
+	if ( fclose( pFile ) == 0 )
+		Printf( "Wrote %lu tics to \"%s\".\n", ulNumTics, fileName.GetChars( ));
+	else
+		Printf( "Couldn't write \"%s\".\n", fileName.GetChars( ));
+}
@@ -0,0 +1,92 @@
+//-----------------------------------------------------------------------------
+//
+// Zandronum Source
+// Copyright (C) 2026 Zandronum Development Team
+// All rights reserved.
+//
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the Skulltag Development Team nor the names of its
+//    contributors may be used to endorse or promote products derived from this
+//    software without specific prior written permission.
+// 4. Redistributions in any form must be accompanied by information on how to
+//    obtain complete source code for the software and any accompanying
+//    software that uses the software. The source code must either be included
+//    in the distribution or be available for no more than the cost of
+//    distribution plus a nominal fee, and must be freely redistributable
+//    under reasonable conditions. For an executable file, complete source
+//    code means the source code for all modules it contains. It does not
+//    include source code for modules or files that typically accompany the
+//    major components of the operating system on which the executable file
+//    runs.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+//
+//
+//
+// Filename: sv_profiler.h
+//
+// Description: Measures where the time of the server's tics goes
+//
+//-----------------------------------------------------------------------------
+
+#ifndef __SV_PROFILER_H__
+#define __SV_PROFILER_H__
+
+#include "doomtype.h"
+
+struct PClass;
+
+//*****************************************************************************
+//	DEFINES
+
+// The parts of SERVER_Tick that are timed separately.
+enum PROFILERPHASE_e
+{
+	PROFILERPHASE_GETPACKETS,
+	PROFILERPHASE_UNLAGGED,
+	PROFILERPHASE_TICKER,
+	PROFILERPHASE_TIMEOUTS,
+	PROFILERPHASE_WRITECOMMANDS,
+	PROFILERPHASE_SENDPACKETS,
+	PROFILERPHASE_DEMO,
+	PROFILERPHASE_SAVEDPACKETS,
+	PROFILERPHASE_FLUSHPACKETS,
+	PROFILERPHASE_MASTER,
+	PROFILERPHASE_RCON,
+	PROFILERPHASE_BANS,
+	PROFILERPHASE_OTHER,
+
+	NUM_PROFILERPHASES
+};
+
+//*****************************************************************************
+//	PROTOTYPES
+
+void		SERVERPROFILER_BeginTic( void );
+void		SERVERPROFILER_BeginPhase( PROFILERPHASE_e Phase );
+void		SERVERPROFILER_EndTic( void );
+bool		SERVERPROFILER_IsActive( void );
+SQWORD		SERVERPROFILER_Now( void );
+void		SERVERPROFILER_AddThinkerTime( const PClass *pType, SQWORD qwStart );
+void		SERVERPROFILER_AddACSScriptTime( int Script, SQWORD qwStart );
+
+#endif	// __SV_PROFILER_H__
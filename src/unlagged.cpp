@@ -61,6 +61,7 @@
 #include "sv_commands.h"
 #include "templates.h"
 #include "d_netinf.h"
+#include "c_dispatch.h"
 
 CVAR(Flag, sv_nounlagged, zadmflags, ZADF_NOUNLAGGED);
 CVAR( Bool, sv_unlagged_debugactors, false, 0 )
@@ -71,6 +72,59 @@ int reconciliationBlockers = 0;
 // To keep track of the shooter's height adjustement.
 fixed_t reconcilledZ;
 
+// The sectors whose heights changed within the last UNLAGGEDTICS tics, all others are where
+// they were on every tic that can be reconciled. The first numReconciledSectors of them were
+// rewound by the current reconciliation, sectors that start moving during it are appended.
+static TArray<sector_t *> movingSectors;
+static unsigned int numReconciledSectors = 0;
+
+// The players that were rewound by the current reconciliation.
+static bool reconciledPlayers[MAXPLAYERS];
+
+// Statistics for sv_unlaggedstats.
+static unsigned int numReconciliations = 0;
+static QWORD numSectorsRewound = 0;
+static QWORD numPlayersRewound = 0;
+static unsigned int maxSectorsRewound = 0;
+static unsigned int maxPlayersRewound = 0;
+
+// Returns false if a trace starting at (x, y), going in the direction of angle for at most
+// distance, can't touch the square of the given radius around (centerX, centerY).
+static bool unlagged_TraceMayTouch( fixed_t x, fixed_t y, angle_t angle, fixed_t distance, fixed_t centerX, fixed_t centerY, fixed_t radius )
+{
+	const double origin[2] = { FIXED2FLOAT( x ), FIXED2FLOAT( y ) };
+	const double direction[2] = { cos( ANGLE2RAD( angle )), sin( ANGLE2RAD( angle )) };
+	const double center[2] = { FIXED2FLOAT( centerX ), FIXED2FLOAT( centerY ) };
+	const double size = FIXED2FLOAT( radius );
+	double enter = 0;
+	double leave = FIXED2FLOAT( distance );
+
+	for ( int axis = 0; axis < 2; ++axis )
+	{
+		const double low = center[axis] - size - origin[axis];
+		const double high = center[axis] + size - origin[axis];
+
+		if ( fabs( direction[axis] ) < 1e-9 )
+		{
+			if (( low > 0 ) || ( high < 0 ))
+				return false;
+			continue;
+		}
+
+		double t1 = low / direction[axis];
+		double t2 = high / direction[axis];
+		if ( t1 > t2 )
+			swapvalues( t1, t2 );
+
+		enter = MAX( enter, t1 );
+		leave = MIN( leave, t2 );
+		if ( enter > leave )
+			return false;
+	}
+
+	return true;
+}
+
 void UNLAGGED_Tick( void )
 {
 	// [BB] Only the server has to do anything here.
@@ -129,7 +183,9 @@ int UNLAGGED_Gametic( player_t *player )
 
 // Shift stuff back in time before doing hitscan calculations
 // Call UNLAGGED_Restore afterwards to restore everything
-void UNLAGGED_Reconcile( AActor *actor )
+// If distance isn't zero, only the players that a trace from the actor in the direction of
+// angle could touch are moved. Spread widens the trace to the sides, e.g. for a rail's offset.
+void UNLAGGED_Reconcile( AActor *actor, angle_t angle, fixed_t distance, fixed_t spread )
 {
 	// [AK] Don't do anything if it's not a server with unlagged or if reconciliation is being blocked.
 	if (( NETWORK_GetState( ) != NETSTATE_SERVER ) || ( zadmflags & ZADF_NOUNLAGGED ) || ( reconciliationBlockers > 0 ))
@@ -161,21 +217,45 @@ void UNLAGGED_Reconcile( AActor *actor )
 	//find the index
 	const int unlaggedIndex = unlaggedGametic % UNLAGGEDTICS;
 
-	//reconcile the sectors
-	for (int i = 0; i < numsectors; ++i)
+	//reconcile the sectors, only the moving ones can be anywhere else
+	numReconciledSectors = movingSectors.Size();
+	for (unsigned int i = 0; i < numReconciledSectors; ++i)
 	{
-		sectors[i].floorplane.restoreD = sectors[i].floorplane.d;
-		sectors[i].ceilingplane.restoreD = sectors[i].ceilingplane.d;
+		sector_t *sector = movingSectors[i];
 
-		sectors[i].floorplane.d = sectors[i].floorplane.unlaggedD[unlaggedIndex];
-		sectors[i].ceilingplane.d = sectors[i].ceilingplane.unlaggedD[unlaggedIndex];
+		sector->floorplane.restoreD = sector->floorplane.d;
+		sector->ceilingplane.restoreD = sector->ceilingplane.d;
+
+		sector->floorplane.d = sector->floorplane.unlaggedD[unlaggedIndex];
+		sector->ceilingplane.d = sector->ceilingplane.unlaggedD[unlaggedIndex];
 	}
 
+	unsigned int numPlayers = 0;
+
 	//reconcile the players
 	for (int i = 0; i < MAXPLAYERS; ++i)
 	{
+		reconciledPlayers[i] = false;
+
 		if (playeringame[i] && players[i].mo && !players[i].bSpectating)
 		{
+			// A player the trace can neither touch where they are nor where they were
+			// doesn't need to be moved.
+			if (( distance > 0 ) && ( players + i != actor->player ))
+			{
+				const fixed_t radius = players[i].mo->radius + spread + FRACUNIT;
+
+				if (( unlagged_TraceMayTouch( actor->x, actor->y, angle, distance, players[i].mo->x, players[i].mo->y, radius ) == false ) &&
+					( unlagged_TraceMayTouch( actor->x, actor->y, angle, distance, players[i].unlaggedPos[unlaggedIndex][0], players[i].unlaggedPos[unlaggedIndex][1], radius ) == false ))
+				{
+					continue;
+				}
+			}
+
+			reconciledPlayers[i] = true;
+			if ( players + i != actor->player )
+				numPlayers++;
+
 			players[i].restorePos[0] = players[i].mo->x;
 			players[i].restorePos[1] = players[i].mo->y;
 			players[i].restorePos[2] = players[i].mo->z;
@@ -236,7 +316,13 @@ void UNLAGGED_Reconcile( AActor *actor )
 				reconcilledZ = actor->z;
 			}
 		}
-	}	
+	}
+
+	numReconciliations++;
+	numSectorsRewound += numReconciledSectors;
+	numPlayersRewound += numPlayers;
+	maxSectorsRewound = MAX( maxSectorsRewound, numReconciledSectors );
+	maxPlayersRewound = MAX( maxPlayersRewound, numPlayers );
 }
 
 void UNLAGGED_SwapSectorUnlaggedStatus( )
@@ -244,10 +330,10 @@ void UNLAGGED_SwapSectorUnlaggedStatus( )
 	if ( reconciledGame == false )
 		return;
 
-	for (int i = 0; i < numsectors; ++i)
+	for (unsigned int i = 0; i < numReconciledSectors; ++i)
 	{
-		swapvalues ( sectors[i].floorplane.d, sectors[i].floorplane.restoreD );
-		swapvalues ( sectors[i].ceilingplane.d, sectors[i].ceilingplane.restoreD );
+		swapvalues ( movingSectors[i]->floorplane.d, movingSectors[i]->floorplane.restoreD );
+		swapvalues ( movingSectors[i]->ceilingplane.d, movingSectors[i]->ceilingplane.restoreD );
 	}
 }
 
@@ -263,18 +349,19 @@ void UNLAGGED_Restore( AActor *actor )
 		return;
 
 	//restore the sectors
-	for (int i = 0; i < numsectors; ++i)
+	for (unsigned int i = 0; i < numReconciledSectors; ++i)
 	{
-		sectors[i].floorplane.d = sectors[i].floorplane.restoreD;
-		sectors[i].ceilingplane.d = sectors[i].ceilingplane.restoreD;
+		movingSectors[i]->floorplane.d = movingSectors[i]->floorplane.restoreD;
+		movingSectors[i]->ceilingplane.d = movingSectors[i]->ceilingplane.restoreD;
 	}
+	numReconciledSectors = 0;
 
 	const int unlaggedIndex = UNLAGGED_Gametic( actor->player ) % UNLAGGEDTICS;
 
 	//restore the players
 	for (int i = 0; i < MAXPLAYERS; ++i)
 	{
-		if (playeringame[i] && players[i].mo && !players[i].bSpectating)
+		if (reconciledPlayers[i] && playeringame[i] && players[i].mo && !players[i].bSpectating)
 		{
 			if ( players + i != actor->player )
 			{
@@ -359,13 +446,56 @@ void UNLAGGED_RecordSectors( )
 
 	//find the index
 	const int unlaggedIndex = gametic % UNLAGGEDTICS;
+	const int lastIndex = ( gametic + UNLAGGEDTICS - 1 ) % UNLAGGEDTICS;
 
-	//record the sectors
+	//record the sectors, noticing the ones that were moved without UNLAGGED_SectorMoved
 	for (int i = 0; i < numsectors; ++i)
 	{
+		if (( sectors[i].floorplane.d != sectors[i].floorplane.unlaggedD[lastIndex] ) ||
+			( sectors[i].ceilingplane.d != sectors[i].ceilingplane.unlaggedD[lastIndex] ))
+		{
+			UNLAGGED_SectorMoved( &sectors[i] );
+		}
+
 		sectors[i].floorplane.unlaggedD[unlaggedIndex] = sectors[i].floorplane.d;
 		sectors[i].ceilingplane.unlaggedD[unlaggedIndex] = sectors[i].ceilingplane.d;
 	}
+
+	//forget the sectors that have been at the same height for all tics that can be reconciled
+	for (unsigned int i = 0; i < movingSectors.Size(); )
+	{
+		if ( gametic - movingSectors[i]->lUnlaggedMoveTic >= UNLAGGEDTICS )
+		{
+			movingSectors[i]->bUnlaggedMoving = false;
+			movingSectors[i] = movingSectors[movingSectors.Size() - 1];
+			movingSectors.Pop();
+		}
+		else
+			++i;
+	}
+}
+
+// Called when the height of a sector changes, so that it's rewound until its
+// unlagged history is the same for all tics again.
+void UNLAGGED_SectorMoved( sector_t *sector )
+{
+	if (NETWORK_GetState() != NETSTATE_SERVER)
+		return;
+
+	sector->lUnlaggedMoveTic = gametic;
+
+	if ( sector->bUnlaggedMoving == false )
+	{
+		sector->bUnlaggedMoving = true;
+		movingSectors.Push( sector );
+	}
+}
+
+// Forgets the sectors of the map that is being unloaded.
+void UNLAGGED_ClearSectors( )
+{
+	movingSectors.Clear();
+	numReconciledSectors = 0;
 }
 
 bool UNLAGGED_DrawRailClientside ( AActor *attacker )
@@ -404,6 +534,11 @@ void UNLAGGED_GetHitOffset ( const AActor *attacker, const FTraceResults &trace,
 		const int unlaggedIndex = unlaggedGametic % UNLAGGEDTICS;
 
 		const player_t *hitPlayer = trace.Actor->player;
+
+		// This player wasn't moved.
+		if ( reconciledPlayers[hitPlayer - players] == false )
+			return;
+
 		hitOffset = hitPlayer->restorePos - hitPlayer->unlaggedPos[unlaggedIndex];
 	}
 }
@@ -467,3 +602,32 @@ void UNLAGGED_SpawnDebugActors ( )
 		pActor->Destroy();
 	}
 }
+
+// Shows how much UNLAGGED_Reconcile had to move.
+CCMD( sv_unlaggedstats )
+{
+	if ( NETWORK_GetState( ) != NETSTATE_SERVER )
+		return;
+
+	if (( argv.argc( ) >= 2 ) && ( stricmp( argv[1], "reset" ) == 0 ))
+	{
+		numReconciliations = 0;
+		numSectorsRewound = 0;
+		numPlayersRewound = 0;
+		maxSectorsRewound = 0;
+		maxPlayersRewound = 0;
+		Printf( "Unlagged statistics reset.\n" );
+		return;
+	}
+
+	Printf( "Sectors moving within the last %d tics: %u of %d\n", UNLAGGEDTICS, movingSectors.Size(), numsectors );
+	if ( numReconciliations == 0 )
+	{
+		Printf( "No shots reconciled yet.\n" );
+		return;
+	}
+
+	Printf( "Shots reconciled: %u\n", numReconciliations );
+	Printf( "Sectors rewound per shot: average %.2f, maximum %u\n", static_cast<double>( numSectorsRewound ) / numReconciliations, maxSectorsRewound );
+	Printf( "Players rewound per shot: average %.2f, maximum %u\n", static_cast<double>( numPlayersRewound ) / numReconciliations, maxPlayersRewound );
+}
@@ -57,12 +57,14 @@
 
 void	UNLAGGED_Tick( void );
 int		UNLAGGED_Gametic( player_t *player );
-void	UNLAGGED_Reconcile( AActor *actor );
+void	UNLAGGED_Reconcile( AActor *actor, angle_t angle = 0, fixed_t distance = 0, fixed_t spread = 0 );
 void	UNLAGGED_SwapSectorUnlaggedStatus( );
 void	UNLAGGED_Restore( AActor *actor );
 void	UNLAGGED_RecordPlayer( player_t *player );
 void	UNLAGGED_ResetPlayer( player_t *player );
 void	UNLAGGED_RecordSectors( );
+void	UNLAGGED_SectorMoved( sector_t *sector );
+void	UNLAGGED_ClearSectors( );
 bool	UNLAGGED_DrawRailClientside ( AActor *attacker );
 void	UNLAGGED_GetHitOffset ( const AActor *attacker, const FTraceResults &trace, TVector3<fixed_t> &hitOffset );
 bool	UNLAGGED_IsReconciled ( );
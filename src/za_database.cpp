@@ -49,7 +49,12 @@
 #include "i_system.h"
 #include "g_game.h"
 #include "p_acs.h"
+#include "stats.h"
 #include <sqlite3.h>
+#include <stdarg.h>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
 
 //*****************************************************************************
 //	DEFINES
@@ -64,6 +69,60 @@
 // [BB] Handle to our database.
 sqlite3 *g_db = NULL;
 
+// Is g_db a file in WAL mode? Only then the writer thread can write to it with a connection
+// of its own without blocking the reads of the game thread.
+static	bool	g_bDatabaseWAL = false;
+
+// Prepared statements of g_db, keyed by their SQL text. Only used by the game thread.
+struct CachedStatement
+{
+	FString			Command;
+	sqlite3_stmt	*Statement;
+	bool			InUse;
+};
+static	TArray<CachedStatement>	g_StatementCache;
+
+// An entry as it will be once the write is in the database.
+struct PendingWrite
+{
+	FString		Namespace;
+	FString		EntryName;
+	FString		Value;
+	bool		Delete;
+};
+
+// Writes of the Save* functions that are waiting for the writer thread, and the ones it is
+// writing right now. Reads are served from these before the database. Everything below is
+// guarded by g_WriteQueueMutex, except g_WriterDB, which only the writer thread uses while
+// it runs.
+static	std::mutex				g_WriteQueueMutex;
+static	std::condition_variable	g_WriteQueueSignal;
+static	std::condition_variable	g_WritesDoneSignal;
+static	TArray<PendingWrite>	g_WriteQueue;
+static	TArray<PendingWrite>	g_WritesInFlight;
+static	TArray<FString>			g_WriterErrors;
+static	std::thread				g_WriterThread;
+static	std::thread::id			g_WriterThreadId;
+static	sqlite3					*g_WriterDB = NULL;
+static	bool					g_bStopWriter = false;
+
+// Latencies of the database calls on the game thread and of the batches of the writer thread.
+struct LatencyHistogram
+{
+	unsigned int	Counts[8];
+	unsigned int	NumCalls;
+	double			TotalMS;
+	double			MaxMS;
+
+	void	Clear ( );
+	void	Add ( const double MS );
+	void	Print ( const char *Name ) const;
+};
+static	const double		g_LatencyBucketsMS[] = { 0.1, 0.5, 1, 5, 10, 50, 100 };
+static	LatencyHistogram	g_CallLatencies;
+static	LatencyHistogram	g_WriteLatencies;
+static	int					g_CallDepth = 0;
+
 // [BB] Filename for the database.
 CUSTOM_CVAR( String, databasefile, ":memory:", CVAR_ARCHIVE|CVAR_NOSETBYACS )
 {
@@ -77,23 +136,59 @@ CUSTOM_CVAR( Int, database_maxpagecount, 32768, CVAR_ARCHIVE|CVAR_NOSETBYACS )
 		DATABASE_SetMaxPageCount ( self );
 }
 
+// Write the Save* changes on a background thread, so that the game doesn't wait for the disk.
+// This only works for databases in WAL mode, the others are still written right away.
+CUSTOM_CVAR( Bool, database_writebehind, true, CVAR_ARCHIVE|CVAR_NOSETBYACS )
+{
+	if ( self == false )
+		DATABASE_Flush ( );
+}
+
 //*****************************************************************************
 //	PROTOTYPES
 
+static	void	database_PrintError ( const char *Format, ... ) GCCPRINTF(1,2);
+
 /**
  * \brief Handles the preparation, binding and execution of an SQLite command.
  *
+ * The prepared statements are cached and only reset when the command is done.
+ *
  * \author Benjamin Berkels
  */
 class DataBaseCommand
 {
 	sqlite3_stmt *_stmt;
+	int _cacheIndex;
 public:
-	DataBaseCommand ( const char *Command ) : _stmt ( NULL )
+	DataBaseCommand ( const char *Command ) : _stmt ( NULL ), _cacheIndex ( -1 )
 	{
-		int error = sqlite3_prepare ( g_db, Command, -1, &_stmt, NULL );
-		if ( error != SQLITE_OK )
-			Printf ( "Could not prepare statement. Error: %s\n", sqlite3_errmsg ( g_db ) );
+		for ( unsigned int i = 0; i < g_StatementCache.Size(); ++i )
+		{
+			if (( g_StatementCache[i].InUse == false ) && ( g_StatementCache[i].Command.Compare ( Command ) == 0 ))
+			{
+				_cacheIndex = i;
+				break;
+			}
+		}
+
+		if ( _cacheIndex < 0 )
+		{
+			int error = sqlite3_prepare_v2 ( g_db, Command, -1, &_stmt, NULL );
+			if ( error != SQLITE_OK )
+			{
+				database_PrintError ( "Could not prepare statement. Error: %s\n", sqlite3_errmsg ( g_db ) );
+				return;
+			}
+
+			CachedStatement entry;
+			entry.Command = Command;
+			entry.Statement = _stmt;
+			_cacheIndex = g_StatementCache.Push ( entry );
+		}
+
+		g_StatementCache[_cacheIndex].InUse = true;
+		_stmt = g_StatementCache[_cacheIndex].Statement;
 	}
 
 	~DataBaseCommand ( )
@@ -105,21 +200,24 @@ public:
 	{
 		int error = sqlite3_bind_text ( _stmt, Index, String, -1, SQLITE_STATIC );
 		if ( error != SQLITE_OK )
-			Printf ( "Could not bind text. Error: %s\n", sqlite3_errmsg ( g_db ) );
+			database_PrintError ( "Could not bind text. Error: %s\n", sqlite3_errmsg ( g_db ) );
 	}
 
 	void bindInt ( const int Index, const int IntValue )
 	{
 		int error = sqlite3_bind_int ( _stmt, Index, IntValue );
 		if ( error != SQLITE_OK )
-			Printf ( "Could not bind integer. Error: %s\n", sqlite3_errmsg ( g_db ) );
+			database_PrintError ( "Could not bind integer. Error: %s\n", sqlite3_errmsg ( g_db ) );
 	}
 
+	// Returns the statement to the cache.
 	void finalize ( )
 	{
 		if ( _stmt != NULL )
 		{
-			sqlite3_finalize ( _stmt );
+			sqlite3_reset ( _stmt );
+			sqlite3_clear_bindings ( _stmt );
+			g_StatementCache[_cacheIndex].InUse = false;
 			_stmt = NULL;
 		}
 	}
@@ -129,7 +227,7 @@ public:
 		const int result = sqlite3_step ( _stmt );
 		if ( ( result != SQLITE_ROW ) && ( result != SQLITE_DONE ) )
 		{
-			Printf ( "Could not step statement. Error: %s\n", sqlite3_errmsg ( g_db ) );
+			database_PrintError ( "Could not step statement. Error: %s\n", sqlite3_errmsg ( g_db ) );
 			finalize ( );
 		}
 
@@ -140,9 +238,9 @@ public:
 	{
 		const int result = sqlite3_step ( _stmt );
 		if ( result == SQLITE_ROW )
-			Printf ( "Executing statement did not finish, sqlite3_step() has another row ready.\n" );
+			database_PrintError ( "Executing statement did not finish, sqlite3_step() has another row ready.\n" );
 		else if ( result != SQLITE_DONE )
-			Printf ( "Could not execute statement. Error: %s\n", sqlite3_errmsg ( g_db ) );
+			database_PrintError ( "Could not execute statement. Error: %s\n", sqlite3_errmsg ( g_db ) );
 
 		finalize();
 	}
@@ -170,11 +268,338 @@ public:
 	}
 };
 
+/**
+ * \brief Adds the time spent in the outermost database call of the game thread to g_CallLatencies.
+ */
+class DataBaseCallTimer
+{
+	cycle_t _time;
+public:
+	DataBaseCallTimer ( )
+	{
+		if ( g_CallDepth++ == 0 )
+		{
+			_time.Reset();
+			_time.Clock();
+		}
+	}
+
+	~DataBaseCallTimer ( )
+	{
+		if ( --g_CallDepth == 0 )
+		{
+			_time.Unclock();
+			g_CallLatencies.Add ( _time.TimeMS() );
+		}
+	}
+};
+
 //*****************************************************************************
 //	FUNCTIONS
 
+void LatencyHistogram::Clear ( )
+{
+	memset ( Counts, 0, sizeof ( Counts ) );
+	NumCalls = 0;
+	TotalMS = MaxMS = 0;
+}
+
+//*****************************************************************************
+//
+void LatencyHistogram::Add ( const double MS )
+{
+	unsigned int bucket = 0;
+	while (( bucket < countof ( g_LatencyBucketsMS ) ) && ( MS >= g_LatencyBucketsMS[bucket] ))
+		++bucket;
+
+	++Counts[bucket];
+	++NumCalls;
+	TotalMS += MS;
+	MaxMS = MAX ( MaxMS, MS );
+}
+
+//*****************************************************************************
+//
+void LatencyHistogram::Print ( const char *Name ) const
+{
+	Printf ( "%s: %u, %.3f ms average, %.3f ms max\n", Name, NumCalls, ( NumCalls > 0 ) ? ( TotalMS / NumCalls ) : 0.0, MaxMS );
+
+	for ( unsigned int i = 0; i < countof ( Counts ); ++i )
+	{
+		if ( i < countof ( g_LatencyBucketsMS ) )
+			Printf ( "  < %6.1f ms: %u\n", g_LatencyBucketsMS[i], Counts[i] );
+		else
+			Printf ( " >= %6.1f ms: %u\n", g_LatencyBucketsMS[i-1], Counts[i] );
+	}
+}
+
+//*****************************************************************************
+//
+// Printf may only be used by the game thread, the errors of the writer thread are printed later.
+static void database_PrintError ( const char *Format, ... )
+{
+	FString message;
+	va_list argptr;
+	va_start ( argptr, Format );
+	message.VFormat ( Format, argptr );
+	va_end ( argptr );
+
+	if ( std::this_thread::get_id() == g_WriterThreadId )
+	{
+		std::lock_guard<std::mutex> lock ( g_WriteQueueMutex );
+		g_WriterErrors.Push ( message );
+	}
+	else
+		Printf ( "%s", message.GetChars() );
+}
+
+//*****************************************************************************
+//
+// Must be called with g_WriteQueueMutex held.
+static void database_PrintWriterErrors ( void )
+{
+	for ( unsigned int i = 0; i < g_WriterErrors.Size(); ++i )
+		Printf ( "Database writer: %s", g_WriterErrors[i].GetChars() );
+
+	g_WriterErrors.Clear();
+}
+
+//*****************************************************************************
+//
+// Writes a batch with the writer thread's own connection. The batch is a single transaction,
+// so that it only needs to be synced once.
+static void database_WriteBatch ( sqlite3_stmt *InsertStmt, sqlite3_stmt *DeleteStmt, const TArray<PendingWrite> &Writes )
+{
+	if ( sqlite3_exec ( g_WriterDB, "BEGIN IMMEDIATE", NULL, NULL, NULL ) != SQLITE_OK )
+	{
+		database_PrintError ( "Could not begin writing the entries. Error: %s\n", sqlite3_errmsg ( g_WriterDB ) );
+		return;
+	}
+
+	for ( unsigned int i = 0; i < Writes.Size(); ++i )
+	{
+		const PendingWrite &write = Writes[i];
+		sqlite3_stmt *stmt = write.Delete ? DeleteStmt : InsertStmt;
+
+		sqlite3_bind_text ( stmt, 1, write.Namespace.GetChars(), -1, SQLITE_STATIC );
+		sqlite3_bind_text ( stmt, 2, write.EntryName.GetChars(), -1, SQLITE_STATIC );
+		if ( write.Delete == false )
+			sqlite3_bind_text ( stmt, 3, write.Value.GetChars(), -1, SQLITE_STATIC );
+
+		if ( sqlite3_step ( stmt ) != SQLITE_DONE )
+			database_PrintError ( "Could not write entry %s. Error: %s\n", write.EntryName.GetChars(), sqlite3_errmsg ( g_WriterDB ) );
+
+		sqlite3_reset ( stmt );
+		sqlite3_clear_bindings ( stmt );
+	}
+
+	if ( sqlite3_exec ( g_WriterDB, "COMMIT", NULL, NULL, NULL ) != SQLITE_OK )
+	{
+		database_PrintError ( "Could not write the entries. Error: %s\n", sqlite3_errmsg ( g_WriterDB ) );
+		sqlite3_exec ( g_WriterDB, "ROLLBACK", NULL, NULL, NULL );
+	}
+}
+
+//*****************************************************************************
+//
+static void database_WriterMain ( void )
+{
+	sqlite3_stmt *insertStmt = NULL;
+	sqlite3_stmt *deleteStmt = NULL;
+	sqlite3_prepare_v2 ( g_WriterDB, "INSERT OR REPLACE INTO " TABLENAME " VALUES(?1,?2,?3,(" TIMEQUERY "))", -1, &insertStmt, NULL );
+	sqlite3_prepare_v2 ( g_WriterDB, "DELETE FROM " TABLENAME " WHERE Namespace=?1 AND KeyName=?2", -1, &deleteStmt, NULL );
+
+	std::unique_lock<std::mutex> lock ( g_WriteQueueMutex );
+
+	if (( insertStmt == NULL ) || ( deleteStmt == NULL ))
+		g_WriterErrors.Push ( FString ( "Could not prepare the write statements.\n" ) );
+
+	for ( ;; )
+	{
+		g_WriteQueueSignal.wait ( lock, [] { return g_bStopWriter || ( g_WriteQueue.Size() > 0 ); } );
+
+		// Only stop once everything is written.
+		if ( g_WriteQueue.Size() == 0 )
+			break;
+
+		g_WritesInFlight = g_WriteQueue;
+		g_WriteQueue.Clear();
+		lock.unlock();
+
+		// Neither the game thread's connection nor its lock are involved here, so its reads
+		// don't wait for the commit.
+		cycle_t time;
+		time.Reset();
+		time.Clock();
+		if (( insertStmt != NULL ) && ( deleteStmt != NULL ))
+			database_WriteBatch ( insertStmt, deleteStmt, g_WritesInFlight );
+		time.Unclock();
+
+		lock.lock();
+		g_WriteLatencies.Add ( time.TimeMS() );
+		g_WritesInFlight.Clear();
+		g_WritesDoneSignal.notify_all();
+	}
+
+	sqlite3_finalize ( insertStmt );
+	sqlite3_finalize ( deleteStmt );
+}
+
+//*****************************************************************************
+//
+// Opens the writer thread's connection to the database file and starts the thread.
+// Must be called with g_WriteQueueMutex held.
+static bool database_StartWriter ( void )
+{
+	const char *dbFileName = sqlite3_db_filename ( g_db, "main" );
+	if (( dbFileName == NULL ) || ( dbFileName[0] == '\0' ))
+		return false;
+
+	if ( sqlite3_open_v2 ( dbFileName, &g_WriterDB, SQLITE_OPEN_READWRITE, NULL ) != SQLITE_OK )
+	{
+		Printf ( "Can't open database \"%s\" for writing in the background: %s\n", dbFileName, sqlite3_errmsg ( g_WriterDB ) );
+		sqlite3_close ( g_WriterDB );
+		g_WriterDB = NULL;
+		return false;
+	}
+
+	// The writer waits for the transactions of the game thread instead of failing, and the
+	// page limit applies to its connection as well.
+	sqlite3_busy_timeout ( g_WriterDB, 60000 );
+	FString commandString;
+	commandString.Format ( "PRAGMA max_page_count=%d", *database_maxpagecount );
+	sqlite3_exec ( g_WriterDB, commandString.GetChars(), NULL, NULL, NULL );
+
+	g_WriterThread = std::thread ( database_WriterMain );
+	g_WriterThreadId = g_WriterThread.get_id();
+	return true;
+}
+
+//*****************************************************************************
+//
+static void database_StopWriter ( void )
+{
+	if ( g_WriterThread.joinable() == false )
+		return;
+
+	{
+		std::lock_guard<std::mutex> lock ( g_WriteQueueMutex );
+		g_bStopWriter = true;
+	}
+	g_WriteQueueSignal.notify_one();
+	g_WriterThread.join();
+
+	std::lock_guard<std::mutex> lock ( g_WriteQueueMutex );
+	g_bStopWriter = false;
+	g_WriterThreadId = std::thread::id();
+	sqlite3_close ( g_WriterDB );
+	g_WriterDB = NULL;
+	database_PrintWriterErrors();
+}
+
+//*****************************************************************************
+//
+// Looks for the newest pending write of the entry. Must be called with g_WriteQueueMutex held.
+static const PendingWrite *database_FindPendingWrite ( const char *Namespace, const char *EntryName )
+{
+	const TArray<PendingWrite> *lists[] = { &g_WriteQueue, &g_WritesInFlight };
+
+	for ( unsigned int list = 0; list < countof ( lists ); ++list )
+	{
+		for ( unsigned int i = lists[list]->Size(); i-- > 0; )
+		{
+			const PendingWrite &write = (*lists[list])[i];
+			if (( write.EntryName.Compare ( EntryName ) == 0 ) && ( write.Namespace.Compare ( Namespace ) == 0 ))
+				return &write;
+		}
+	}
+
+	return NULL;
+}
+
+//*****************************************************************************
+//
+// Writes the entry right away with the game thread's connection.
+static void database_ApplyWrite ( const PendingWrite &Write )
+{
+	if ( Write.Delete )
+	{
+		DataBaseCommand cmd ( "DELETE FROM " TABLENAME " WHERE Namespace=?1 AND KeyName=?2" );
+		cmd.bindString ( 1, Write.Namespace.GetChars() );
+		cmd.bindString ( 2, Write.EntryName.GetChars() );
+		cmd.exec ( );
+	}
+	else
+	{
+		DataBaseCommand cmd ( "INSERT OR REPLACE INTO " TABLENAME " VALUES(?1,?2,?3,(" TIMEQUERY "))" );
+		cmd.bindString ( 1, Write.Namespace.GetChars() );
+		cmd.bindString ( 2, Write.EntryName.GetChars() );
+		cmd.bindString ( 3, Write.Value.GetChars() );
+		cmd.exec ( );
+	}
+}
+
+//*****************************************************************************
+//
+// Sets an entry to its new value, or deletes it if Delete is true. Reads see the new
+// value right away, but the database only gets it once the writer thread is done.
+// In-memory databases and databases that aren't in WAL mode are written right away,
+// and so are the writes within a transaction, which belong to that transaction.
+static void database_QueueWrite ( const char *Namespace, const char *EntryName, const char *Value, const bool Delete )
+{
+	PendingWrite write;
+	write.Namespace = Namespace;
+	write.EntryName = EntryName;
+	write.Value = Value;
+	write.Delete = Delete;
+
+	if (( database_writebehind == false ) || ( g_bDatabaseWAL == false ) || ( sqlite3_get_autocommit ( g_db ) == 0 ))
+	{
+		database_ApplyWrite ( write );
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock ( g_WriteQueueMutex );
+	database_PrintWriterErrors();
+
+	if (( g_WriterThread.joinable() == false ) && ( database_StartWriter ( ) == false ))
+	{
+		database_ApplyWrite ( write );
+		return;
+	}
+
+	g_WriteQueue.Push ( write );
+	g_WriteQueueSignal.notify_one();
+}
+
+//*****************************************************************************
+//
+// Checks whether the database is in WAL mode.
+static void database_UpdateJournalMode ( void )
+{
+	g_bDatabaseWAL = false;
+
+	const char *dbFileName = sqlite3_db_filename ( g_db, "main" );
+	if (( dbFileName == NULL ) || ( dbFileName[0] == '\0' ))
+		return;
+
+	DataBaseCommand cmd ( "PRAGMA journal_mode" );
+	if ( cmd.step ( ) && ( cmd.getText ( 0 ) != NULL ))
+		g_bDatabaseWAL = ( stricmp ( reinterpret_cast<const char *> ( cmd.getText ( 0 ) ), "wal" ) == 0 );
+}
+
+//*****************************************************************************
+//
 void database_ClearHandle ( void )
 {
+	// Everything that is still pending goes to the old database.
+	database_StopWriter ( );
+	g_bDatabaseWAL = false;
+
+	for ( unsigned int i = 0; i < g_StatementCache.Size(); ++i )
+		sqlite3_finalize ( g_StatementCache[i].Statement );
+	g_StatementCache.Clear();
+
 	if ( g_db != NULL )
 	{
 		sqlite3_close ( g_db );
@@ -188,7 +613,7 @@ void database_ExecuteCommand ( const char *Command, int (*Callback)(void*,int,ch
 {
 	int error = sqlite3_exec ( g_db, Command, Callback, Data, 0);
 	if ( error != SQLITE_OK )
-		Printf ( "Error: %s\n", sqlite3_errmsg ( g_db ) );
+		database_PrintError ( "Error: %s\n", sqlite3_errmsg ( g_db ) );
 }
 
 //*****************************************************************************
@@ -196,6 +621,9 @@ void database_ExecuteCommand ( const char *Command, int (*Callback)(void*,int,ch
 
 void DATABASE_Construct( void )
 {
+	g_CallLatencies.Clear();
+	g_WriteLatencies.Clear();
+
 	// [BB] At least we should close the database in case it is open.
 	atterm( DATABASE_Destruct );
 }
@@ -238,6 +666,10 @@ void DATABASE_Init ( void )
 
 	// [BB] Now that the database is ready, we can set the max page count.
 	DATABASE_SetMaxPageCount ( database_maxpagecount );
+
+	// The writer thread needs WAL mode, so that the game thread can read while it writes.
+	// The journal mode is up to the admin though, see db_enable_wal.
+	database_UpdateJournalMode ( );
 }
 
 //*****************************************************************************
@@ -260,6 +692,9 @@ void DATABASE_SetMaxPageCount ( const unsigned int MaxPageCount )
 	// we'll have to use this workaround.
 	commandString.Format ( "PRAGMA max_page_count=%d", MaxPageCount );
 	database_ExecuteCommand ( commandString.GetChars() );
+
+	// The writer thread picks up the new limit when it is started again.
+	database_StopWriter ( );
 }
 
 //*****************************************************************************
@@ -269,6 +704,11 @@ void DATABASE_BeginTransaction ( void )
 	if ( DATABASE_IsAvailable ( "DATABASE_BeginTransaction" ) == false )
 		return;
 
+	DataBaseCallTimer timer;
+	// The writes within the transaction are done right away, the ones before it must not
+	// have to wait for it.
+	DATABASE_Flush ( );
+
 	database_ExecuteCommand ( "BEGIN TRANSACTION" );
 }
 
@@ -279,6 +719,9 @@ void DATABASE_EndTransaction ( void )
 	if ( DATABASE_IsAvailable ( "DATABASE_EndTransaction" ) == false )
 		return;
 
+	DataBaseCallTimer timer;
+	DATABASE_Flush ( );
+
 	database_ExecuteCommand ( "END TRANSACTION" );
 }
 
@@ -289,6 +732,7 @@ void DATABASE_CreateTable ( )
 	if ( DATABASE_IsAvailable ( "DATABASE_CreateTable" ) == false )
 		return;
 
+	DataBaseCallTimer timer;
 	database_ExecuteCommand ( "CREATE TABLE if not exists " TABLENAME "(Namespace text, KeyName text, Value text, Timestamp text, PRIMARY KEY (Namespace, KeyName))" );
 }
 
@@ -299,6 +743,9 @@ void DATABASE_ClearTable ( )
 	if ( DATABASE_IsAvailable ( "DATABASE_ClearTable" ) == false )
 		return;
 
+	DataBaseCallTimer timer;
+	DATABASE_Flush ( );
+
 	database_ExecuteCommand ( "DELETE FROM " TABLENAME );
 }
 
@@ -309,6 +756,9 @@ void DATABASE_DeleteTable ( )
 	if ( DATABASE_IsAvailable ( "DATABASE_DeleteTable" ) == false )
 		return;
 
+	DataBaseCallTimer timer;
+	DATABASE_Flush ( );
+
 	database_ExecuteCommand ( "DROP TABLE " TABLENAME );
 }
 
@@ -330,6 +780,9 @@ void DATABASE_DumpTable ( )
 	if ( DATABASE_IsAvailable ( "DATABASE_DumpTable" ) == false )
 		return;
 
+	DataBaseCallTimer timer;
+	DATABASE_Flush ( );
+
 	Printf ( "Dumping table \"%s\"\n", TABLENAME );
 	database_ExecuteCommand ( "SELECT * from " TABLENAME, database_DumpTableCallback );
 }
@@ -341,7 +794,11 @@ void DATABASE_EnableWAL ( )
 	if ( DATABASE_IsAvailable ( "DATABASE_EnableWAL" ) == false )
 		return;
 
+	DataBaseCallTimer timer;
+	DATABASE_Flush ( );
+
 	database_ExecuteCommand ( "PRAGMA journal_mode=WAL" );
+	database_UpdateJournalMode ( );
 }
 
 //*****************************************************************************
@@ -351,7 +808,12 @@ void DATABASE_DisableWAL ( )
 	if ( DATABASE_IsAvailable ( "DATABASE_DisableWAL" ) == false )
 		return;
 
+	DataBaseCallTimer timer;
+	// Leaving WAL mode needs the only connection to the database.
+	database_StopWriter ( );
+
 	database_ExecuteCommand ( "PRAGMA journal_mode=DELETE" );
+	database_UpdateJournalMode ( );
 }
 
 //*****************************************************************************
@@ -361,6 +823,9 @@ void DATABASE_DumpNamespace ( const char *Namespace )
 	if ( DATABASE_IsAvailable ( "DATABASE_DumpNamespace" ) == false )
 		return;
 
+	DataBaseCallTimer timer;
+	DATABASE_Flush ( );
+
 	Printf ( "Dumping namespace \"%s\"\n", Namespace );
 	DataBaseCommand cmd ( "SELECT * from " TABLENAME " WHERE Namespace=?1" );
 	cmd.bindString ( 1, Namespace );
@@ -376,6 +841,9 @@ void DATABASE_AddEntry ( const char *Namespace, const char *EntryName, const cha
 	if ( DATABASE_IsAvailable ( "DATABASE_AddEntry" ) == false )
 		return;
 
+	DataBaseCallTimer timer;
+	DATABASE_Flush ( );
+
 	DataBaseCommand cmd ( "INSERT INTO " TABLENAME " VALUES(?1,?2,?3,(" TIMEQUERY "))" );
 	cmd.bindString ( 1, Namespace );
 	cmd.bindString ( 2, EntryName );
@@ -390,6 +858,9 @@ void DATABASE_SetEntry ( const char *Namespace, const char *EntryName, const cha
 	if ( DATABASE_IsAvailable ( "DATABASE_SetEntry" ) == false )
 		return;
 
+	DataBaseCallTimer timer;
+	DATABASE_Flush ( );
+
 	DataBaseCommand cmd ( "UPDATE " TABLENAME " SET Value=?3,Timestamp=(" TIMEQUERY ") WHERE Namespace=?1 AND KeyName=?2" );
 	cmd.bindString ( 1, Namespace );
 	cmd.bindString ( 2, EntryName );
@@ -404,6 +875,15 @@ FString DATABASE_GetEntry ( const char *Namespace, const char *EntryName )
 	if ( DATABASE_IsAvailable ( "DATABASE_GetEntry" ) == false )
 		return "";
 
+	DataBaseCallTimer timer;
+
+	{
+		std::lock_guard<std::mutex> lock ( g_WriteQueueMutex );
+		const PendingWrite *write = database_FindPendingWrite ( Namespace, EntryName );
+		if ( write != NULL )
+			return write->Delete ? FString ( "" ) : write->Value;
+	}
+
 	DataBaseCommand cmd ( "SELECT * FROM " TABLENAME " WHERE Namespace=?1 AND KeyName=?2" );
 	cmd.bindString ( 1, Namespace );
 	cmd.bindString ( 2, EntryName );
@@ -422,6 +902,15 @@ bool DATABASE_EntryExists ( const char *Namespace, const char *EntryName )
 	if ( DATABASE_IsAvailable ( "DATABASE_GetEntry" ) == false )
 		return "";
 
+	DataBaseCallTimer timer;
+
+	{
+		std::lock_guard<std::mutex> lock ( g_WriteQueueMutex );
+		const PendingWrite *write = database_FindPendingWrite ( Namespace, EntryName );
+		if ( write != NULL )
+			return ( write->Delete == false );
+	}
+
 	DataBaseCommand cmd ( "SELECT * FROM " TABLENAME " WHERE Namespace=?1 AND KeyName=?2" );
 	cmd.bindString ( 1, Namespace );
 	cmd.bindString ( 2, EntryName );
@@ -436,6 +925,9 @@ void DATABASE_DeleteEntry ( const char *Namespace, const char *EntryName )
 	if ( DATABASE_IsAvailable ( "DATABASE_DeleteEntry" ) == false )
 		return;
 
+	DataBaseCallTimer timer;
+	DATABASE_Flush ( );
+
 	DataBaseCommand cmd ( "DELETE FROM " TABLENAME " WHERE Namespace=?1 AND KeyName=?2" );
 	cmd.bindString ( 1, Namespace );
 	cmd.bindString ( 2, EntryName );
@@ -449,17 +941,14 @@ void DATABASE_SaveSetEntry ( const char *Namespace, const char *EntryName, const
 	if ( DATABASE_IsAvailable ( "DATABASE_SaveSetEntry" ) == false )
 		return;
 
-	if ( DATABASE_EntryExists ( Namespace, EntryName ) )
-	{
-		// [BB] Setting an entry to the empty string deletes the entry.
-		if ( EntryValue && ( strlen ( EntryValue ) > 0 ) )
-			DATABASE_SetEntry ( Namespace, EntryName, EntryValue );
-		else
-			DATABASE_DeleteEntry ( Namespace, EntryName );
-	}
+	DataBaseCallTimer timer;
+
+	// [BB] Setting an entry to the empty string deletes the entry.
+	if ( EntryValue && ( strlen ( EntryValue ) > 0 ) )
+		database_QueueWrite ( Namespace, EntryName, EntryValue, false );
 	// [BB] Don't store empty string entries.
-	else if ( EntryValue && ( strlen ( EntryValue ) > 0 ) )
-		DATABASE_AddEntry ( Namespace, EntryName, EntryValue );
+	else if ( DATABASE_EntryExists ( Namespace, EntryName ) )
+		database_QueueWrite ( Namespace, EntryName, "", true );
 }
 
 //*****************************************************************************
@@ -478,6 +967,7 @@ FString DATABASE_SaveGetEntry ( const char *Namespace, const char *EntryName )
 	if ( DATABASE_IsAvailable ( "DATABASE_SaveGetEntry" ) == false )
 		return "";
 
+	DataBaseCallTimer timer;
 	if ( DATABASE_EntryExists ( Namespace, EntryName ) )
 		return DATABASE_GetEntry ( Namespace, EntryName );
 	else
@@ -491,21 +981,17 @@ void DATABASE_SaveIncrementEntryInt ( const char *Namespace, const char *EntryNa
 	if ( DATABASE_IsAvailable ( "DATABASE_SaveIncrementEntryInt" ) == false )
 		return;
 
-	FString newVal;
+	DataBaseCallTimer timer;
+
+	// The new value is computed here, so that the write can be queued. Like CAST(Value AS INTEGER),
+	// this uses the leading digits of the old value.
+	long long value = Increment;
 	if ( DATABASE_EntryExists ( Namespace, EntryName ) )
-	{
-		// [BB] Get the old value and set the incremented value in a single query.
-		DataBaseCommand cmd ( "UPDATE " TABLENAME " SET Value=(SELECT CAST(Value AS INTEGER) FROM " TABLENAME " WHERE Namespace=?1 AND KeyName=?2)+?3,Timestamp=(" TIMEQUERY ") WHERE Namespace=?1 AND KeyName=?2" );
-		cmd.bindString ( 1, Namespace );
-		cmd.bindString ( 2, EntryName );
-		cmd.bindInt ( 3, Increment );
-		cmd.exec ( );
-	}
-	else
-	{
-		newVal.AppendFormat ( "%d", Increment );
-		DATABASE_AddEntry ( Namespace, EntryName, newVal.GetChars() );
-	}
+		value += strtoll ( DATABASE_GetEntry ( Namespace, EntryName ).GetChars(), NULL, 10 );
+
+	FString newVal;
+	newVal.AppendFormat ( "%lld", value );
+	database_QueueWrite ( Namespace, EntryName, newVal.GetChars(), false );
 }
 
 //*****************************************************************************
@@ -515,6 +1001,9 @@ int DATABASE_GetEntryRank ( const char *Namespace, const char *EntryName, const
 	if ( DATABASE_IsAvailable ( "DATABASE_GetEntryRank" ) == false )
 		return -1;
 
+	DataBaseCallTimer timer;
+	DATABASE_Flush ( );
+
 	if ( DATABASE_EntryExists ( Namespace, EntryName ) )
 	{
 		// [BB] To get the rank of a certain entry, we get the value of the entry,
@@ -548,6 +1037,9 @@ int DATABASE_GetSortedEntries ( const char *Namespace, const int N, const int Of
 		return 0;
 	}
 
+	DataBaseCallTimer timer;
+	DATABASE_Flush ( );
+
 	FString commandString;
 	commandString.Format ( "SELECT * from " TABLENAME " WHERE Namespace=?1 ORDER BY CAST(Value AS INTEGER) " );
 	commandString += Descending ? "DESC" : "ASC";
@@ -570,12 +1062,27 @@ int DATABASE_GetEntries ( const char *Namespace, TArray<std::pair<FString, FStri
 		return 0;
 	}
 
+	DataBaseCallTimer timer;
+	DATABASE_Flush ( );
+
 	DataBaseCommand cmd ( "SELECT * from " TABLENAME " WHERE Namespace=?1" );
 	cmd.bindString ( 1, Namespace );
 	cmd.iterateAndGetReturnedEntries ( Entries );
 	return Entries.Size();
 }
 
+//*****************************************************************************
+//
+// Waits until the writer thread has written all pending changes.
+void DATABASE_Flush ( void )
+{
+	DataBaseCallTimer timer;
+
+	std::unique_lock<std::mutex> lock ( g_WriteQueueMutex );
+	g_WritesDoneSignal.wait ( lock, [] { return ( g_WriteQueue.Size() == 0 ) && ( g_WritesInFlight.Size() == 0 ); } );
+	database_PrintWriterErrors();
+}
+
 //*****************************************************************************
 //	CONSOLE COMMANDS
 
@@ -601,3 +1108,20 @@ CCMD ( db_disable_wal )
 
 	DATABASE_DisableWAL();
 }
+
+CCMD ( db_stats )
+{
+	std::lock_guard<std::mutex> lock ( g_WriteQueueMutex );
+
+	if (( argv.argc( ) >= 2 ) && ( stricmp( argv[1], "reset" ) == 0 ))
+	{
+		g_CallLatencies.Clear();
+		g_WriteLatencies.Clear();
+		Printf ( "Database statistics reset.\n" );
+		return;
+	}
+
+	g_CallLatencies.Print ( "Database calls" );
+	g_WriteLatencies.Print ( "Background write batches" );
+	Printf ( "%u writes pending, %u statements cached\n", g_WriteQueue.Size() + g_WritesInFlight.Size(), g_StatementCache.Size() );
+}
@@ -59,6 +59,7 @@ bool	DATABASE_IsAvailable ( const char *CallingFunction = NULL );
 void	DATABASE_SetMaxPageCount ( const unsigned int MaxPageCount );
 void	DATABASE_BeginTransaction ( void );
 void	DATABASE_EndTransaction ( void );
+void	DATABASE_Flush ( void );
 void	DATABASE_CreateTable ( );
 void	DATABASE_ClearTable ( );
 void	DATABASE_DeleteTable ( );
@@ -0,0 +1,271 @@
+//-----------------------------------------------------------------------------
+//
+// Zandronum Source
+// Copyright (C) 2026 Zandronum Development Team
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the Skulltag Development Team nor the names of its
+//    contributors may be used to endorse or promote products derived from this
+//    software without specific prior written permission.
+// 4. Redistributions in any form must be accompanied by information on how to
+//    obtain complete source code for the software and any accompanying
+//    software that uses the software. The source code must either be included
+//    in the distribution or be available for no more than the cost of
+//    distribution plus a nominal fee, and must be freely redistributable
+//    under reasonable conditions. For an executable file, complete source
+//    code means the source code for all modules it contains. It does not
+//    include source code for modules or files that typically accompany the
+//    major components of the operating system on which the executable file
+//    runs.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+//
+//
+// Filename: huffbench.cpp
+//
+// Description: Measures the throughput of the network Huffman codec over captured
+// packets and verifies that the table driven and the bitwise codec agree.
+//
+//-----------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <vector>
+
+#include "huffman.h"
+
+using namespace skulltag;
+
+// A packet of the corpus, not Huffman-encoded.
+struct Packet
+{
+	std::vector<unsigned char> data;
+};
+
+//*****************************************************************************
+//
+// Reads a corpus written by the net_capturepackets CCMD: every packet is stored as
+// a two byte little endian length followed by the packet data.
+static bool huffbench_LoadCorpus( const char *filename, std::vector<Packet> &packets )
+{
+	FILE *file = fopen( filename, "rb" );
+	if ( file == NULL )
+	{
+		fprintf( stderr, "Can't open %s\n", filename );
+		return false;
+	}
+
+	unsigned char header[2];
+	while ( fread( header, 1, 2, file ) == 2 )
+	{
+		Packet packet;
+		packet.data.resize( header[0] | ( header[1] << 8 ));
+		if (( packet.data.size() > 0 ) && ( fread( &packet.data[0], 1, packet.data.size(), file ) != packet.data.size() ))
+		{
+			fprintf( stderr, "%s is truncated, ignoring the last packet\n", filename );
+			break;
+		}
+		packets.push_back( packet );
+	}
+
+	fclose( file );
+	return true;
+}
+
+//*****************************************************************************
+//
+// Without captured packets, generate some where every byte value occurs about as
+// often as its code length suggests, i.e. data the tree compresses well.
+static void huffbench_GenerateCorpus( const HuffmanCodec *codec, std::vector<Packet> &packets )
+{
+	unsigned char encoded[8192];
+	unsigned char decoded[8192];
+	srand( 0 );
+
+	for ( int i = 0; i < 20000; i++ )
+	{
+		// Random bits decode to values with the frequencies the tree was built for.
+		const int size = 16 + rand() % 1000;
+		for ( int j = 0; j < size; j++ )
+			encoded[j] = static_cast<unsigned char>( rand() );
+		encoded[0] = 0;
+
+		Packet packet;
+		packet.data.resize( sizeof( decoded ));
+		const int decodedSize = codec->decodeBitwise( encoded, &packet.data[0], size, sizeof( decoded ));
+		packet.data.resize( decodedSize );
+		packets.push_back( packet );
+	}
+}
+
+//*****************************************************************************
+//
+static double huffbench_Seconds( std::chrono::steady_clock::time_point start )
+{
+	return std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count();
+}
+
+//*****************************************************************************
+//
+int main( int argc, char **argv )
+{
+	std::vector<Packet> packets;
+	HUFFMAN_Construct();
+	HuffmanCodec *codec = HUFFMAN_GetCodec();
+
+	for ( int i = 1; i < argc; i++ )
+	{
+		if ( huffbench_LoadCorpus( argv[i], packets ) == false )
+			return 1;
+	}
+
+	if ( packets.size() == 0 )
+	{
+		printf( "No corpus given, using generated packets.\n" );
+		huffbench_GenerateCorpus( codec, packets );
+	}
+
+	size_t totalBytes = 0;
+	for ( size_t i = 0; i < packets.size(); i++ )
+		totalBytes += packets[i].data.size();
+
+	// Packets made of broadcast commands: everything after the 5 byte packet header
+	// reuses codes that were computed once, see HuffmanCodec::encodeSegments.
+	const int sharedHeaderSize = 5;
+	std::vector<std::vector<unsigned int> > sharedCodes( packets.size() );
+	std::vector<int> sharedCodeBits( packets.size(), -1 );
+	for ( size_t i = 0; i < packets.size(); i++ )
+	{
+		const int size = static_cast<int>( packets[i].data.size() ) - sharedHeaderSize;
+		if ( size <= 0 )
+			continue;
+
+		sharedCodes[i].resize( size + 1 );
+		sharedCodeBits[i] = codec->precomputeCodes( &packets[i].data[sharedHeaderSize], size, sharedCodes[i].data(), size + 1 );
+	}
+
+	// Encode everything once to verify both encoders and to get the input of the decoders.
+	std::vector<Packet> encodedPackets( packets.size() );
+	size_t totalEncodedBytes = 0;
+	for ( size_t i = 0; i < packets.size(); i++ )
+	{
+		const std::vector<unsigned char> &data = packets[i].data;
+		const int inSize = static_cast<int>( data.size() );
+		const int outSize = inSize + 1;
+		std::vector<unsigned char> bitwise( outSize ), table( outSize ), decoded( inSize + 1 );
+
+		const int bitwiseSize = codec->encodeBitwise( data.data(), bitwise.data(), inSize, outSize );
+		const int tableSize = codec->encode( data.data(), table.data(), inSize, outSize );
+		if (( bitwiseSize != tableSize ) || ( memcmp( bitwise.data(), table.data(), ( tableSize > 0 ) ? tableSize : 0 ) != 0 ))
+		{
+			fprintf( stderr, "Encoder mismatch on packet %u\n", static_cast<unsigned int>( i ));
+			return 1;
+		}
+
+		if ( sharedCodeBits[i] >= 0 )
+		{
+			skulltag::HuffmanCodec::EncodeSegment segments[2] = {
+				{ data.data(), sharedHeaderSize, NULL, 0 },
+				{ data.data() + sharedHeaderSize, inSize - sharedHeaderSize, sharedCodes[i].data(), sharedCodeBits[i] } };
+			const int sharedSize = codec->encodeSegments( segments, 2, bitwise.data(), outSize );
+			if (( sharedSize != tableSize ) || ( memcmp( bitwise.data(), table.data(), ( tableSize > 0 ) ? tableSize : 0 ) != 0 ))
+			{
+				fprintf( stderr, "Segment encoder mismatch on packet %u\n", static_cast<unsigned int>( i ));
+				return 1;
+			}
+		}
+
+		// Incompressible packets are sent unencoded, they aren't interesting here.
+		if ( tableSize < 0 )
+			continue;
+
+		encodedPackets[i].data.assign( table.begin(), table.begin() + tableSize );
+		totalEncodedBytes += tableSize;
+
+		const int bitwiseDecodedSize = codec->decodeBitwise( table.data(), decoded.data(), tableSize, inSize + 1 );
+		if (( bitwiseDecodedSize != inSize ) || ( memcmp( decoded.data(), data.data(), inSize ) != 0 ))
+		{
+			fprintf( stderr, "Bitwise decoder mismatch on packet %u\n", static_cast<unsigned int>( i ));
+			return 1;
+		}
+		const int tableDecodedSize = codec->decode( table.data(), decoded.data(), tableSize, inSize + 1 );
+		if (( tableDecodedSize != inSize ) || ( memcmp( decoded.data(), data.data(), inSize ) != 0 ))
+		{
+			fprintf( stderr, "Table decoder mismatch on packet %u\n", static_cast<unsigned int>( i ));
+			return 1;
+		}
+	}
+
+	printf( "%u packets, %u bytes, %u bytes encoded (%.1f%%)\n", static_cast<unsigned int>( packets.size() ),
+		static_cast<unsigned int>( totalBytes ), static_cast<unsigned int>( totalEncodedBytes ),
+		( totalBytes > 0 ) ? 100.0 * totalEncodedBytes / totalBytes : 0.0 );
+
+	// Repeat the corpus until every measurement processes at least this many bytes.
+	const double targetBytes = 256.0 * 1024 * 1024;
+	const int rounds = static_cast<int>( targetBytes / ( totalBytes > 0 ? totalBytes : 1 )) + 1;
+	std::vector<unsigned char> output( 65536 );
+	const char *names[] = { "encode (bitwise)", "encode (table)", "encode (shared)", "decode (bitwise)", "decode (table)" };
+
+	for ( int test = 0; test < 5; test++ )
+	{
+		const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		size_t checksum = 0;
+
+		for ( int round = 0; round < rounds; round++ )
+		{
+			for ( size_t i = 0; i < packets.size(); i++ )
+			{
+				const std::vector<unsigned char> &in = ( test < 3 ) ? packets[i].data : encodedPackets[i].data;
+				const int inSize = static_cast<int>( in.size() );
+				if ( inSize == 0 )
+					continue;
+
+				switch ( test )
+				{
+				case 0: checksum += codec->encodeBitwise( in.data(), output.data(), inSize, inSize + 1 ); break;
+				case 1: checksum += codec->encode( in.data(), output.data(), inSize, inSize + 1 ); break;
+				case 2:
+					if ( sharedCodeBits[i] < 0 )
+						checksum += codec->encode( in.data(), output.data(), inSize, inSize + 1 );
+					else
+					{
+						skulltag::HuffmanCodec::EncodeSegment segments[2] = {
+							{ in.data(), sharedHeaderSize, NULL, 0 },
+							{ in.data() + sharedHeaderSize, inSize - sharedHeaderSize, sharedCodes[i].data(), sharedCodeBits[i] } };
+						checksum += codec->encodeSegments( segments, 2, output.data(), inSize + 1 );
+					}
+					break;
+				case 3: checksum += codec->decodeBitwise( in.data(), output.data(), inSize, static_cast<int>( output.size() )); break;
+				case 4: checksum += codec->decode( in.data(), output.data(), inSize, static_cast<int>( output.size() )); break;
+				}
+			}
+		}
+
+		const double seconds = huffbench_Seconds( start );
+		// Throughput is always given in terms of unencoded bytes.
+		printf( "%-18s %8.1f MB/s (%zu)\n", names[test], ( static_cast<double>( totalBytes ) * rounds / ( 1024 * 1024 )) / seconds, checksum );
+	}
+
+	return 0;
+}